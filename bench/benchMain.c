@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench_ringQueue.h"
+#include "bench_mpmcQueue.h"
+#include "bench_lockFreeStack.h"
+#include "bench_workDeque.h"
+#include "bench_linkedList.h"
+#include "bench_unrolledList.h"
+#include "bench_skipList.h"
+#include "bench_sort.h"
+#include "bench_bulk.h"
+#include "bench_fastPath.h"
+#include "bench_generic.h"
+#include "bench_priorityQueue.h"
+#include "bench_ops.h"
+
+/** usage: bench_runner [csv path, "-" for stdout] [largest size] */
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "bench_results.csv";
+  int maxSize = argc > 2 ? atoi(argv[2]) : 10000000;
+  printf("\n");
+
+  LDSC_ringQueue_bench();
+  LDSC_mpmcQueue_bench();
+  LDSC_lockFreeStack_bench();
+  LDSC_workDeque_bench();
+  LDSC_linkedList_bench();
+  LDSC_unrolledList_bench();
+  LDSC_skipList_bench();
+  LDSC_sort_bench();
+  LDSC_bulk_bench();
+  LDSC_fastPath_bench();
+  LDSC_generic_bench();
+  LDSC_priorityQueue_bench();
+  LDSC_ops_bench(path, maxSize);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_linkedList.h"
+#include "LDSC_queue.h"
+#include "LDSC_stack.h"
+#include "bench_bulk.h"
+#include "bench_timer.h"
+
+/**
+ * Batched insert and removal benchmark.
+ * 'single' moves ITEMS items through the structure one call at a time and
+ * 'batch' does the same with the *Many methods in batches of BATCH items.
+ * Pooling is disabled so every insert reaches the allocator.
+ * Results are reported in nanoseconds per item, insert and removal together.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  ITEMS = 1000000,
+  BATCH = 1000
+};
+
+static int benchData = 17;
+static void* benchItems[BATCH];
+
+static double bench_queue(int batched) {
+  LDSC_queue* myQueue = LDSC_queue_init(NULL);
+  myQueue->setPoolCap(myQueue, 0, NULL);
+
+  double start = bench_now();
+  for (int done = 0; done < ITEMS; done += BATCH) {
+    if (batched) {
+      myQueue->enqueueMany(myQueue, benchItems, BATCH, NULL);
+      myQueue->dequeueMany(myQueue, benchItems, BATCH, NULL);
+    } else {
+      for (int i = 0; i < BATCH; i++)
+        myQueue->enqueue(myQueue, benchItems[i], NULL);
+      for (int i = 0; i < BATCH; i++)
+        benchItems[i] = myQueue->dequeue(myQueue, NULL);
+    }
+  }
+  double elapsed = bench_now() - start;
+
+  myQueue->delete(myQueue, NULL);
+  return elapsed / ITEMS;
+}
+
+static double bench_stack(LDSC_stack* myStack, int batched) {
+  myStack->setPoolCap(myStack, 0, NULL);
+
+  double start = bench_now();
+  for (int done = 0; done < ITEMS; done += BATCH) {
+    if (batched) {
+      myStack->pushMany(myStack, benchItems, BATCH, NULL);
+      myStack->popMany(myStack, benchItems, BATCH, NULL);
+    } else {
+      for (int i = 0; i < BATCH; i++)
+        myStack->push(myStack, benchItems[i], NULL);
+      for (int i = 0; i < BATCH; i++)
+        benchItems[i] = myStack->pop(myStack, NULL);
+    }
+  }
+  double elapsed = bench_now() - start;
+
+  myStack->delete(myStack, NULL);
+  return elapsed / ITEMS;
+}
+
+static double bench_list(int batched) {
+  LDSC_linkedList* myLL = LDSC_linkedList_init(NULL);
+  myLL->setPoolCap(myLL, 0, NULL);
+
+  double start = bench_now();
+  for (int done = 0; done < ITEMS; done += BATCH) {
+    if (batched) {
+      myLL->appendMany(myLL, benchItems, BATCH, NULL);
+      myLL->popMany(myLL, benchItems, BATCH, NULL);
+    } else {
+      for (int i = 0; i < BATCH; i++)
+        myLL->append(myLL, benchItems[i], NULL);
+      for (int i = 0; i < BATCH; i++)
+        benchItems[i] = myLL->pop(myLL, NULL);
+    }
+  }
+  double elapsed = bench_now() - start;
+
+  myLL->delete(myLL, NULL);
+  return elapsed / ITEMS;
+}
+
+/**************************************************/
+
+void LDSC_bulk_bench(void) {
+  for (int i = 0; i < BATCH; i++)
+    benchItems[i] = &benchData;
+
+  printf("%-16s %-12s %10s %10s\n", "structure", "mode", "batch", "ns/item");
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "single", BATCH, bench_queue(0));
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "batch", BATCH, bench_queue(1));
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_stack", "single", BATCH, bench_stack(LDSC_stack_init(NULL), 0));
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_stack", "batch", BATCH, bench_stack(LDSC_stack_init(NULL), 1));
+  printf("%-16s %-12s %10d %10.2f\n", "lock-free stack", "single", BATCH, bench_stack(LDSC_stack_init_lockfree(NULL, NULL), 0));
+  printf("%-16s %-12s %10d %10.2f\n", "lock-free stack", "batch", BATCH, bench_stack(LDSC_stack_init_lockfree(NULL, NULL), 1));
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "single", BATCH, bench_list(0));
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "batch", BATCH, bench_list(1));
+  printf("\n");
+}
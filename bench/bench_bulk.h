@@ -0,0 +1,6 @@
+#ifndef BENCH_BULK_H
+#define BENCH_BULK_H
+
+void LDSC_bulk_bench(void);
+
+#endif
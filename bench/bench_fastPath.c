@@ -0,0 +1,102 @@
+/* measure the fast path as release builds see it, without its debug asserts */
+#define NDEBUG
+
+#include <stdio.h>
+
+#include "LDSC_queueFast.h"
+#include "LDSC_stackFast.h"
+#include "bench_fastPath.h"
+#include "bench_timer.h"
+
+/**
+ * Checked indirect calls against the inline fast path.
+ * Each round inserts and removes BATCH items, so after the first round
+ * every node comes from the pool and no allocator call is timed.
+ * Results are reported in nanoseconds per insert/remove pair.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  PAIRS = 10000000,
+  BATCH = 32
+};
+
+static int benchData = 17;
+
+static double bench_queueIndirect(void) {
+  LDSC_queue* myQueue = LDSC_queue_init(NULL);
+  LDSC_error status = OK;
+
+  double start = bench_now();
+  for (int done = 0; done < PAIRS; done += BATCH) {
+    for (int i = 0; i < BATCH; i++)
+      myQueue->enqueue(myQueue, &benchData, &status);
+    for (int i = 0; i < BATCH; i++)
+      myQueue->dequeue(myQueue, &status);
+  }
+  double elapsed = bench_now() - start;
+
+  myQueue->delete(myQueue, NULL);
+  return elapsed / PAIRS;
+}
+
+static double bench_queueInline(void) {
+  LDSC_queue* myQueue = LDSC_queue_init(NULL);
+
+  double start = bench_now();
+  for (int done = 0; done < PAIRS; done += BATCH) {
+    for (int i = 0; i < BATCH; i++)
+      LDSC_queue_enqueue_fast(myQueue, &benchData);
+    for (int i = 0; i < BATCH; i++)
+      LDSC_queue_dequeue_fast(myQueue);
+  }
+  double elapsed = bench_now() - start;
+
+  myQueue->delete(myQueue, NULL);
+  return elapsed / PAIRS;
+}
+
+static double bench_stackIndirect(void) {
+  LDSC_stack* myStack = LDSC_stack_init(NULL);
+  LDSC_error status = OK;
+
+  double start = bench_now();
+  for (int done = 0; done < PAIRS; done += BATCH) {
+    for (int i = 0; i < BATCH; i++)
+      myStack->push(myStack, &benchData, &status);
+    for (int i = 0; i < BATCH; i++)
+      myStack->pop(myStack, &status);
+  }
+  double elapsed = bench_now() - start;
+
+  myStack->delete(myStack, NULL);
+  return elapsed / PAIRS;
+}
+
+static double bench_stackInline(void) {
+  LDSC_stack* myStack = LDSC_stack_init(NULL);
+
+  double start = bench_now();
+  for (int done = 0; done < PAIRS; done += BATCH) {
+    for (int i = 0; i < BATCH; i++)
+      LDSC_stack_push_fast(myStack, &benchData);
+    for (int i = 0; i < BATCH; i++)
+      LDSC_stack_pop_fast(myStack);
+  }
+  double elapsed = bench_now() - start;
+
+  myStack->delete(myStack, NULL);
+  return elapsed / PAIRS;
+}
+
+/**************************************************/
+
+void LDSC_fastPath_bench(void) {
+  printf("%-16s %-12s %10s %10s\n", "structure", "call", "pairs", "ns/pair");
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "indirect", PAIRS, bench_queueIndirect());
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "inline", PAIRS, bench_queueInline());
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_stack", "indirect", PAIRS, bench_stackIndirect());
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_stack", "inline", PAIRS, bench_stackInline());
+  printf("\n");
+}
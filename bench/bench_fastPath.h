@@ -0,0 +1,6 @@
+#ifndef BENCH_FASTPATH_H
+#define BENCH_FASTPATH_H
+
+void LDSC_fastPath_bench(void);
+
+#endif
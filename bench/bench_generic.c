@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_queue.h"
+#include "LDSC_generic.h"
+#include "bench_generic.h"
+#include "bench_timer.h"
+
+/**
+ * Queue of int values: boxed in a void* queue against a generated queue.
+ * The boxed queue pays a payload allocation per item on top of its node,
+ * the generated one copies the int into its ring buffer.
+ * Results are reported in nanoseconds per enqueue/dequeue pair.
+ */
+
+LDSC_DEFINE_QUEUE(benchIntQueue, int)
+
+/**************************************************/
+
+enum Bench_constants {
+  ITEMS = 1000000
+};
+
+static double bench_boxed(void) {
+  LDSC_queue* myQueue = LDSC_queue_init(NULL);
+  LDSC_error status = OK;
+  long sum = 0;
+
+  double start = bench_now();
+  for (int i = 0; i < ITEMS; i++) {
+    int* item = malloc(sizeof(int));
+    *item = i;
+    myQueue->enqueue(myQueue, item, &status);
+  }
+  for (int i = 0; i < ITEMS; i++) {
+    int* item = myQueue->dequeue(myQueue, &status);
+    sum += *item;
+    free(item);
+  }
+  double elapsed = bench_now() - start;
+
+  myQueue->delete(myQueue, NULL);
+  if (sum < 0) printf("unexpected sum\n");
+  return elapsed / ITEMS;
+}
+
+static double bench_generated(void) {
+  benchIntQueue* myQueue = benchIntQueue_init(NULL);
+  LDSC_error status = OK;
+  long sum = 0;
+
+  double start = bench_now();
+  for (int i = 0; i < ITEMS; i++)
+    myQueue->enqueue(myQueue, i, &status);
+  for (int i = 0; i < ITEMS; i++)
+    sum += myQueue->dequeue(myQueue, &status);
+  double elapsed = bench_now() - start;
+
+  myQueue->delete(myQueue, NULL);
+  if (sum < 0) printf("unexpected sum\n");
+  return elapsed / ITEMS;
+}
+
+/**************************************************/
+
+void LDSC_generic_bench(void) {
+  printf("%-16s %-12s %10s %10s\n", "structure", "storage", "items", "ns/pair");
+  printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "boxed int", ITEMS, bench_boxed());
+  printf("%-16s %-12s %10d %10.2f\n", "generated", "inline int", ITEMS, bench_generated());
+  printf("\n");
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_GENERIC_H
+#define BENCH_GENERIC_H
+
+void LDSC_generic_bench(void);
+
+#endif
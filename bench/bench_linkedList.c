@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_linkedList.h"
+#include "bench_linkedList.h"
+#include "bench_timer.h"
+
+/**
+ * Indexed access benchmark of LDSC_linkedList.
+ * 'sequential' reads at(0) .. at(n - 1), 'reverse' reads at(n - 1) .. at(0)
+ * and 'random' reads RANDOM_QUERIES uniformly chosen indices.
+ * 'cursor' walks the whole list with the cursor API for reference.
+ * Results are reported in nanoseconds per access.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  RANDOM_QUERIES = 10000
+};
+
+static int benchData = 17;
+
+static LDSC_linkedList* bench_filledList(int n) {
+  LDSC_linkedList* myLL = LDSC_linkedList_init(NULL);
+  for (int i = 0; i < n; i++)
+    myLL->append(myLL, &benchData, NULL);
+  return myLL;
+}
+
+static double bench_sequential(int n) {
+  LDSC_linkedList* myLL = bench_filledList(n);
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myLL->at(myLL, i, NULL);
+  double elapsed = bench_now() - start;
+  myLL->delete(myLL, NULL);
+  return elapsed / n;
+}
+
+static double bench_reverse(int n) {
+  LDSC_linkedList* myLL = bench_filledList(n);
+  double start = bench_now();
+  for (int i = n - 1; i >= 0; i--)
+    myLL->at(myLL, i, NULL);
+  double elapsed = bench_now() - start;
+  myLL->delete(myLL, NULL);
+  return elapsed / n;
+}
+
+static double bench_random(int n) {
+  LDSC_linkedList* myLL = bench_filledList(n);
+  int* indices = malloc(RANDOM_QUERIES * sizeof(int));
+  srand(17);
+  for (int i = 0; i < RANDOM_QUERIES; i++)
+    indices[i] = rand() % n;
+
+  double start = bench_now();
+  for (int i = 0; i < RANDOM_QUERIES; i++)
+    myLL->at(myLL, indices[i], NULL);
+  double elapsed = bench_now() - start;
+
+  free(indices);
+  myLL->delete(myLL, NULL);
+  return elapsed / RANDOM_QUERIES;
+}
+
+static double bench_cursor(int n) {
+  LDSC_linkedList* myLL = bench_filledList(n);
+  double start = bench_now();
+  LDSC_listCursor cursor = myLL->begin(myLL, NULL);
+  while (myLL->get(myLL, &cursor, NULL))
+    myLL->next(myLL, &cursor, NULL);
+  double elapsed = bench_now() - start;
+  myLL->delete(myLL, NULL);
+  return elapsed / n;
+}
+
+/**************************************************/
+
+void LDSC_linkedList_bench(void) {
+  const int sizes[] = {1000, 10000, 100000};
+
+  printf("%-16s %-12s %10s %10s\n", "structure", "access", "n", "ns/op");
+  for (int i = 0; i < 3; i++) {
+    int n = sizes[i];
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "sequential", n, bench_sequential(n));
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "reverse", n, bench_reverse(n));
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "random", n, bench_random(n));
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "cursor", n, bench_cursor(n));
+  }
+  printf("\n");
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_LINKEDLIST_H
+#define BENCH_LINKEDLIST_H
+
+void LDSC_linkedList_bench(void);
+
+#endif
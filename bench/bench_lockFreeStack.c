@@ -0,0 +1,79 @@
+#include <pthread.h>
+#include <stdio.h>
+
+#include "LDSC_stack.h"
+#include "bench_lockFreeStack.h"
+#include "bench_timer.h"
+
+/**
+ * Contention benchmark of the lock-free LDSC_stack against a plain
+ * LDSC_stack guarded by one mutex, the usual way to share it as a free list.
+ * Each of 1 to MAX_THREADS threads performs push/pop pairs on a stack
+ * prefilled with PREFILL items. Results are reported in ns per pair.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  MAX_THREADS = 4,
+  PREFILL = 64,
+  OPS_PER_THREAD = 1 << 19
+};
+
+typedef struct BenchShared {
+  LDSC_stack* stack;
+  pthread_mutex_t* lock;
+} BenchShared;
+
+static int benchData = 17;
+
+static void* bench_worker(void* arg) {
+  BenchShared* shared = (BenchShared*)arg;
+  LDSC_stack* stack = shared->stack;
+
+  for (int i = 0; i < OPS_PER_THREAD; i++) {
+    if (shared->lock) pthread_mutex_lock(shared->lock);
+    stack->push(stack, &benchData, NULL);
+    if (shared->lock) pthread_mutex_unlock(shared->lock);
+
+    if (shared->lock) pthread_mutex_lock(shared->lock);
+    stack->pop(stack, NULL);
+    if (shared->lock) pthread_mutex_unlock(shared->lock);
+  }
+  return NULL;
+}
+
+static double bench_pairs(LDSC_stack* stack, pthread_mutex_t* lock, int threads) {
+  BenchShared shared = { stack, lock };
+  pthread_t workers[MAX_THREADS];
+
+  for (int i = 0; i < PREFILL; i++)
+    stack->push(stack, &benchData, NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < threads; i++)
+    pthread_create(&workers[i], NULL, &bench_worker, &shared);
+  for (int i = 0; i < threads; i++)
+    pthread_join(workers[i], NULL);
+  double elapsed = bench_now() - start;
+
+  stack->delete(stack, NULL);
+  return elapsed / ((double)OPS_PER_THREAD * threads);
+}
+
+/**************************************************/
+
+void LDSC_lockFreeStack_bench(void) {
+  pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+  printf("%-20s %10s %12s\n", "structure", "threads", "ns/pair");
+  for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+    printf("%-20s %10d %12.1f\n", "LDSC_stack+mutex", threads,
+           bench_pairs(LDSC_stack_init(NULL), &lock, threads));
+    printf("%-20s %10d %12.1f\n", "LDSC_stack lockfree", threads,
+           bench_pairs(LDSC_stack_init_lockfree(NULL, NULL), NULL, threads));
+  }
+  printf("\n");
+
+  pthread_mutex_destroy(&lock);
+}
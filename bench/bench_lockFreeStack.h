@@ -0,0 +1,6 @@
+#ifndef BENCH_LOCKFREESTACK_H
+#define BENCH_LOCKFREESTACK_H
+
+void LDSC_lockFreeStack_bench(void);
+
+#endif
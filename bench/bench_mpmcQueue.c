@@ -0,0 +1,90 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "LDSC_mpmcQueue.h"
+#include "bench_mpmcQueue.h"
+#include "bench_timer.h"
+
+/**
+ * Multi-threaded throughput benchmark of LDSC_mpmcQueue.
+ * Every producer/consumer combination from 1 to MAX_THREADS transfers
+ * TRANSFER_COUNT items through a queue of QUEUE_CAPACITY slots.
+ * Results are reported in millions of transferred items per second.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  MAX_THREADS = 4,
+  QUEUE_CAPACITY = 1024,
+  TRANSFER_COUNT = 1 << 20
+};
+
+typedef struct BenchShared {
+  LDSC_mpmcQueue* queue;
+  int perProducer;
+  atomic_int consumed;
+} BenchShared;
+
+static int benchData = 17;
+
+static void* bench_producer(void* arg) {
+  BenchShared* shared = (BenchShared*)arg;
+  LDSC_error status = OK;
+
+  int i = 0;
+  while (i < shared->perProducer) {
+    shared->queue->tryEnqueue(shared->queue, &benchData, &status);
+    if (status == OK) i++;
+    else sched_yield();
+  }
+  return NULL;
+}
+
+static void* bench_consumer(void* arg) {
+  BenchShared* shared = (BenchShared*)arg;
+  LDSC_error status = OK;
+
+  while (atomic_load_explicit(&shared->consumed, memory_order_relaxed) < TRANSFER_COUNT) {
+    shared->queue->tryDequeue(shared->queue, &status);
+    if (status == OK)
+      atomic_fetch_add_explicit(&shared->consumed, 1, memory_order_relaxed);
+    else
+      sched_yield();
+  }
+  return NULL;
+}
+
+static double bench_transfer(int producers, int consumers) {
+  BenchShared shared;
+  pthread_t threads[2 * MAX_THREADS];
+
+  shared.queue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, NULL);
+  shared.perProducer = TRANSFER_COUNT / producers;
+  atomic_init(&shared.consumed, TRANSFER_COUNT - shared.perProducer * producers);
+
+  double start = bench_now();
+  for (int i = 0; i < producers; i++)
+    pthread_create(&threads[i], NULL, &bench_producer, &shared);
+  for (int i = 0; i < consumers; i++)
+    pthread_create(&threads[producers + i], NULL, &bench_consumer, &shared);
+  for (int i = 0; i < producers + consumers; i++)
+    pthread_join(threads[i], NULL);
+  double elapsed = bench_now() - start;
+
+  shared.queue->delete(shared.queue, NULL);
+  return (double)TRANSFER_COUNT / elapsed * 1e3;
+}
+
+/**************************************************/
+
+void LDSC_mpmcQueue_bench(void) {
+  printf("%-16s %10s %10s %10s\n", "structure", "producers", "consumers", "Mitems/s");
+  for (int producers = 1; producers <= MAX_THREADS; producers *= 2)
+    for (int consumers = 1; consumers <= MAX_THREADS; consumers *= 2)
+      printf("%-16s %10d %10d %10.2f\n", "LDSC_mpmcQueue", producers, consumers,
+             bench_transfer(producers, consumers));
+  printf("\n");
+}
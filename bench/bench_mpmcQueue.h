@@ -0,0 +1,6 @@
+#ifndef BENCH_MPMCQUEUE_H
+#define BENCH_MPMCQUEUE_H
+
+void LDSC_mpmcQueue_bench(void);
+
+#endif
@@ -0,0 +1,681 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+#include "LDSC_linkedList.h"
+#include "LDSC_queue.h"
+#include "LDSC_stack.h"
+#include "bench_ops.h"
+#include "bench_timer.h"
+#include "test_alloc.h"
+
+/**
+ * Per operation benchmark of LDSC_linkedList, LDSC_stack and LDSC_queue.
+ * Every operation runs on structures of 1e2 .. 1e7 items. Each case builds
+ * its structure untimed, times the operation and reports one CSV row:
+ * nanoseconds and allocator calls per operation, and the peak resident set
+ * size of the case in KiB.
+ * Linear time operations (indexed access, insertSorted, splice, ...) run
+ * QUERIES times per size. O(1) operations run once per item.
+ * setPoolCap only configures a structure and is not timed.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  MIN_SIZE = 100,
+  QUERIES = 100,
+  BATCH = 1000
+};
+
+/** state of one benchmark case */
+typedef struct Bench_case {
+  int size;
+  AllocCounter counter;
+  LDSC_allocator allocator;
+  double start;
+  long allocsStart;
+  double elapsed;
+  long allocs;
+  long ops;
+} Bench_case;
+
+typedef void (*Bench_op)(Bench_case* c);
+
+typedef struct Bench_entry {
+  const char* structure;
+  const char* op;
+  Bench_op run;
+} Bench_entry;
+
+static void* bench_items[BATCH];
+
+/** data pointer encoding the value i, never NULL */
+static void* Bench_item(long i) {
+  return (void*)(uintptr_t)(i + 1);
+}
+
+/** compare items by their encoded values */
+static int Bench_compare(const void* a, const void* b) {
+  uintptr_t x = (uintptr_t)a;
+  uintptr_t y = (uintptr_t)b;
+  return (x > y) - (x < y);
+}
+
+/** pseudo random index of the i-th access, a permutation of [0, length) */
+static int Bench_index(int i, int length) {
+  return (int)(((long long)i * 2654435761LL) % length);
+}
+
+/** number of linear time operations run per size */
+static int Bench_queries(Bench_case* c) {
+  return c->size < QUERIES ? c->size : QUERIES;
+}
+
+/** start the timed section */
+static void Case_start(Bench_case* c) {
+  c->allocsStart = c->counter.allocs;
+  c->start = bench_now();
+}
+
+/** end the timed section after ops operations */
+static void Case_stop(Bench_case* c, long ops) {
+  c->elapsed = bench_now() - c->start;
+  c->allocs = c->counter.allocs - c->allocsStart;
+  c->ops = ops;
+}
+
+/** reset the peak resident set size where the kernel allows it */
+static void Bench_resetPeakRss(void) {
+  FILE* file = fopen("/proc/self/clear_refs", "w");
+  if (!file) return;
+  fputs("5", file);
+  fclose(file);
+}
+
+/** peak resident set size in KiB, from VmHWM or else getrusage */
+static long Bench_peakRss(void) {
+  long kb = 0;
+  FILE* file = fopen("/proc/self/status", "r");
+  if (file) {
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+      if (sscanf(line, "VmHWM: %ld", &kb) == 1) {
+        fclose(file);
+        return kb;
+      }
+    }
+    fclose(file);
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+/**************************************************/
+/* LDSC_linkedList */
+
+static LDSC_linkedList* bench_list(Bench_case* c) {
+  return LDSC_linkedList_init_with(&c->allocator, NULL);
+}
+
+static LDSC_linkedList* bench_filledList(Bench_case* c, int n) {
+  LDSC_linkedList* myLL = bench_list(c);
+  for (int i = 0; i < n; i++)
+    myLL->append(myLL, Bench_item(i), NULL);
+  return myLL;
+}
+
+static void bench_listLength(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->length(myLL, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listEmpty(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->empty(myLL, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listAppend(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_list(c);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->append(myLL, Bench_item(i), NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listPrepend(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_list(c);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->prepend(myLL, Bench_item(i), NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listAdd(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  int queries = Bench_queries(c);
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    myLL->add(myLL, Bench_item(i), Bench_index(i, c->size), NULL);
+  Case_stop(c, queries);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listAt(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  int queries = Bench_queries(c);
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    myLL->at(myLL, Bench_index(i, c->size), NULL);
+  Case_stop(c, queries);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listReplace(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  int queries = Bench_queries(c);
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    myLL->replace(myLL, Bench_item(i), Bench_index(i, c->size), NULL);
+  Case_stop(c, queries);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listRemove(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  int queries = Bench_queries(c);
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    myLL->remove(myLL, Bench_index(i, c->size - i), NULL);
+  Case_stop(c, queries);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listPop(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->pop(myLL, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listPull(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->pull(myLL, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listClear(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  myLL->clear(myLL, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listReserve(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_list(c);
+  Case_start(c);
+  myLL->reserve(myLL, c->size, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listCursorNext(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  LDSC_listCursor cursor = myLL->begin(myLL, NULL);
+  do {
+    myLL->get(myLL, &cursor, NULL);
+  } while (myLL->next(myLL, &cursor, NULL));
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listCursorPrev(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  LDSC_listCursor cursor = myLL->end(myLL, NULL);
+  while (myLL->prev(myLL, &cursor, NULL))
+    myLL->get(myLL, &cursor, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listInsertAt(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  LDSC_listCursor cursor = myLL->begin(myLL, NULL);
+  for (int i = 0; i < c->size / 2; i++)
+    myLL->next(myLL, &cursor, NULL);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->insertAt(myLL, &cursor, Bench_item(i), NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listRemoveAt(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  LDSC_listCursor cursor = myLL->begin(myLL, NULL);
+  for (int i = 0; i < c->size; i++)
+    myLL->removeAt(myLL, &cursor, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listAppendMany(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_list(c);
+  for (int i = 0; i < BATCH; i++)
+    bench_items[i] = Bench_item(i);
+  Case_start(c);
+  for (int done = 0; done < c->size; done += BATCH) {
+    int count = c->size - done < BATCH ? c->size - done : BATCH;
+    myLL->appendMany(myLL, bench_items, count, NULL);
+  }
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listPopMany(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  while (myLL->popMany(myLL, bench_items, BATCH, NULL) > 0)
+    ;
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+/** fill others with QUERIES lists sharing the items of a size item list */
+static int bench_chunks(Bench_case* c, LDSC_linkedList** others) {
+  int queries = Bench_queries(c);
+  int chunk = c->size / queries;
+  for (int i = 0; i < queries; i++)
+    others[i] = bench_filledList(c, chunk);
+  return queries;
+}
+
+static void bench_listConcat(Bench_case* c) {
+  LDSC_linkedList* others[QUERIES];
+  LDSC_linkedList* myLL = bench_list(c);
+  int queries = bench_chunks(c, others);
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    myLL->concat(myLL, others[i], NULL);
+  Case_stop(c, queries);
+  for (int i = 0; i < queries; i++)
+    others[i]->delete(others[i], NULL);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listSplice(Bench_case* c) {
+  LDSC_linkedList* others[QUERIES];
+  LDSC_linkedList* myLL = bench_list(c);
+  int queries = bench_chunks(c, others);
+  Case_start(c);
+  for (int i = 0; i < queries; i++) {
+    int length = others[i]->length(others[i], NULL);
+    myLL->splice(myLL, myLL->length(myLL, NULL) / 2, others[i], 0, length, NULL);
+  }
+  Case_stop(c, queries);
+  for (int i = 0; i < queries; i++)
+    others[i]->delete(others[i], NULL);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listSpliceAt(Bench_case* c) {
+  LDSC_linkedList* others[QUERIES];
+  LDSC_linkedList* myLL = bench_list(c);
+  int queries = bench_chunks(c, others);
+  Case_start(c);
+  LDSC_listCursor cursor = myLL->end(myLL, NULL);
+  for (int i = 0; i < queries; i++)
+    myLL->spliceAt(myLL, &cursor, others[i], NULL);
+  Case_stop(c, queries);
+  for (int i = 0; i < queries; i++)
+    others[i]->delete(others[i], NULL);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listSplitAt(Bench_case* c) {
+  LDSC_linkedList* parts[QUERIES];
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  int queries = Bench_queries(c);
+  int chunk = c->size / queries;
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    parts[i] = myLL->splitAt(myLL, c->size - (i + 1) * chunk, NULL);
+  Case_stop(c, queries);
+  for (int i = 0; i < queries; i++)
+    parts[i]->delete(parts[i], NULL);
+  myLL->delete(myLL, NULL);
+}
+
+/** forEach callback summing the encoded values */
+static int bench_visit(void* dataPtr, void* ctx) {
+  *(uintptr_t*)ctx += (uintptr_t)dataPtr;
+  return 0;
+}
+
+static void bench_listForEach(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  uintptr_t sum = 0;
+  Case_start(c);
+  myLL->forEach(myLL, &bench_visit, &sum, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listSort(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_list(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->append(myLL, Bench_item(Bench_index(i, c->size)), NULL);
+  Case_start(c);
+  myLL->sort(myLL, &Bench_compare, NULL);
+  Case_stop(c, c->size);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listInsertSorted(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_list(c);
+  for (int i = 0; i < c->size; i++)
+    myLL->append(myLL, Bench_item(2L * i), NULL);
+  /* each insert walks half the list through cmp, so run fewer of them */
+  int queries = (Bench_queries(c) + 9) / 10;
+  Case_start(c);
+  for (int i = 0; i < queries; i++)
+    myLL->insertSorted(myLL, Bench_item(2L * Bench_index(i, c->size) + 1), &Bench_compare, NULL);
+  Case_stop(c, queries);
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_listDelete(Bench_case* c) {
+  LDSC_linkedList* myLL = bench_filledList(c, c->size);
+  Case_start(c);
+  myLL->delete(myLL, NULL);
+  Case_stop(c, c->size);
+}
+
+/**************************************************/
+/* LDSC_stack */
+
+static LDSC_stack* bench_filledStack(Bench_case* c, int n) {
+  LDSC_stack* myStack = LDSC_stack_init_with(&c->allocator, NULL);
+  for (int i = 0; i < n; i++)
+    myStack->push(myStack, Bench_item(i), NULL);
+  return myStack;
+}
+
+static void bench_stackSize(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myStack->size(myStack, NULL);
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackEmpty(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myStack->empty(myStack, NULL);
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackPush(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, 0);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myStack->push(myStack, Bench_item(i), NULL);
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackPeek(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myStack->peek(myStack, NULL);
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackPop(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myStack->pop(myStack, NULL);
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackPushMany(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, 0);
+  for (int i = 0; i < BATCH; i++)
+    bench_items[i] = Bench_item(i);
+  Case_start(c);
+  for (int done = 0; done < c->size; done += BATCH) {
+    int count = c->size - done < BATCH ? c->size - done : BATCH;
+    myStack->pushMany(myStack, bench_items, count, NULL);
+  }
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackPopMany(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, c->size);
+  Case_start(c);
+  while (myStack->popMany(myStack, bench_items, BATCH, NULL) > 0)
+    ;
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackReserve(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, 0);
+  Case_start(c);
+  myStack->reserve(myStack, c->size, NULL);
+  Case_stop(c, c->size);
+  myStack->delete(myStack, NULL);
+}
+
+static void bench_stackDelete(Bench_case* c) {
+  LDSC_stack* myStack = bench_filledStack(c, c->size);
+  Case_start(c);
+  myStack->delete(myStack, NULL);
+  Case_stop(c, c->size);
+}
+
+/**************************************************/
+/* LDSC_queue */
+
+static LDSC_queue* bench_filledQueue(Bench_case* c, int n) {
+  LDSC_queue* myQueue = LDSC_queue_init_with(&c->allocator, NULL);
+  for (int i = 0; i < n; i++)
+    myQueue->enqueue(myQueue, Bench_item(i), NULL);
+  return myQueue;
+}
+
+static void bench_queueLength(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myQueue->length(myQueue, NULL);
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueEmpty(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myQueue->empty(myQueue, NULL);
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueEnqueue(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, 0);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myQueue->enqueue(myQueue, Bench_item(i), NULL);
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queuePeek(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myQueue->peek(myQueue, NULL);
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueDequeue(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, c->size);
+  Case_start(c);
+  for (int i = 0; i < c->size; i++)
+    myQueue->dequeue(myQueue, NULL);
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueEnqueueMany(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, 0);
+  for (int i = 0; i < BATCH; i++)
+    bench_items[i] = Bench_item(i);
+  Case_start(c);
+  for (int done = 0; done < c->size; done += BATCH) {
+    int count = c->size - done < BATCH ? c->size - done : BATCH;
+    myQueue->enqueueMany(myQueue, bench_items, count, NULL);
+  }
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueDequeueMany(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, c->size);
+  Case_start(c);
+  while (myQueue->dequeueMany(myQueue, bench_items, BATCH, NULL) > 0)
+    ;
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueReserve(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, 0);
+  Case_start(c);
+  myQueue->reserve(myQueue, c->size, NULL);
+  Case_stop(c, c->size);
+  myQueue->delete(myQueue, NULL);
+}
+
+static void bench_queueDelete(Bench_case* c) {
+  LDSC_queue* myQueue = bench_filledQueue(c, c->size);
+  Case_start(c);
+  myQueue->delete(myQueue, NULL);
+  Case_stop(c, c->size);
+}
+
+/**************************************************/
+
+static const Bench_entry bench_entries[] = {
+  { "LDSC_linkedList", "length", &bench_listLength },
+  { "LDSC_linkedList", "empty", &bench_listEmpty },
+  { "LDSC_linkedList", "append", &bench_listAppend },
+  { "LDSC_linkedList", "prepend", &bench_listPrepend },
+  { "LDSC_linkedList", "add", &bench_listAdd },
+  { "LDSC_linkedList", "at", &bench_listAt },
+  { "LDSC_linkedList", "replace", &bench_listReplace },
+  { "LDSC_linkedList", "remove", &bench_listRemove },
+  { "LDSC_linkedList", "pop", &bench_listPop },
+  { "LDSC_linkedList", "pull", &bench_listPull },
+  { "LDSC_linkedList", "clear", &bench_listClear },
+  { "LDSC_linkedList", "reserve", &bench_listReserve },
+  { "LDSC_linkedList", "cursor_next", &bench_listCursorNext },
+  { "LDSC_linkedList", "cursor_prev", &bench_listCursorPrev },
+  { "LDSC_linkedList", "insertAt", &bench_listInsertAt },
+  { "LDSC_linkedList", "removeAt", &bench_listRemoveAt },
+  { "LDSC_linkedList", "appendMany", &bench_listAppendMany },
+  { "LDSC_linkedList", "popMany", &bench_listPopMany },
+  { "LDSC_linkedList", "concat", &bench_listConcat },
+  { "LDSC_linkedList", "splice", &bench_listSplice },
+  { "LDSC_linkedList", "spliceAt", &bench_listSpliceAt },
+  { "LDSC_linkedList", "splitAt", &bench_listSplitAt },
+  { "LDSC_linkedList", "forEach", &bench_listForEach },
+  { "LDSC_linkedList", "sort", &bench_listSort },
+  { "LDSC_linkedList", "insertSorted", &bench_listInsertSorted },
+  { "LDSC_linkedList", "delete", &bench_listDelete },
+  { "LDSC_stack", "size", &bench_stackSize },
+  { "LDSC_stack", "empty", &bench_stackEmpty },
+  { "LDSC_stack", "push", &bench_stackPush },
+  { "LDSC_stack", "peek", &bench_stackPeek },
+  { "LDSC_stack", "pop", &bench_stackPop },
+  { "LDSC_stack", "pushMany", &bench_stackPushMany },
+  { "LDSC_stack", "popMany", &bench_stackPopMany },
+  { "LDSC_stack", "reserve", &bench_stackReserve },
+  { "LDSC_stack", "delete", &bench_stackDelete },
+  { "LDSC_queue", "length", &bench_queueLength },
+  { "LDSC_queue", "empty", &bench_queueEmpty },
+  { "LDSC_queue", "enqueue", &bench_queueEnqueue },
+  { "LDSC_queue", "peek", &bench_queuePeek },
+  { "LDSC_queue", "dequeue", &bench_queueDequeue },
+  { "LDSC_queue", "enqueueMany", &bench_queueEnqueueMany },
+  { "LDSC_queue", "dequeueMany", &bench_queueDequeueMany },
+  { "LDSC_queue", "reserve", &bench_queueReserve },
+  { "LDSC_queue", "delete", &bench_queueDelete },
+};
+
+void LDSC_ops_bench(const char* path, int maxSize) {
+  FILE* out = stdout;
+  if (path && path[0] != '-') {
+    out = fopen(path, "w");
+    if (!out) {
+      printf("cannot open %s\n\n", path);
+      return;
+    }
+  }
+
+  int rows = 0;
+  fprintf(out, "structure,op,size,ops,ns_per_op,allocs_per_op,peak_rss_kb\n");
+  for (int size = MIN_SIZE; size > 0 && size <= maxSize; size = size <= maxSize / 10 ? size * 10 : 0) {
+    for (size_t e = 0; e < sizeof(bench_entries) / sizeof(bench_entries[0]); e++) {
+      Bench_case c = { .size = size };
+      c.allocator = (LDSC_allocator){ &counting_alloc, &counting_free, &c.counter };
+
+      Bench_resetPeakRss();
+      bench_entries[e].run(&c);
+      long peakRss = Bench_peakRss();
+
+      fprintf(out, "%s,%s,%d,%ld,%.2f,%.4f,%ld\n", bench_entries[e].structure, bench_entries[e].op,
+              size, c.ops, c.elapsed / c.ops, (double)c.allocs / c.ops, peakRss);
+      fflush(out);
+      rows++;
+    }
+  }
+
+  if (out != stdout) {
+    fclose(out);
+    printf("%-16s %d rows written to %s\n\n", "LDSC_ops", rows, path);
+  }
+}
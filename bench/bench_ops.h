@@ -0,0 +1,11 @@
+#ifndef BENCH_OPS_H
+#define BENCH_OPS_H
+
+/**
+ * @brief Write the per operation CSV to path, or stdout for "-".
+ * @param path Output file path.
+ * @param maxSize Largest structure size benchmarked.
+ */
+void LDSC_ops_bench(const char* path, int maxSize);
+
+#endif
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_linkedList.h"
+#include "LDSC_priorityQueue.h"
+#include "bench_priorityQueue.h"
+#include "bench_timer.h"
+
+/**
+ * Priority queue benchmark of LDSC_priorityQueue at several arities against
+ * an LDSC_linkedList kept sorted with insertSorted. n random keys are
+ * pushed and then all popped; heapify builds the same heap in one call.
+ * Results are reported in nanoseconds per item.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  LIST_MAX_SIZE = 10000
+};
+
+static int int_cmp(const void* a, const void* b) {
+  int x = *(const int*)a;
+  int y = *(const int*)b;
+  return (x > y) - (x < y);
+}
+
+static void bench_linkedList(int n, int* keys, double* results) {
+  LDSC_linkedList* myLL = LDSC_linkedList_init(NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myLL->insertSorted(myLL, &keys[i], &int_cmp, NULL);
+  results[0] = (bench_now() - start) / n;
+
+  start = bench_now();
+  for (int i = 0; i < n; i++)
+    myLL->pop(myLL, NULL);
+  results[1] = (bench_now() - start) / n;
+  results[2] = 0;
+
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_priorityQueue(int n, int arity, int* keys, void** items, double* results) {
+  LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init_with(NULL, arity, &int_cmp, NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myPQ->push(myPQ, &keys[i], NULL);
+  results[0] = (bench_now() - start) / n;
+
+  start = bench_now();
+  for (int i = 0; i < n; i++)
+    myPQ->pop(myPQ, NULL);
+  results[1] = (bench_now() - start) / n;
+
+  start = bench_now();
+  myPQ->heapify(myPQ, items, n, NULL, NULL);
+  results[2] = (bench_now() - start) / n;
+
+  myPQ->delete(myPQ, NULL);
+}
+
+/**************************************************/
+
+void LDSC_priorityQueue_bench(void) {
+  const int sizes[] = {1000, 10000, 1000000};
+  const int arities[] = {2, 4, 8};
+  double results[3];
+  char name[32];
+
+  printf("%-16s %10s %10s %10s %10s\n", "structure", "n", "push", "pop", "heapify");
+  for (int s = 0; s < 3; s++) {
+    int n = sizes[s];
+    int* keys = malloc((size_t)n * sizeof(int));
+    void** items = malloc((size_t)n * sizeof(void*));
+    srand(17);
+    for (int i = 0; i < n; i++) {
+      keys[i] = rand();
+      items[i] = &keys[i];
+    }
+
+    if (n <= LIST_MAX_SIZE) {
+      bench_linkedList(n, keys, results);
+      printf("%-16s %10d %10.2f %10.2f %10s\n", "LDSC_linkedList", n, results[0], results[1], "-");
+    }
+    for (int a = 0; a < 3; a++) {
+      bench_priorityQueue(n, arities[a], keys, items, results);
+      snprintf(name, sizeof(name), "pq arity %d", arities[a]);
+      printf("%-16s %10d %10.2f %10.2f %10.2f\n", name, n, results[0], results[1], results[2]);
+    }
+
+    free(keys);
+    free(items);
+  }
+  printf("\n");
+}
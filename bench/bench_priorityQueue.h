@@ -0,0 +1,6 @@
+#ifndef BENCH_PRIORITYQUEUE_H
+#define BENCH_PRIORITYQUEUE_H
+
+void LDSC_priorityQueue_bench(void);
+
+#endif
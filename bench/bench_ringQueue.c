@@ -0,0 +1,89 @@
+#include <stdio.h>
+
+#include "LDSC_queue.h"
+#include "LDSC_ringQueue.h"
+#include "bench_ringQueue.h"
+#include "bench_timer.h"
+
+/**
+ * Benchmark of LDSC_ringQueue against the linked LDSC_queue.
+ * 'fill/drain' enqueues n items and then dequeues all of them.
+ * 'steady' keeps a small backlog and performs n enqueue/dequeue pairs.
+ * Results are reported in nanoseconds per operation.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  STEADY_BACKLOG = 64
+};
+
+static int benchData = 17;
+
+static double bench_queue_fillDrain(int n) {
+  LDSC_queue* myQueue = LDSC_queue_init(NULL);
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myQueue->enqueue(myQueue, &benchData, NULL);
+  for (int i = 0; i < n; i++)
+    myQueue->dequeue(myQueue, NULL);
+  double elapsed = bench_now() - start;
+  myQueue->delete(myQueue, NULL);
+  return elapsed / (2.0 * n);
+}
+
+static double bench_ringQueue_fillDrain(int n) {
+  LDSC_ringQueue* myQueue = LDSC_ringQueue_init(NULL);
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myQueue->enqueue(myQueue, &benchData, NULL);
+  for (int i = 0; i < n; i++)
+    myQueue->dequeue(myQueue, NULL);
+  double elapsed = bench_now() - start;
+  myQueue->delete(myQueue, NULL);
+  return elapsed / (2.0 * n);
+}
+
+static double bench_queue_steady(int n) {
+  LDSC_queue* myQueue = LDSC_queue_init(NULL);
+  for (int i = 0; i < STEADY_BACKLOG; i++)
+    myQueue->enqueue(myQueue, &benchData, NULL);
+  double start = bench_now();
+  for (int i = 0; i < n; i++) {
+    myQueue->enqueue(myQueue, &benchData, NULL);
+    myQueue->dequeue(myQueue, NULL);
+  }
+  double elapsed = bench_now() - start;
+  myQueue->delete(myQueue, NULL);
+  return elapsed / (2.0 * n);
+}
+
+static double bench_ringQueue_steady(int n) {
+  LDSC_ringQueue* myQueue = LDSC_ringQueue_init(NULL);
+  for (int i = 0; i < STEADY_BACKLOG; i++)
+    myQueue->enqueue(myQueue, &benchData, NULL);
+  double start = bench_now();
+  for (int i = 0; i < n; i++) {
+    myQueue->enqueue(myQueue, &benchData, NULL);
+    myQueue->dequeue(myQueue, NULL);
+  }
+  double elapsed = bench_now() - start;
+  myQueue->delete(myQueue, NULL);
+  return elapsed / (2.0 * n);
+}
+
+/**************************************************/
+
+void LDSC_ringQueue_bench(void) {
+  const int sizes[] = {1000, 100000, 1000000};
+
+  printf("%-16s %-12s %10s %10s\n", "structure", "workload", "n", "ns/op");
+  for (int i = 0; i < 3; i++) {
+    int n = sizes[i];
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "fill/drain", n, bench_queue_fillDrain(n));
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_ringQueue", "fill/drain", n, bench_ringQueue_fillDrain(n));
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_queue", "steady", n, bench_queue_steady(n));
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_ringQueue", "steady", n, bench_ringQueue_steady(n));
+  }
+  printf("\n");
+}
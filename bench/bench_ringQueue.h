@@ -0,0 +1,6 @@
+#ifndef BENCH_RINGQUEUE_H
+#define BENCH_RINGQUEUE_H
+
+void LDSC_ringQueue_bench(void);
+
+#endif
@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_linkedList.h"
+#include "LDSC_skipList.h"
+#include "bench_skipList.h"
+#include "bench_timer.h"
+
+/**
+ * Positional access benchmark of LDSC_skipList against LDSC_linkedList.
+ * A list of n items receives RANDOM_OPS random-index at, add and remove
+ * calls each, plus n appends to build it. Results are reported in
+ * nanoseconds per operation.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  RANDOM_OPS = 10000
+};
+
+static int benchData = 17;
+
+static void bench_linkedList(int n, double* results) {
+  LDSC_linkedList* myLL = LDSC_linkedList_init(NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myLL->append(myLL, &benchData, NULL);
+  results[0] = (bench_now() - start) / n;
+
+  srand(17);
+  start = bench_now();
+  for (int i = 0; i < RANDOM_OPS; i++)
+    myLL->at(myLL, rand() % n, NULL);
+  results[1] = (bench_now() - start) / RANDOM_OPS;
+
+  start = bench_now();
+  for (int i = 0; i < RANDOM_OPS; i++) {
+    myLL->add(myLL, &benchData, rand() % n, NULL);
+    myLL->remove(myLL, rand() % n, NULL);
+  }
+  results[2] = (bench_now() - start) / (2.0 * RANDOM_OPS);
+
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_skipList(int n, double* results) {
+  LDSC_skipList* myList = LDSC_skipList_init(NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myList->append(myList, &benchData, NULL);
+  results[0] = (bench_now() - start) / n;
+
+  srand(17);
+  start = bench_now();
+  for (int i = 0; i < RANDOM_OPS; i++)
+    myList->at(myList, rand() % n, NULL);
+  results[1] = (bench_now() - start) / RANDOM_OPS;
+
+  start = bench_now();
+  for (int i = 0; i < RANDOM_OPS; i++) {
+    myList->add(myList, &benchData, rand() % n, NULL);
+    myList->remove(myList, rand() % n, NULL);
+  }
+  results[2] = (bench_now() - start) / (2.0 * RANDOM_OPS);
+
+  myList->delete(myList, NULL);
+}
+
+/**************************************************/
+
+void LDSC_skipList_bench(void) {
+  const int sizes[] = {1000, 10000, 100000};
+  double results[3];
+
+  printf("%-16s %10s %10s %12s %14s\n", "structure", "n", "append", "random at", "add/remove");
+  for (int i = 0; i < 3; i++) {
+    int n = sizes[i];
+    bench_linkedList(n, results);
+    printf("%-16s %10d %10.2f %12.2f %14.2f\n", "LDSC_linkedList", n, results[0], results[1], results[2]);
+    bench_skipList(n, results);
+    printf("%-16s %10d %10.2f %12.2f %14.2f\n", "LDSC_skipList", n, results[0], results[1], results[2]);
+  }
+  printf("\n");
+}
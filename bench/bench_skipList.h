@@ -0,0 +1,6 @@
+#ifndef BENCH_SKIPLIST_H
+#define BENCH_SKIPLIST_H
+
+void LDSC_skipList_bench(void);
+
+#endif
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_linkedList.h"
+#include "bench_sort.h"
+#include "bench_timer.h"
+
+/**
+ * Sorting benchmark of LDSC_linkedList.
+ * 'list sort' merge sorts a list of n random items in place and 'qsort'
+ * sorts an array of the same data pointers with the same comparator.
+ * 'insertSorted' builds a sorted list one item at a time; its walk makes it
+ * O(n^2), so it only runs for the smaller sizes.
+ * Results are reported in nanoseconds per item.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  INSERT_SORTED_MAX = 10000
+};
+
+static int compareInts(const void* a, const void* b) {
+  return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+}
+
+/* qsort hands out pointers to the array slots, which hold the data pointers */
+static int compareSlots(const void* a, const void* b) {
+  return compareInts(*(void* const*)a, *(void* const*)b);
+}
+
+static int* bench_randomData(int n) {
+  int* data = malloc((size_t)n * sizeof(int));
+  srand(17);
+  for (int i = 0; i < n; i++)
+    data[i] = rand();
+  return data;
+}
+
+static double bench_listSort(int* data, int n) {
+  LDSC_linkedList* myLL = LDSC_linkedList_init(NULL);
+  for (int i = 0; i < n; i++)
+    myLL->append(myLL, &data[i], NULL);
+
+  double start = bench_now();
+  myLL->sort(myLL, &compareInts, NULL);
+  double elapsed = bench_now() - start;
+
+  myLL->delete(myLL, NULL);
+  return elapsed / n;
+}
+
+static double bench_qsort(int* data, int n) {
+  void** slots = malloc((size_t)n * sizeof(void*));
+  for (int i = 0; i < n; i++)
+    slots[i] = &data[i];
+
+  double start = bench_now();
+  qsort(slots, n, sizeof(void*), &compareSlots);
+  double elapsed = bench_now() - start;
+
+  free(slots);
+  return elapsed / n;
+}
+
+static double bench_insertSorted(int* data, int n) {
+  LDSC_linkedList* myLL = LDSC_linkedList_init(NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < n; i++)
+    myLL->insertSorted(myLL, &data[i], &compareInts, NULL);
+  double elapsed = bench_now() - start;
+
+  myLL->delete(myLL, NULL);
+  return elapsed / n;
+}
+
+/**************************************************/
+
+void LDSC_sort_bench(void) {
+  const int sizes[] = {1000, 10000, 100000, 1000000, 10000000};
+
+  printf("%-16s %-12s %10s %10s\n", "structure", "sort", "n", "ns/item");
+  for (int i = 0; i < 5; i++) {
+    int n = sizes[i];
+    int* data = bench_randomData(n);
+    printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "list sort", n, bench_listSort(data, n));
+    printf("%-16s %-12s %10d %10.2f\n", "array", "qsort", n, bench_qsort(data, n));
+    if (n <= INSERT_SORTED_MAX)
+      printf("%-16s %-12s %10d %10.2f\n", "LDSC_linkedList", "insertSorted", n, bench_insertSorted(data, n));
+    free(data);
+  }
+  printf("\n");
+}
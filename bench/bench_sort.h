@@ -0,0 +1,6 @@
+#ifndef BENCH_SORT_H
+#define BENCH_SORT_H
+
+void LDSC_sort_bench(void);
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef BENCH_TIMER_H
+#define BENCH_TIMER_H
+
+#include <time.h>
+
+/** monotonic clock reading in nanoseconds */
+static inline double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+#endif
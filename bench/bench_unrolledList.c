@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "LDSC_linkedList.h"
+#include "LDSC_unrolledList.h"
+#include "bench_unrolledList.h"
+#include "bench_timer.h"
+
+/**
+ * Benchmark of LDSC_unrolledList against LDSC_linkedList.
+ * 'scan' visits every item with forEach, 'random at' reads RANDOM_QUERIES
+ * uniformly chosen indices and 'mid add' inserts MID_INSERTS items at the
+ * middle. 'bytes/item' is the heap footprint of a list of n items as seen
+ * by a counting allocator. Times are reported in nanoseconds per item.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  RANDOM_QUERIES = 10000,
+  MID_INSERTS = 1000
+};
+
+static int benchData = 17;
+
+/* counting allocator measuring live bytes */
+static void* bench_alloc(size_t size, void* context) {
+  *(long*)context += (long)size;
+  return malloc(size);
+}
+
+static void bench_free(void* ptr, size_t size, void* context) {
+  *(long*)context -= (long)size;
+  free(ptr);
+}
+
+/* forEach callback touching each item */
+static int bench_visit(void* dataPtr, void* ctx) {
+  *(long*)ctx += *(int*)dataPtr;
+  return 0;
+}
+
+static void bench_linkedList(int n, double* results) {
+  long bytes = 0;
+  LDSC_allocator allocator = { &bench_alloc, &bench_free, &bytes };
+  LDSC_linkedList* myLL = LDSC_linkedList_init_with(&allocator, NULL);
+  for (int i = 0; i < n; i++)
+    myLL->append(myLL, &benchData, NULL);
+  results[3] = (double)bytes / n;
+
+  long sum = 0;
+  double start = bench_now();
+  myLL->forEach(myLL, &bench_visit, &sum, NULL);
+  results[0] = (bench_now() - start) / n;
+
+  srand(17);
+  start = bench_now();
+  for (int i = 0; i < RANDOM_QUERIES; i++)
+    myLL->at(myLL, rand() % n, NULL);
+  results[1] = (bench_now() - start) / RANDOM_QUERIES;
+
+  start = bench_now();
+  for (int i = 0; i < MID_INSERTS; i++)
+    myLL->add(myLL, &benchData, myLL->length(myLL, NULL) / 2, NULL);
+  results[2] = (bench_now() - start) / MID_INSERTS;
+
+  myLL->delete(myLL, NULL);
+}
+
+static void bench_unrolledList(int n, double* results) {
+  long bytes = 0;
+  LDSC_allocator allocator = { &bench_alloc, &bench_free, &bytes };
+  LDSC_unrolledList* myList = LDSC_unrolledList_init_with(&allocator, 0, NULL);
+  for (int i = 0; i < n; i++)
+    myList->append(myList, &benchData, NULL);
+  results[3] = (double)bytes / n;
+
+  long sum = 0;
+  double start = bench_now();
+  myList->forEach(myList, &bench_visit, &sum, NULL);
+  results[0] = (bench_now() - start) / n;
+
+  srand(17);
+  start = bench_now();
+  for (int i = 0; i < RANDOM_QUERIES; i++)
+    myList->at(myList, rand() % n, NULL);
+  results[1] = (bench_now() - start) / RANDOM_QUERIES;
+
+  start = bench_now();
+  for (int i = 0; i < MID_INSERTS; i++)
+    myList->add(myList, &benchData, myList->length(myList, NULL) / 2, NULL);
+  results[2] = (bench_now() - start) / MID_INSERTS;
+
+  myList->delete(myList, NULL);
+}
+
+/**************************************************/
+
+void LDSC_unrolledList_bench(void) {
+  const int sizes[] = {1000, 100000, 1000000};
+  double results[4];
+
+  printf("%-18s %10s %10s %12s %10s %11s\n", "structure", "n", "scan", "random at", "mid add", "bytes/item");
+  for (int i = 0; i < 3; i++) {
+    int n = sizes[i];
+    bench_linkedList(n, results);
+    printf("%-18s %10d %10.2f %12.2f %10.2f %11.2f\n", "LDSC_linkedList", n,
+           results[0], results[1], results[2], results[3]);
+    bench_unrolledList(n, results);
+    printf("%-18s %10d %10.2f %12.2f %10.2f %11.2f\n", "LDSC_unrolledList", n,
+           results[0], results[1], results[2], results[3]);
+  }
+  printf("\n");
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_UNROLLEDLIST_H
+#define BENCH_UNROLLEDLIST_H
+
+void LDSC_unrolledList_bench(void);
+
+#endif
@@ -0,0 +1,151 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "LDSC_stack.h"
+#include "LDSC_workDeque.h"
+#include "bench_workDeque.h"
+#include "bench_timer.h"
+
+/**
+ * Recursive fork-join benchmark of LDSC_workDeque.
+ * A task of depth d forks two tasks of depth d - 1 until depth 0, giving a
+ * binary task tree of TREE_DEPTH levels. Each worker owns a deque, pushes
+ * one child and continues with the other, and steals when it runs dry.
+ * The baseline shares one mutex-guarded LDSC_stack between all workers.
+ * Results are reported in millions of tasks per second.
+ */
+
+/**************************************************/
+
+enum Bench_constants {
+  MAX_THREADS = 4,
+  TREE_DEPTH = 20
+};
+
+typedef struct BenchShared {
+  LDSC_workDeque* deques[MAX_THREADS];
+  LDSC_stack* stack;
+  pthread_mutex_t lock;
+  int workers;
+  atomic_long leaves;
+} BenchShared;
+
+typedef struct BenchWorker {
+  BenchShared* shared;
+  int id;
+} BenchWorker;
+
+/** task handles: a task of depth d is &benchDepths[d] */
+static int benchDepths[TREE_DEPTH + 1];
+
+static const long benchLeaves = 1L << TREE_DEPTH;
+
+/** run a task down to its leaf, forking every right child through fork */
+static void bench_run(int* task, void (*fork)(BenchWorker*, int*), BenchWorker* worker) {
+  while (*task > 0) {
+    fork(worker, &benchDepths[*task - 1]);
+    task = &benchDepths[*task - 1];
+  }
+  atomic_fetch_add_explicit(&worker->shared->leaves, 1, memory_order_relaxed);
+}
+
+static void bench_forkDeque(BenchWorker* worker, int* task) {
+  LDSC_workDeque* deque = worker->shared->deques[worker->id];
+  deque->push(deque, task, NULL);
+}
+
+static void* bench_dequeWorker(void* arg) {
+  BenchWorker* worker = (BenchWorker*)arg;
+  BenchShared* shared = worker->shared;
+  LDSC_workDeque* own = shared->deques[worker->id];
+  unsigned victim = (unsigned)worker->id;
+
+  while (atomic_load_explicit(&shared->leaves, memory_order_relaxed) < benchLeaves) {
+    int* task = own->pop(own, NULL);
+    for (int tries = 0; !task && tries < shared->workers; tries++) {
+      victim = (victim + 1) % (unsigned)shared->workers;
+      if ((int)victim != worker->id)
+        task = shared->deques[victim]->steal(shared->deques[victim], NULL);
+    }
+
+    if (task)
+      bench_run(task, &bench_forkDeque, worker);
+    else
+      sched_yield();
+  }
+  return NULL;
+}
+
+static void bench_forkStack(BenchWorker* worker, int* task) {
+  pthread_mutex_lock(&worker->shared->lock);
+  worker->shared->stack->push(worker->shared->stack, task, NULL);
+  pthread_mutex_unlock(&worker->shared->lock);
+}
+
+static void* bench_stackWorker(void* arg) {
+  BenchWorker* worker = (BenchWorker*)arg;
+  BenchShared* shared = worker->shared;
+
+  while (atomic_load_explicit(&shared->leaves, memory_order_relaxed) < benchLeaves) {
+    pthread_mutex_lock(&shared->lock);
+    int* task = shared->stack->pop(shared->stack, NULL);
+    pthread_mutex_unlock(&shared->lock);
+
+    if (task)
+      bench_run(task, &bench_forkStack, worker);
+    else
+      sched_yield();
+  }
+  return NULL;
+}
+
+static double bench_forkJoin(int workers, int useDeques) {
+  BenchShared shared;
+  BenchWorker args[MAX_THREADS];
+  pthread_t threads[MAX_THREADS];
+
+  shared.workers = workers;
+  atomic_init(&shared.leaves, 0);
+  pthread_mutex_init(&shared.lock, NULL);
+  shared.stack = LDSC_stack_init(NULL);
+  for (int i = 0; i < workers; i++)
+    shared.deques[i] = LDSC_workDeque_init(NULL);
+
+  if (useDeques)
+    shared.deques[0]->push(shared.deques[0], &benchDepths[TREE_DEPTH], NULL);
+  else
+    shared.stack->push(shared.stack, &benchDepths[TREE_DEPTH], NULL);
+
+  double start = bench_now();
+  for (int i = 0; i < workers; i++) {
+    args[i].shared = &shared;
+    args[i].id = i;
+    pthread_create(&threads[i], NULL, useDeques ? &bench_dequeWorker : &bench_stackWorker, &args[i]);
+  }
+  for (int i = 0; i < workers; i++)
+    pthread_join(threads[i], NULL);
+  double elapsed = bench_now() - start;
+
+  for (int i = 0; i < workers; i++)
+    shared.deques[i]->delete(shared.deques[i], NULL);
+  shared.stack->delete(shared.stack, NULL);
+  pthread_mutex_destroy(&shared.lock);
+
+  return (double)(2 * benchLeaves - 1) / elapsed * 1e3;
+}
+
+/**************************************************/
+
+void LDSC_workDeque_bench(void) {
+  for (int d = 0; d <= TREE_DEPTH; d++)
+    benchDepths[d] = d;
+
+  printf("%-20s %10s %10s\n", "structure", "workers", "Mtasks/s");
+  for (int workers = 1; workers <= MAX_THREADS; workers *= 2) {
+    printf("%-20s %10d %10.2f\n", "LDSC_stack+mutex", workers, bench_forkJoin(workers, 0));
+    printf("%-20s %10d %10.2f\n", "LDSC_workDeque", workers, bench_forkJoin(workers, 1));
+  }
+  printf("\n");
+}
@@ -0,0 +1,6 @@
+#ifndef BENCH_WORKDEQUE_H
+#define BENCH_WORKDEQUE_H
+
+void LDSC_workDeque_bench(void);
+
+#endif
@@ -1,8 +1,25 @@
 #ifndef LDSC_H
 #define LDSC_H
 
+#include <LDSC_allocator.h>
+#include <LDSC_histogram.h>
 #include <LDSC_linkedList.h>
+#include <LDSC_linkedListRef.h>
 #include <LDSC_stack.h>
+#include <LDSC_stackFast.h>
+#include <LDSC_stackRef.h>
+#include <LDSC_vecStack.h>
 #include <LDSC_queue.h>
+#include <LDSC_queueFast.h>
+#include <LDSC_queueRef.h>
+#include <LDSC_ringQueue.h>
+#include <LDSC_spscQueue.h>
+#include <LDSC_mpmcQueue.h>
+#include <LDSC_blockingQueue.h>
+#include <LDSC_workDeque.h>
+#include <LDSC_unrolledList.h>
+#include <LDSC_skipList.h>
+#include <LDSC_priorityQueue.h>
+#include <LDSC_generic.h>
 
 #endif 
@@ -0,0 +1,47 @@
+#ifndef LDSC_ALLOCATOR_H
+#define LDSC_ALLOCATOR_H
+
+#include <stddef.h>
+
+/**
+ * @brief Default maximum number of recycled nodes kept by a container.
+ */
+#define LDSC_NODE_POOL_DEFAULT_CAP 64
+
+typedef struct LDSC_allocator LDSC_allocator;
+
+/**
+ * The following structure describes a user supplied memory allocator.
+ * Structures created with an allocator use it for the structure itself, its private data and all nodes.
+ * The allocator is copied on creation, so the passed structure does not need to outlive the container.
+ */
+struct LDSC_allocator {
+  /**
+   * @brief Allocate a block of memory.
+   * @param size Size of the block in bytes.
+   * @param context User context pointer.
+   * @return Pointer to the block or NULL on failure.
+   */
+  void* (*alloc)(size_t size, void* context);
+
+  /**
+   * @brief Release a block of memory.
+   * @param ptr Pointer to a block returned by alloc.
+   * @param size Size of the block in bytes, as passed to alloc.
+   * @param context User context pointer.
+   */
+  void (*free)(void* ptr, size_t size, void* context);
+
+  /**
+   * @brief User context pointer passed to alloc and free.
+   */
+  void* context;
+};
+
+/**
+ * @brief Get the default allocator.
+ * @return Pointer to an allocator backed by malloc and free.
+ */
+const LDSC_allocator* LDSC_allocator_default(void);
+
+#endif
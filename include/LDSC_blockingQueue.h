@@ -0,0 +1,117 @@
+#ifndef LDSC_BLOCKINGQUEUE_H
+#define LDSC_BLOCKINGQUEUE_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+typedef struct LDSC_blockingQueue LDSC_blockingQueue;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes a thread-safe queue whose consumers block while it is empty.
+ * It wraps an LDSC_queue behind a mutex and condition variables.
+ * A bounded queue also blocks producers while it is full.
+ */
+struct LDSC_blockingQueue {
+  /**
+   * @brief Check is queue is empty.
+   * @param self Blocking queue pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(LDSC_blockingQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Get length of the queue.
+   * @param self Blocking queue pointer.
+   * @param status Error pointer.
+   * @return Length of the queue as integer type.
+   */
+  int (*length)(LDSC_blockingQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Add item to end of the queue, waiting for room if the queue is bounded.
+   * @param self Blocking queue pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that enqueue performs a shallow copy of the data.
+   * Reports STRUCTURE_CLOSED if the queue is or gets closed.
+   */
+  void (*enqueue)(LDSC_blockingQueue* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Remove item from front of the queue, waiting until one is available.
+   * @param self Blocking queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   * @details
+   * Reports STRUCTURE_CLOSED and returns NULL once the queue is closed and drained.
+   */
+  void* (*dequeue)(LDSC_blockingQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Remove item from front of the queue, waiting at most timeoutMs milliseconds.
+   * @param self Blocking queue pointer.
+   * @param timeoutMs Maximum wait in milliseconds.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   * @details
+   * Reports TIMED_OUT and returns NULL if no item arrived in time.
+   */
+  void* (*dequeueTimed)(LDSC_blockingQueue* self, long timeoutMs, LDSC_error* status);
+
+  /**
+   * @brief Remove up to count items, waiting until at least one is available.
+   * @param self Blocking queue pointer.
+   * @param items Array receiving the data pointers.
+   * @param count Maximum number of items to remove.
+   * @param status Error pointer.
+   * @return Number of items dequeued.
+   * @details
+   * All items are removed under a single lock acquisition. A count of 0
+   * returns 0 at once without waiting.
+   */
+  int (*dequeueMany)(LDSC_blockingQueue* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Close the queue and wake all waiting threads.
+   * @param self Blocking queue pointer.
+   * @param status Error pointer.
+   * @details
+   * Further enqueues fail while remaining items can still be dequeued.
+   */
+  void (*close)(LDSC_blockingQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Delete the queue.
+   * @param self Blocking queue pointer.
+   * @param status Error pointer.
+   * @details
+   * No thread may use or wait on the queue during or after delete.
+   */
+  void (*delete)(LDSC_blockingQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new unbounded blocking queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_blockingQueue.
+ */
+LDSC_blockingQueue* LDSC_blockingQueue_init(LDSC_error* status);
+
+/**
+ * @brief Create a new blocking queue with explicit capacity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Maximum number of items, 0 for unbounded.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_blockingQueue.
+ */
+LDSC_blockingQueue* LDSC_blockingQueue_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status);
+
+#endif
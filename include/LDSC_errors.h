@@ -15,14 +15,25 @@ typedef enum {
   PRIVATEDATA_MALLOC = 2,
   NODE_MALLOC = 3,
   DELETE_FAIL = 4,
+  BUFFER_MALLOC = 5,
 
   /* POINTER ERROR TYPES */
   NULL_SELF = 101,
   NULL_DATAPTR = 102,
+  INVALID_ALLOCATOR = 103,
 
   /* INDEX ERROR TYPES */
   LESS_THAN_INDEX = 201,
-  GREATER_THAN_INDEX = 202
+  GREATER_THAN_INDEX = 202,
+
+  /* CAPACITY ERROR TYPES */
+  INVALID_CAPACITY = 301,
+  STRUCTURE_FULL = 302,
+  STRUCTURE_EMPTY = 303,
+
+  /* SYNCHRONIZATION ERROR TYPES */
+  TIMED_OUT = 401,
+  STRUCTURE_CLOSED = 402
 
 } LDSC_error;
 
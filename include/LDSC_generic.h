@@ -0,0 +1,665 @@
+#ifndef LDSC_GENERIC_H
+#define LDSC_GENERIC_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+#include <string.h>
+
+/**
+ * Macro generated containers that store values of a type T inline.
+ * Each LDSC_DEFINE_* macro expands to a structure with the usual function
+ * pointer interface, named after its first argument, plus its init and
+ * init_with constructors, all as static inline functions of the including
+ * file. Items are copied in and out by value, so no payload is allocated
+ * per item and the element size is known at compile time.
+ * Since a value cannot be NULL, removing from or peeking into an empty
+ * container reports STRUCTURE_EMPTY and returns a zeroed T.
+ *
+ * Expand a macro once per type at file scope, for example
+ * LDSC_DEFINE_QUEUE(intQueue, int) followed by
+ * intQueue* myQueue = intQueue_init(&status);
+ */
+
+/**
+ * @brief Default initial capacity of generated stacks and queues.
+ */
+#define LDSC_GENERIC_DEFAULT_CAPACITY 16
+
+/** largest capacity a generated stack or queue may grow to */
+#define LDSC_GENERIC_MAX_CAPACITY (1 << 30)
+
+/**************************************************/
+/* LDSC_DEFINE_STACK */
+
+/**
+ * @brief Define a stack of T values named name, backed by a growable array.
+ * @details
+ * Methods: size, empty, push(self, T value, status), pop, peek, delete.
+ * Constructors: name_init(status) and name_init_with(allocator, capacity, status).
+ */
+#define LDSC_DEFINE_STACK(name, T)                                                         \
+  typedef struct name name;                                                                \
+                                                                                           \
+  struct name##_privateData {                                                              \
+    int size;                                                                              \
+    T* buffer;                                                                             \
+    int capacity;                                                                          \
+    LDSC_allocator allocator;                                                              \
+  };                                                                                       \
+                                                                                           \
+  struct name {                                                                            \
+    int (*size)(name* self, LDSC_error* status);                                           \
+    int (*empty)(name* self, LDSC_error* status);                                          \
+    void (*push)(name* self, T value, LDSC_error* status);                                 \
+    T (*pop)(name* self, LDSC_error* status);                                              \
+    T (*peek)(name* self, LDSC_error* status);                                             \
+    void (*delete)(name* self, LDSC_error* status);                                        \
+    struct name##_privateData* pd;                                                         \
+  };                                                                                       \
+                                                                                           \
+  typedef struct name##_instance {                                                         \
+    name self;                                                                             \
+    struct name##_privateData pd;                                                          \
+  } name##_instance;                                                                       \
+                                                                                           \
+  static inline int name##_size(name* self, LDSC_error* status) {                          \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return ERROR;                                                                        \
+    }                                                                                      \
+    return self->pd->size;                                                                 \
+  }                                                                                        \
+                                                                                           \
+  static inline int name##_empty(name* self, LDSC_error* status) {                         \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return ERROR;                                                                        \
+    }                                                                                      \
+    return self->pd->size == 0;                                                            \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_push(name* self, T value, LDSC_error* status) {                \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    struct name##_privateData* pd = self->pd;                                              \
+    if (pd->size == pd->capacity) {                                                        \
+      T* newBuffer = NULL;                                                                 \
+      if (pd->capacity < LDSC_GENERIC_MAX_CAPACITY)                                        \
+        newBuffer = pd->allocator.alloc(2 * (size_t)pd->capacity * sizeof(T),              \
+                                        pd->allocator.context);                            \
+      if (!newBuffer) {                                                                    \
+        if (status) *status = BUFFER_MALLOC;                                               \
+        return;                                                                            \
+      }                                                                                    \
+      memcpy(newBuffer, pd->buffer, (size_t)pd->size * sizeof(T));                         \
+      pd->allocator.free(pd->buffer, (size_t)pd->capacity * sizeof(T),                     \
+                         pd->allocator.context);                                           \
+      pd->buffer = newBuffer;                                                              \
+      pd->capacity *= 2;                                                                   \
+    }                                                                                      \
+    pd->buffer[pd->size++] = value;                                                        \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_pop(name* self, LDSC_error* status) {                             \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (self->pd->size == 0) {                                                             \
+      if (status) *status = STRUCTURE_EMPTY;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return self->pd->buffer[--self->pd->size];                                             \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_peek(name* self, LDSC_error* status) {                            \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (self->pd->size == 0) {                                                             \
+      if (status) *status = STRUCTURE_EMPTY;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return self->pd->buffer[self->pd->size - 1];                                           \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_delete(name* self, LDSC_error* status) {                       \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    LDSC_allocator allocator = self->pd->allocator;                                        \
+    allocator.free(self->pd->buffer, (size_t)self->pd->capacity * sizeof(T),               \
+                   allocator.context);                                                     \
+    allocator.free(self, sizeof(name##_instance), allocator.context);                      \
+  }                                                                                        \
+                                                                                           \
+  static inline name* name##_init_with(const LDSC_allocator* allocator, int capacity,      \
+                                       LDSC_error* status) {                               \
+    if (status) *status = OK;                                                              \
+    if (capacity < 0 || capacity > LDSC_GENERIC_MAX_CAPACITY) {                            \
+      if (status) *status = INVALID_CAPACITY;                                              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    if (!allocator) allocator = LDSC_allocator_default();                                  \
+    if (!allocator->alloc || !allocator->free) {                                           \
+      if (status) *status = INVALID_ALLOCATOR;                                             \
+      return NULL;                                                                         \
+    }                                                                                      \
+    name##_instance* instance = allocator->alloc(sizeof(name##_instance),                  \
+                                                 allocator->context);                      \
+    if (!instance) {                                                                       \
+      if (status) *status = STRUCTURE_MALLOC;                                              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    if (!capacity) capacity = LDSC_GENERIC_DEFAULT_CAPACITY;                               \
+    instance->pd.buffer = allocator->alloc((size_t)capacity * sizeof(T), allocator->context); \
+    if (!instance->pd.buffer) {                                                            \
+      if (status) *status = BUFFER_MALLOC;                                                 \
+      allocator->free(instance, sizeof(name##_instance), allocator->context);              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    instance->pd.size = 0;                                                                 \
+    instance->pd.capacity = capacity;                                                      \
+    instance->pd.allocator = *allocator;                                                   \
+                                                                                           \
+    name* newStack = &instance->self;                                                      \
+    newStack->size = &name##_size;                                                         \
+    newStack->empty = &name##_empty;                                                       \
+    newStack->push = &name##_push;                                                         \
+    newStack->pop = &name##_pop;                                                           \
+    newStack->peek = &name##_peek;                                                         \
+    newStack->delete = &name##_delete;                                                     \
+    newStack->pd = &instance->pd;                                                          \
+    return newStack;                                                                       \
+  }                                                                                        \
+                                                                                           \
+  static inline name* name##_init(LDSC_error* status) {                                    \
+    return name##_init_with(NULL, 0, status);                                              \
+  }
+
+/**************************************************/
+/* LDSC_DEFINE_QUEUE */
+
+/**
+ * @brief Define a queue of T values named name, backed by a growable ring buffer.
+ * @details
+ * Methods: length, empty, enqueue(self, T value, status), dequeue, peek, delete.
+ * Constructors: name_init(status) and name_init_with(allocator, capacity, status).
+ * The capacity is rounded up to a power of two and doubles when full.
+ */
+#define LDSC_DEFINE_QUEUE(name, T)                                                         \
+  typedef struct name name;                                                                \
+                                                                                           \
+  struct name##_privateData {                                                              \
+    int length;                                                                            \
+    int head;                                                                              \
+    T* buffer;                                                                             \
+    int mask;                                                                              \
+    LDSC_allocator allocator;                                                              \
+  };                                                                                       \
+                                                                                           \
+  struct name {                                                                            \
+    int (*length)(name* self, LDSC_error* status);                                         \
+    int (*empty)(name* self, LDSC_error* status);                                          \
+    void (*enqueue)(name* self, T value, LDSC_error* status);                              \
+    T (*dequeue)(name* self, LDSC_error* status);                                          \
+    T (*peek)(name* self, LDSC_error* status);                                             \
+    void (*delete)(name* self, LDSC_error* status);                                        \
+    struct name##_privateData* pd;                                                         \
+  };                                                                                       \
+                                                                                           \
+  typedef struct name##_instance {                                                         \
+    name self;                                                                             \
+    struct name##_privateData pd;                                                          \
+  } name##_instance;                                                                       \
+                                                                                           \
+  static inline int name##_length(name* self, LDSC_error* status) {                        \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return ERROR;                                                                        \
+    }                                                                                      \
+    return self->pd->length;                                                               \
+  }                                                                                        \
+                                                                                           \
+  static inline int name##_empty(name* self, LDSC_error* status) {                         \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return ERROR;                                                                        \
+    }                                                                                      \
+    return self->pd->length == 0;                                                          \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_enqueue(name* self, T value, LDSC_error* status) {             \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    struct name##_privateData* pd = self->pd;                                              \
+    if (pd->length == pd->mask + 1) {                                                      \
+      int capacity = pd->mask + 1;                                                         \
+      T* newBuffer = NULL;                                                                 \
+      if (capacity < LDSC_GENERIC_MAX_CAPACITY)                                            \
+        newBuffer = pd->allocator.alloc(2 * (size_t)capacity * sizeof(T),                  \
+                                        pd->allocator.context);                            \
+      if (!newBuffer) {                                                                    \
+        if (status) *status = BUFFER_MALLOC;                                               \
+        return;                                                                            \
+      }                                                                                    \
+      /* unwrap the ring so the items start at index 0 */                                  \
+      memcpy(newBuffer, pd->buffer + pd->head, (size_t)(capacity - pd->head) * sizeof(T)); \
+      memcpy(newBuffer + capacity - pd->head, pd->buffer, (size_t)pd->head * sizeof(T));   \
+      pd->allocator.free(pd->buffer, (size_t)capacity * sizeof(T), pd->allocator.context); \
+      pd->buffer = newBuffer;                                                              \
+      pd->head = 0;                                                                        \
+      pd->mask = 2 * capacity - 1;                                                         \
+    }                                                                                      \
+    pd->buffer[(pd->head + pd->length) & pd->mask] = value;                                \
+    pd->length++;                                                                          \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_dequeue(name* self, LDSC_error* status) {                         \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    struct name##_privateData* pd = self->pd;                                              \
+    if (pd->length == 0) {                                                                 \
+      if (status) *status = STRUCTURE_EMPTY;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    T value = pd->buffer[pd->head];                                                        \
+    pd->head = (pd->head + 1) & pd->mask;                                                  \
+    pd->length--;                                                                          \
+    return value;                                                                          \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_peek(name* self, LDSC_error* status) {                            \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (self->pd->length == 0) {                                                           \
+      if (status) *status = STRUCTURE_EMPTY;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return self->pd->buffer[self->pd->head];                                               \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_delete(name* self, LDSC_error* status) {                       \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    LDSC_allocator allocator = self->pd->allocator;                                        \
+    allocator.free(self->pd->buffer, (size_t)(self->pd->mask + 1) * sizeof(T),             \
+                   allocator.context);                                                     \
+    allocator.free(self, sizeof(name##_instance), allocator.context);                      \
+  }                                                                                        \
+                                                                                           \
+  static inline name* name##_init_with(const LDSC_allocator* allocator, int capacity,      \
+                                       LDSC_error* status) {                               \
+    if (status) *status = OK;                                                              \
+    if (capacity < 0 || capacity > LDSC_GENERIC_MAX_CAPACITY) {                            \
+      if (status) *status = INVALID_CAPACITY;                                              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    if (!allocator) allocator = LDSC_allocator_default();                                  \
+    if (!allocator->alloc || !allocator->free) {                                           \
+      if (status) *status = INVALID_ALLOCATOR;                                             \
+      return NULL;                                                                         \
+    }                                                                                      \
+    name##_instance* instance = allocator->alloc(sizeof(name##_instance),                  \
+                                                 allocator->context);                      \
+    if (!instance) {                                                                       \
+      if (status) *status = STRUCTURE_MALLOC;                                              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    int size = 1;                                                                          \
+    while (size < (capacity ? capacity : LDSC_GENERIC_DEFAULT_CAPACITY))                   \
+      size <<= 1;                                                                          \
+    instance->pd.buffer = allocator->alloc((size_t)size * sizeof(T), allocator->context);  \
+    if (!instance->pd.buffer) {                                                            \
+      if (status) *status = BUFFER_MALLOC;                                                 \
+      allocator->free(instance, sizeof(name##_instance), allocator->context);              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    instance->pd.length = 0;                                                               \
+    instance->pd.head = 0;                                                                 \
+    instance->pd.mask = size - 1;                                                          \
+    instance->pd.allocator = *allocator;                                                   \
+                                                                                           \
+    name* newQueue = &instance->self;                                                      \
+    newQueue->length = &name##_length;                                                     \
+    newQueue->empty = &name##_empty;                                                       \
+    newQueue->enqueue = &name##_enqueue;                                                   \
+    newQueue->dequeue = &name##_dequeue;                                                   \
+    newQueue->peek = &name##_peek;                                                         \
+    newQueue->delete = &name##_delete;                                                     \
+    newQueue->pd = &instance->pd;                                                          \
+    return newQueue;                                                                       \
+  }                                                                                        \
+                                                                                           \
+  static inline name* name##_init(LDSC_error* status) {                                    \
+    return name##_init_with(NULL, 0, status);                                              \
+  }
+
+/**************************************************/
+/* LDSC_DEFINE_LIST */
+
+/**
+ * @brief Define a doubly linked list of T values named name.
+ * @details
+ * Methods: length, empty, append(self, T value, status), prepend,
+ * add(self, T value, index, status), at(self, index, status),
+ * replace(self, T value, index, status), pop, pull, remove(self, index, status),
+ * clear, delete. They take the same arguments as the matching
+ * LDSC_linkedList methods, with T in place of void*.
+ * Constructors: name_init(status) and name_init_with(allocator, status).
+ * Every node holds its T inline, so an item costs exactly one node allocation.
+ */
+#define LDSC_DEFINE_LIST(name, T)                                                          \
+  typedef struct name name;                                                                \
+                                                                                           \
+  typedef struct name##_node {                                                             \
+    struct name##_node* next;                                                              \
+    struct name##_node* prev;                                                              \
+    T value;                                                                               \
+  } name##_node;                                                                           \
+                                                                                           \
+  struct name##_privateData {                                                              \
+    int length;                                                                            \
+    name##_node* head;                                                                     \
+    name##_node* tail;                                                                     \
+    LDSC_allocator allocator;                                                              \
+  };                                                                                       \
+                                                                                           \
+  struct name {                                                                            \
+    int (*length)(name* self, LDSC_error* status);                                         \
+    int (*empty)(name* self, LDSC_error* status);                                          \
+    void (*append)(name* self, T value, LDSC_error* status);                               \
+    void (*prepend)(name* self, T value, LDSC_error* status);                              \
+    void (*add)(name* self, T value, int index, LDSC_error* status);                       \
+    T (*at)(name* self, int index, LDSC_error* status);                                    \
+    T (*replace)(name* self, T value, int index, LDSC_error* status);                      \
+    T (*pop)(name* self, LDSC_error* status);                                              \
+    T (*pull)(name* self, LDSC_error* status);                                             \
+    T (*remove)(name* self, int index, LDSC_error* status);                                \
+    void (*clear)(name* self, LDSC_error* status);                                         \
+    void (*delete)(name* self, LDSC_error* status);                                        \
+    struct name##_privateData* pd;                                                         \
+  };                                                                                       \
+                                                                                           \
+  typedef struct name##_instance {                                                         \
+    name self;                                                                             \
+    struct name##_privateData pd;                                                          \
+  } name##_instance;                                                                       \
+                                                                                           \
+  static inline int name##_length(name* self, LDSC_error* status) {                        \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return ERROR;                                                                        \
+    }                                                                                      \
+    return self->pd->length;                                                               \
+  }                                                                                        \
+                                                                                           \
+  static inline int name##_empty(name* self, LDSC_error* status) {                         \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return ERROR;                                                                        \
+    }                                                                                      \
+    return self->pd->length == 0;                                                          \
+  }                                                                                        \
+                                                                                           \
+  /* allocate a node holding value, linking it in is up to the caller */                   \
+  static inline name##_node* name##_newNode(name* self, T value, LDSC_error* status) {     \
+    name##_node* newNode = self->pd->allocator.alloc(sizeof(name##_node),                  \
+                                                     self->pd->allocator.context);         \
+    if (!newNode) {                                                                        \
+      if (status) *status = NODE_MALLOC;                                                   \
+      return NULL;                                                                         \
+    }                                                                                      \
+    newNode->value = value;                                                                \
+    return newNode;                                                                        \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_append(name* self, T value, LDSC_error* status) {              \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    name##_node* newNode = name##_newNode(self, value, status);                            \
+    if (!newNode) return;                                                                  \
+    newNode->next = NULL;                                                                  \
+    newNode->prev = self->pd->tail;                                                        \
+    if (self->pd->tail) self->pd->tail->next = newNode;                                    \
+    else self->pd->head = newNode;                                                         \
+    self->pd->tail = newNode;                                                              \
+    self->pd->length++;                                                                    \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_prepend(name* self, T value, LDSC_error* status) {             \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    name##_node* newNode = name##_newNode(self, value, status);                            \
+    if (!newNode) return;                                                                  \
+    newNode->prev = NULL;                                                                  \
+    newNode->next = self->pd->head;                                                        \
+    if (self->pd->head) self->pd->head->prev = newNode;                                    \
+    else self->pd->tail = newNode;                                                         \
+    self->pd->head = newNode;                                                              \
+    self->pd->length++;                                                                    \
+  }                                                                                        \
+                                                                                           \
+  /* node at a valid index, walking from the nearer end */                                 \
+  static inline name##_node* name##_getNode(name* self, int index) {                       \
+    name##_node* currNode;                                                                 \
+    if (index < self->pd->length / 2) {                                                    \
+      currNode = self->pd->head;                                                           \
+      for (int i = 0; i < index; i++) currNode = currNode->next;                           \
+    } else {                                                                               \
+      currNode = self->pd->tail;                                                           \
+      for (int i = self->pd->length - 1; i > index; i--) currNode = currNode->prev;        \
+    }                                                                                      \
+    return currNode;                                                                       \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_add(name* self, T value, int index, LDSC_error* status) {      \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    if (index < 0) {                                                                       \
+      if (status) *status = LESS_THAN_INDEX;                                               \
+      return;                                                                              \
+    }                                                                                      \
+    if (index > self->pd->length) {                                                        \
+      if (status) *status = GREATER_THAN_INDEX;                                            \
+      return;                                                                              \
+    }                                                                                      \
+    name##_node* newNode = name##_newNode(self, value, status);                            \
+    if (!newNode) return;                                                                  \
+    newNode->prev = index ? name##_getNode(self, index - 1) : NULL;                        \
+    newNode->next = newNode->prev ? newNode->prev->next : self->pd->head;                  \
+    if (newNode->prev) newNode->prev->next = newNode;                                      \
+    else self->pd->head = newNode;                                                         \
+    if (newNode->next) newNode->next->prev = newNode;                                      \
+    else self->pd->tail = newNode;                                                         \
+    self->pd->length++;                                                                    \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_at(name* self, int index, LDSC_error* status) {                   \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (index < 0) {                                                                       \
+      if (status) *status = LESS_THAN_INDEX;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (index >= self->pd->length) {                                                       \
+      if (status) *status = GREATER_THAN_INDEX;                                            \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return name##_getNode(self, index)->value;                                             \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_replace(name* self, T value, int index, LDSC_error* status) {     \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (index < 0) {                                                                       \
+      if (status) *status = LESS_THAN_INDEX;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (index >= self->pd->length) {                                                       \
+      if (status) *status = GREATER_THAN_INDEX;                                            \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    name##_node* targetNode = name##_getNode(self, index);                                 \
+    T replaced = targetNode->value;                                                        \
+    targetNode->value = value;                                                             \
+    return replaced;                                                                       \
+  }                                                                                        \
+                                                                                           \
+  /* unlink and free a node, returning its value */                                        \
+  static inline T name##_unlink(name* self, name##_node* node) {                           \
+    if (node->prev) node->prev->next = node->next;                                         \
+    else self->pd->head = node->next;                                                      \
+    if (node->next) node->next->prev = node->prev;                                         \
+    else self->pd->tail = node->prev;                                                      \
+    self->pd->length--;                                                                    \
+    T value = node->value;                                                                 \
+    self->pd->allocator.free(node, sizeof(name##_node), self->pd->allocator.context);      \
+    return value;                                                                          \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_pop(name* self, LDSC_error* status) {                             \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (!self->pd->head) {                                                                 \
+      if (status) *status = STRUCTURE_EMPTY;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return name##_unlink(self, self->pd->head);                                            \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_pull(name* self, LDSC_error* status) {                            \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (!self->pd->tail) {                                                                 \
+      if (status) *status = STRUCTURE_EMPTY;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return name##_unlink(self, self->pd->tail);                                            \
+  }                                                                                        \
+                                                                                           \
+  static inline T name##_remove(name* self, int index, LDSC_error* status) {               \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (index < 0) {                                                                       \
+      if (status) *status = LESS_THAN_INDEX;                                               \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    if (index >= self->pd->length) {                                                       \
+      if (status) *status = GREATER_THAN_INDEX;                                            \
+      return (T){0};                                                                       \
+    }                                                                                      \
+    return name##_unlink(self, name##_getNode(self, index));                               \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_clear(name* self, LDSC_error* status) {                        \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    while (self->pd->head)                                                                 \
+      name##_unlink(self, self->pd->head);                                                 \
+  }                                                                                        \
+                                                                                           \
+  static inline void name##_delete(name* self, LDSC_error* status) {                       \
+    if (status) *status = OK;                                                              \
+    if (!self) {                                                                           \
+      if (status) *status = NULL_SELF;                                                     \
+      return;                                                                              \
+    }                                                                                      \
+    name##_clear(self, NULL);                                                              \
+    LDSC_allocator allocator = self->pd->allocator;                                        \
+    allocator.free(self, sizeof(name##_instance), allocator.context);                      \
+  }                                                                                        \
+                                                                                           \
+  static inline name* name##_init_with(const LDSC_allocator* allocator, LDSC_error* status) { \
+    if (status) *status = OK;                                                              \
+    if (!allocator) allocator = LDSC_allocator_default();                                  \
+    if (!allocator->alloc || !allocator->free) {                                           \
+      if (status) *status = INVALID_ALLOCATOR;                                             \
+      return NULL;                                                                         \
+    }                                                                                      \
+    name##_instance* instance = allocator->alloc(sizeof(name##_instance),                  \
+                                                 allocator->context);                      \
+    if (!instance) {                                                                       \
+      if (status) *status = STRUCTURE_MALLOC;                                              \
+      return NULL;                                                                         \
+    }                                                                                      \
+    instance->pd.length = 0;                                                               \
+    instance->pd.head = NULL;                                                              \
+    instance->pd.tail = NULL;                                                              \
+    instance->pd.allocator = *allocator;                                                   \
+                                                                                           \
+    name* newLL = &instance->self;                                                         \
+    newLL->length = &name##_length;                                                        \
+    newLL->empty = &name##_empty;                                                          \
+    newLL->append = &name##_append;                                                        \
+    newLL->prepend = &name##_prepend;                                                      \
+    newLL->add = &name##_add;                                                              \
+    newLL->at = &name##_at;                                                                \
+    newLL->replace = &name##_replace;                                                      \
+    newLL->pop = &name##_pop;                                                              \
+    newLL->pull = &name##_pull;                                                            \
+    newLL->remove = &name##_remove;                                                        \
+    newLL->clear = &name##_clear;                                                          \
+    newLL->delete = &name##_delete;                                                        \
+    newLL->pd = &instance->pd;                                                             \
+    return newLL;                                                                          \
+  }                                                                                        \
+                                                                                           \
+  static inline name* name##_init(LDSC_error* status) {                                    \
+    return name##_init_with(NULL, status);                                                 \
+  }
+
+#endif
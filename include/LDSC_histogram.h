@@ -0,0 +1,142 @@
+#ifndef LDSC_HISTOGRAM_H
+#define LDSC_HISTOGRAM_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/**
+ * @brief Linear sub-buckets per power of two, bounding the relative error of a percentile to 1/64.
+ */
+#define LDSC_HISTOGRAM_SUB_BUCKETS 64
+
+/**
+ * @brief Largest value with a bucket of its own precision, larger values share the last bucket.
+ */
+#define LDSC_HISTOGRAM_MAX_VALUE ((1LL << 42) - 1)
+
+typedef struct LDSC_histogram LDSC_histogram;
+typedef struct privateData privateData;
+
+/**
+ * Log-linear histogram of non-negative values, usually latencies in nanoseconds.
+ * Values below 2 * LDSC_HISTOGRAM_SUB_BUCKETS get a bucket each; above that
+ * every power of two is split into LDSC_HISTOGRAM_SUB_BUCKETS equal buckets,
+ * so a bucket is never wider than 1/64 of the values it holds. The buckets are
+ * fixed, which makes recording constant time and lets histograms filled by
+ * different threads be merged by adding counts.
+ * A histogram is not thread safe; give each thread its own and merge them.
+ */
+struct LDSC_histogram {
+  /**
+   * @brief Record a value.
+   * @param self Histogram pointer.
+   * @param value Value to record, at least 0.
+   * @param status Error pointer.
+   * @details
+   * Negative values are rejected with LESS_THAN_INDEX.
+   */
+  void (*record)(LDSC_histogram* self, long long value, LDSC_error* status);
+
+  /**
+   * @brief Get the number of recorded values.
+   * @param self Histogram pointer.
+   * @param status Error pointer.
+   * @return Number of values recorded since creation or reset.
+   */
+  long (*count)(LDSC_histogram* self, LDSC_error* status);
+
+  /**
+   * @brief Get the smallest recorded value.
+   * @param self Histogram pointer.
+   * @param status Error pointer.
+   * @return Smallest value, 0 with STRUCTURE_EMPTY if nothing was recorded.
+   */
+  long long (*min)(LDSC_histogram* self, LDSC_error* status);
+
+  /**
+   * @brief Get the largest recorded value.
+   * @param self Histogram pointer.
+   * @param status Error pointer.
+   * @return Largest value, 0 with STRUCTURE_EMPTY if nothing was recorded.
+   */
+  long long (*max)(LDSC_histogram* self, LDSC_error* status);
+
+  /**
+   * @brief Get the mean of the recorded values.
+   * @param self Histogram pointer.
+   * @param status Error pointer.
+   * @return Exact mean, 0 with STRUCTURE_EMPTY if nothing was recorded.
+   */
+  double (*mean)(LDSC_histogram* self, LDSC_error* status);
+
+  /**
+   * @brief Get the value at a percentile.
+   * @param self Histogram pointer.
+   * @param percentile Percentile from 0 to 100, e.g. 99.9.
+   * @param status Error pointer.
+   * @return Value that percentile of the recorded values are at or below.
+   * @details
+   * The result is the upper end of the bucket holding the requested rank,
+   * capped at the largest recorded value, so it is never lower than the
+   * exact percentile and at most 1/64 above it. A rank in the last bucket
+   * returns the largest recorded value. Percentile 0 returns the
+   * smallest value. A percentile outside 0 to 100 is rejected with
+   * LESS_THAN_INDEX or GREATER_THAN_INDEX, an empty histogram reports
+   * STRUCTURE_EMPTY.
+   */
+  long long (*percentile)(LDSC_histogram* self, double percentile, LDSC_error* status);
+
+  /**
+   * @brief Add the values recorded in another histogram.
+   * @param self Histogram pointer.
+   * @param other Histogram to merge in, left unchanged.
+   * @param status Error pointer.
+   */
+  void (*merge)(LDSC_histogram* self, LDSC_histogram* other, LDSC_error* status);
+
+  /**
+   * @brief Forget all recorded values.
+   * @param self Histogram pointer.
+   * @param status Error pointer.
+   */
+  void (*reset)(LDSC_histogram* self, LDSC_error* status);
+
+  /**
+   * @brief Delete the histogram.
+   * @param self Histogram pointer.
+   * @param status Error pointer.
+   */
+  void (*delete)(LDSC_histogram* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+} ;
+
+/**
+ * @brief Create a new histogram.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_histogram.
+ */
+LDSC_histogram* LDSC_histogram_init(LDSC_error* status);
+
+/**
+ * @brief Create a new histogram using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_histogram.
+ * @details
+ * The structure, its private data and the buckets share a single allocation.
+ */
+LDSC_histogram* LDSC_histogram_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+/**
+ * @brief Read the monotonic clock.
+ * @return CLOCK_MONOTONIC time in nanoseconds.
+ * @details
+ * Differences of two readings are the latencies the histogram is meant for.
+ */
+long long LDSC_histogram_now(void);
+
+#endif
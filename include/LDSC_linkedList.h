@@ -2,10 +2,28 @@
 #define LDSC_LINKEDLIST_H
 
 #include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+#include <LDSC_stats.h>
+
+/**
+ * @brief Default number of nodes per slab for linked lists in arena mode.
+ */
+#define LDSC_ARENA_DEFAULT_SLAB_NODES 1024
 
 typedef struct LDSC_linkedList LDSC_linkedList;
 typedef struct privateData privateData;
 
+/**
+ * @brief Position in a linked list used for O(1) traversal and editing.
+ * @details
+ * A cursor either refers to an item or to the end position one past the tail.
+ * Cursors are plain values and need no cleanup. A cursor is invalidated when
+ * the item it refers to is removed by any other means than removeAt on it.
+ */
+typedef struct LDSC_listCursor {
+  void* node; /**< Opaque node pointer, NULL at the end position */
+} LDSC_listCursor;
+
 struct LDSC_linkedList {
   /**
    * @brief Get length of the linked list.
@@ -107,6 +125,225 @@ struct LDSC_linkedList {
    */
   void (*clear)(LDSC_linkedList* self, LDSC_error* status);
 
+  /**
+   * @brief Pre-allocate nodes into the node pool.
+   * @param self LDSC_linkedList pointer.
+   * @param count Number of nodes the pool should hold.
+   * @param status Error pointer.
+   * @details
+   * The pool capacity is raised to count if it is smaller.
+   */
+  void (*reserve)(LDSC_linkedList* self, int count, LDSC_error* status);
+
+  /**
+   * @brief Set the maximum number of recycled nodes kept in the node pool.
+   * @param self LDSC_linkedList pointer.
+   * @param cap Maximum number of pooled nodes, 0 disables pooling.
+   * @param status Error pointer.
+   * @details
+   * Removed nodes are kept for reuse until the pool holds cap nodes.
+   * The default cap is LDSC_NODE_POOL_DEFAULT_CAP.
+   */
+  void (*setPoolCap)(LDSC_linkedList* self, int cap, LDSC_error* status);
+
+  /**
+   * @brief Get a cursor to the first item.
+   * @param self LDSC_linkedList pointer.
+   * @param status Error pointer.
+   * @return Cursor at the head, or at the end position if the list is empty.
+   */
+  LDSC_listCursor (*begin)(LDSC_linkedList* self, LDSC_error* status);
+
+  /**
+   * @brief Get a cursor to the end position one past the tail.
+   * @param self LDSC_linkedList pointer.
+   * @param status Error pointer.
+   * @return Cursor at the end position.
+   */
+  LDSC_listCursor (*end)(LDSC_linkedList* self, LDSC_error* status);
+
+  /**
+   * @brief Move the cursor to the next item.
+   * @param self LDSC_linkedList pointer.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = cursor is on an item and 0 = cursor is at the end.
+   * @details
+   * Reports GREATER_THAN_INDEX if the cursor already is at the end.
+   */
+  int (*next)(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Move the cursor to the previous item.
+   * @param self LDSC_linkedList pointer.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = cursor is on an item and 0 = it did not move.
+   * @details
+   * Moving back from the end position goes to the tail.
+   * Reports LESS_THAN_INDEX if the cursor is at the head.
+   */
+  int (*prev)(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Get item at the cursor.
+   * @param self LDSC_linkedList pointer.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item at the cursor, NULL at the end position.
+   */
+  void* (*get)(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Add item before the cursor.
+   * @param self LDSC_linkedList pointer.
+   * @param cursor Cursor pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Inserting at the end position appends. The cursor keeps its item.
+   * Keep note that insertAt performs a shallow copy of the data.
+   */
+  void (*insertAt)(LDSC_linkedList* self, LDSC_listCursor* cursor, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the cursor.
+   * @param self LDSC_linkedList pointer.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   * @details
+   * The cursor moves to the item after the removed one.
+   */
+  void* (*removeAt)(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Move all items of another list before the cursor in O(1).
+   * @param self LDSC_linkedList pointer.
+   * @param cursor Cursor pointer.
+   * @param other List whose items are moved, left empty.
+   * @param status Error pointer.
+   * @details
+   * Both lists must use the same allocator and neither may be in arena mode,
+   * otherwise INVALID_ALLOCATOR is reported and nothing is moved.
+   */
+  void (*spliceAt)(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_linkedList* other, LDSC_error* status);
+
+  /**
+   * @brief Add items to the end of the list.
+   * @param self LDSC_linkedList pointer.
+   * @param items Array of data pointers, appended in order.
+   * @param count Number of items.
+   * @param status Error pointer.
+   * @details
+   * Every item is checked before any is added and all nodes are obtained
+   * before the batch is linked in at once, so on NULL_DATAPTR or
+   * NODE_MALLOC the list is left unchanged.
+   * Keep note that appendMany performs a shallow copy of the data.
+   */
+  void (*appendMany)(LDSC_linkedList* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Remove up to count items from the start of the list.
+   * @param self LDSC_linkedList pointer.
+   * @param items Array receiving the data pointers in list order.
+   * @param count Maximum number of items to remove.
+   * @param status Error pointer.
+   * @return Number of items removed, less than count if the list ran empty.
+   */
+  int (*popMany)(LDSC_linkedList* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Move all items of another list to the end in O(1).
+   * @param self LDSC_linkedList pointer.
+   * @param other List whose items are moved, left empty.
+   * @param status Error pointer.
+   * @details
+   * Both lists must use the same allocator and neither may be in arena mode,
+   * otherwise INVALID_ALLOCATOR is reported and nothing is moved.
+   */
+  void (*concat)(LDSC_linkedList* self, LDSC_linkedList* other, LDSC_error* status);
+
+  /**
+   * @brief Move the items in range [from, to) of another list before index.
+   * @param self LDSC_linkedList pointer.
+   * @param index Index the first moved item will have, 0 to length.
+   * @param other List whose items are moved.
+   * @param from Index in other of the first item to move.
+   * @param to Index in other one past the last item to move.
+   * @param status Error pointer.
+   * @details
+   * Nodes are relinked, not copied. Finding the range and the insertion point
+   * costs the same walks as at(). The allocator rules of concat apply.
+   */
+  void (*splice)(LDSC_linkedList* self, int index, LDSC_linkedList* other, int from, int to, LDSC_error* status);
+
+  /**
+   * @brief Split the linked list at index.
+   * @param self LDSC_linkedList pointer.
+   * @param index Index of the first item to move out, 0 to length.
+   * @param status Error pointer.
+   * @return New list holding the items from index on, created with the same allocator.
+   * @details
+   * self keeps the items before index. Nodes are relinked, not copied, so
+   * lists in arena mode cannot be split and report INVALID_ALLOCATOR.
+   */
+  LDSC_linkedList* (*splitAt)(LDSC_linkedList* self, int index, LDSC_error* status);
+
+  /**
+   * @brief Call a function on every item from head to tail.
+   * @param self LDSC_linkedList pointer.
+   * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+   * @param ctx User context passed to callback.
+   * @param status Error pointer.
+   */
+  void (*forEach)(LDSC_linkedList* self, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status);
+
+  /**
+   * @brief Sort the linked list.
+   * @param self LDSC_linkedList pointer.
+   * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+   * @param status Error pointer.
+   * @details
+   * Stable bottom-up merge sort in O(n log n) that relinks the existing nodes
+   * and allocates nothing. Cursors stay on their items.
+   */
+  void (*sort)(LDSC_linkedList* self, int (*cmp)(const void* a, const void* b), LDSC_error* status);
+
+  /**
+   * @brief Add item in sorted position.
+   * @param self LDSC_linkedList pointer.
+   * @param dataPtr Pointer to data.
+   * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+   * @param status Error pointer.
+   * @details
+   * The list must already be sorted by cmp. The item goes after all items
+   * that compare equal to it, so repeated inserts are stable.
+   * Items not smaller than the tail are appended without a walk.
+   * Keep note that insertSorted performs a shallow copy of the data.
+   */
+  void (*insertSorted)(LDSC_linkedList* self, void* dataPtr, int (*cmp)(const void* a, const void* b), LDSC_error* status);
+
+  /**
+   * @brief Copy the operation counters of the list.
+   * @param self LDSC_linkedList pointer.
+   * @param out Stats pointer receiving the counters.
+   * @param status Error pointer.
+   * @details
+   * Counters are only kept when the library is built with LDSC_STATS,
+   * otherwise out is zeroed. See LDSC_stats.h.
+   */
+  void (*stats)(LDSC_linkedList* self, LDSC_stats* out, LDSC_error* status);
+
+  /**
+   * @brief Zero the operation counters of the list.
+   * @param self LDSC_linkedList pointer.
+   * @param status Error pointer.
+   * @details
+   * The high-water length restarts at the current length.
+   */
+  void (*resetStats)(LDSC_linkedList* self, LDSC_error* status);
+
   /**
    * @brief Delete the linked list
    * @param self LDSC_ilnkedList pionter.
@@ -127,4 +364,28 @@ struct LDSC_linkedList {
  */
 LDSC_linkedList* LDSC_linkedList_init(LDSC_error* status);
 
+/**
+ * @brief Create a new linked list using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_linkedList.
+ * @details
+ * The allocator is used for the structure, its private data and all nodes.
+ * The structure and its private data share a single allocation.
+ */
+LDSC_linkedList* LDSC_linkedList_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+/**
+ * @brief Create a new linked list in arena mode.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param slabNodes Number of nodes per slab, 0 for LDSC_ARENA_DEFAULT_SLAB_NODES.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_linkedList.
+ * @details
+ * Nodes are carved out of contiguous slabs of slabNodes nodes.
+ * Removed nodes are always recycled and the pool cap does not apply.
+ * clear and delete release whole slabs instead of individual nodes.
+ */
+LDSC_linkedList* LDSC_linkedList_init_arena(const LDSC_allocator* allocator, int slabNodes, LDSC_error* status);
+
 #endif
@@ -0,0 +1,392 @@
+#ifndef LDSC_LINKEDLISTREF_H
+#define LDSC_LINKEDLISTREF_H
+
+#include <LDSC_linkedList.h>
+
+/**
+ * Compact handle for LDSC_linkedList, for programs keeping very many lists.
+ * An LDSC_linkedList carries its own copy of every method pointer; this
+ * handle carries a single pointer to the operation table shared by all
+ * handles, so each list costs two pointers plus its private data. An
+ * operation takes the private data of the handle in place of self, and of
+ * the other handle in place of another list:
+ *   l->ops->append(l->pd, item, &status);
+ *   l->ops->concat(l->pd, other->pd, &status);
+ * A NULL pd reports NULL_SELF. Deleting and splitting create or destroy
+ * handles, so they are not operations but LDSC_linkedListRef_delete and
+ * LDSC_linkedListRef_splitAt.
+ * The handle and its private data share a single allocation.
+ */
+
+typedef struct LDSC_linkedListOps LDSC_linkedListOps;
+
+struct LDSC_linkedListOps {
+  /**
+   * @brief Get length of the linked list.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @return Length of the linked list as integer type.
+   */
+  int (*length)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Check if linked list is empty.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Add item at the end of the linked list.
+   * @param pd Private data of the linked list.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that append performs a shallow copy of the data.
+   */
+  void (*append)(privateData* pd, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add item at the front of the linked list.
+   * @param pd Private data of the linked list.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that prepend performs a shallow copy of the data.
+   */
+  void (*prepend)(privateData* pd, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add item at index of the linked list.
+   * @param pd Private data of the linked list.
+   * @param dataPtr Pointer to data.
+   * @param index Index to add item at.
+   * @param status Error pointer.
+   * @details
+   * Keep note that add performs a shallow copy of the data.
+   */
+  void (*add)(privateData* pd, void* dataPtr, int index, LDSC_error* status);
+
+  /**
+   * @brief Get item at index.
+   * @param pd Private data of the linked list.
+   * @param index Index of item to get.
+   * @param status Error pointer.
+   * @return Data pointer of item at index.
+   */
+  void* (*at)(privateData* pd, int index, LDSC_error* status);
+
+  /**
+   * @brief Replace item at index.
+   * @param pd Private data of the linked list.
+   * @param dataPtr Pointer to data.
+   * @param index Index of item to replace with dataPtr.
+   * @param status Error pointer.
+   * @return Data pointer of item that was replaced.
+   * @details
+   * Keep note that replace performs a shallow copy of the data.
+   */
+  void* (*replace)(privateData* pd, void* dataPtr, int index, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the front of the list.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*pop)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the end of the list.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*pull)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Remove item at index.
+   * @param pd Private data of the linked list.
+   * @param index Index of item to remove.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*remove)(privateData* pd, int index, LDSC_error* status);
+
+  /**
+   * @brief Remove all items in the list.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   */
+  void (*clear)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Pre-allocate nodes into the node pool.
+   * @param pd Private data of the linked list.
+   * @param count Number of nodes the pool should hold.
+   * @param status Error pointer.
+   * @details
+   * The pool capacity is raised to count if it is smaller.
+   */
+  void (*reserve)(privateData* pd, int count, LDSC_error* status);
+
+  /**
+   * @brief Set the maximum number of recycled nodes kept in the node pool.
+   * @param pd Private data of the linked list.
+   * @param cap Maximum number of pooled nodes, 0 disables pooling.
+   * @param status Error pointer.
+   * @details
+   * Removed nodes are kept for reuse until the pool holds cap nodes.
+   * The default cap is LDSC_NODE_POOL_DEFAULT_CAP.
+   */
+  void (*setPoolCap)(privateData* pd, int cap, LDSC_error* status);
+
+  /**
+   * @brief Get a cursor to the first item.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @return Cursor at the head, or at the end position if the list is empty.
+   */
+  LDSC_listCursor (*begin)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Get a cursor to the end position one past the tail.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @return Cursor at the end position.
+   */
+  LDSC_listCursor (*end)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Move the cursor to the next item.
+   * @param pd Private data of the linked list.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = cursor is on an item and 0 = cursor is at the end.
+   * @details
+   * Reports GREATER_THAN_INDEX if the cursor already is at the end.
+   */
+  int (*next)(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Move the cursor to the previous item.
+   * @param pd Private data of the linked list.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = cursor is on an item and 0 = it did not move.
+   * @details
+   * Moving back from the end position goes to the tail.
+   * Reports LESS_THAN_INDEX if the cursor is at the head.
+   */
+  int (*prev)(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Get item at the cursor.
+   * @param pd Private data of the linked list.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item at the cursor, NULL at the end position.
+   */
+  void* (*get)(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Add item before the cursor.
+   * @param pd Private data of the linked list.
+   * @param cursor Cursor pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Inserting at the end position appends. The cursor keeps its item.
+   * Keep note that insertAt performs a shallow copy of the data.
+   */
+  void (*insertAt)(privateData* pd, LDSC_listCursor* cursor, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the cursor.
+   * @param pd Private data of the linked list.
+   * @param cursor Cursor pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   * @details
+   * The cursor moves to the item after the removed one.
+   */
+  void* (*removeAt)(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status);
+
+  /**
+   * @brief Move all items of another list before the cursor in O(1).
+   * @param pd Private data of the linked list.
+   * @param cursor Cursor pointer.
+   * @param other Private data of the list whose items are moved, left empty.
+   * @param status Error pointer.
+   * @details
+   * Both lists must use the same allocator and neither may be in arena mode,
+   * otherwise INVALID_ALLOCATOR is reported and nothing is moved.
+   */
+  void (*spliceAt)(privateData* pd, LDSC_listCursor* cursor, privateData* other, LDSC_error* status);
+
+  /**
+   * @brief Add items to the end of the list.
+   * @param pd Private data of the linked list.
+   * @param items Array of data pointers, appended in order.
+   * @param count Number of items.
+   * @param status Error pointer.
+   * @details
+   * Every item is checked before any is added and all nodes are obtained
+   * before the batch is linked in at once, so on NULL_DATAPTR or
+   * NODE_MALLOC the list is left unchanged.
+   * Keep note that appendMany performs a shallow copy of the data.
+   */
+  void (*appendMany)(privateData* pd, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Remove up to count items from the start of the list.
+   * @param pd Private data of the linked list.
+   * @param items Array receiving the data pointers in list order.
+   * @param count Maximum number of items to remove.
+   * @param status Error pointer.
+   * @return Number of items removed, less than count if the list ran empty.
+   */
+  int (*popMany)(privateData* pd, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Move all items of another list to the end in O(1).
+   * @param pd Private data of the linked list.
+   * @param other Private data of the list whose items are moved, left empty.
+   * @param status Error pointer.
+   * @details
+   * Both lists must use the same allocator and neither may be in arena mode,
+   * otherwise INVALID_ALLOCATOR is reported and nothing is moved.
+   */
+  void (*concat)(privateData* pd, privateData* other, LDSC_error* status);
+
+  /**
+   * @brief Move the items in range [from, to) of another list before index.
+   * @param pd Private data of the linked list.
+   * @param index Index the first moved item will have, 0 to length.
+   * @param other Private data of the list whose items are moved.
+   * @param from Index in other of the first item to move.
+   * @param to Index in other one past the last item to move.
+   * @param status Error pointer.
+   * @details
+   * Nodes are relinked, not copied. Finding the range and the insertion point
+   * costs the same walks as at(). The allocator rules of concat apply.
+   */
+  void (*splice)(privateData* pd, int index, privateData* other, int from, int to, LDSC_error* status);
+
+  /**
+   * @brief Call a function on every item from head to tail.
+   * @param pd Private data of the linked list.
+   * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+   * @param ctx User context passed to callback.
+   * @param status Error pointer.
+   */
+  void (*forEach)(privateData* pd, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status);
+
+  /**
+   * @brief Sort the linked list.
+   * @param pd Private data of the linked list.
+   * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+   * @param status Error pointer.
+   * @details
+   * Stable bottom-up merge sort in O(n log n) that relinks the existing nodes
+   * and allocates nothing. Cursors stay on their items.
+   */
+  void (*sort)(privateData* pd, int (*cmp)(const void* a, const void* b), LDSC_error* status);
+
+  /**
+   * @brief Add item in sorted position.
+   * @param pd Private data of the linked list.
+   * @param dataPtr Pointer to data.
+   * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+   * @param status Error pointer.
+   * @details
+   * The list must already be sorted by cmp. The item goes after all items
+   * that compare equal to it, so repeated inserts are stable.
+   * Items not smaller than the tail are appended without a walk.
+   * Keep note that insertSorted performs a shallow copy of the data.
+   */
+  void (*insertSorted)(privateData* pd, void* dataPtr, int (*cmp)(const void* a, const void* b), LDSC_error* status);
+
+  /**
+   * @brief Copy the operation counters of the list.
+   * @param pd Private data of the linked list.
+   * @param out Stats pointer receiving the counters.
+   * @param status Error pointer.
+   * @details
+   * Counters are only kept when the library is built with LDSC_STATS,
+   * otherwise out is zeroed. See LDSC_stats.h.
+   */
+  void (*stats)(privateData* pd, LDSC_stats* out, LDSC_error* status);
+
+  /**
+   * @brief Zero the operation counters of the list.
+   * @param pd Private data of the linked list.
+   * @param status Error pointer.
+   * @details
+   * The high-water length restarts at the current length.
+   */
+  void (*resetStats)(privateData* pd, LDSC_error* status);
+} ;
+
+typedef struct LDSC_linkedListRef LDSC_linkedListRef;
+
+struct LDSC_linkedListRef {
+  /**
+   * @brief Operation table shared by every compact linked list handle.
+   */
+  const LDSC_linkedListOps* ops;
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+} ;
+
+/**
+ * @brief Create a new compact linked list handle.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_linkedListRef.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_init(LDSC_error* status);
+
+/**
+ * @brief Create a new compact linked list handle using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_linkedListRef.
+ * @details
+ * The allocator is used for the handle, its private data and all nodes.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+/**
+ * @brief Create a new compact linked list handle in arena mode.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param slabNodes Number of nodes per slab, 0 for LDSC_ARENA_DEFAULT_SLAB_NODES.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_linkedListRef.
+ * @details
+ * See LDSC_linkedList_init_arena.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_init_arena(const LDSC_allocator* allocator, int slabNodes, LDSC_error* status);
+
+/**
+ * @brief Split the linked list behind a compact handle at index.
+ * @param self Compact linked list handle.
+ * @param index Index of the first item to move out, 0 to length.
+ * @param status Error pointer.
+ * @return New compact handle of a list holding the items from index on, created with the same allocator.
+ * @details
+ * Same as the splitAt method, but the new list gets a compact handle too.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_splitAt(LDSC_linkedListRef* self, int index, LDSC_error* status);
+
+/**
+ * @brief Delete the linked list behind a compact handle.
+ * @param self Compact linked list handle.
+ * @param status Error pointer.
+ */
+void LDSC_linkedListRef_delete(LDSC_linkedListRef* self, LDSC_error* status);
+
+#endif
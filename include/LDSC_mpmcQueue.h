@@ -0,0 +1,89 @@
+#ifndef LDSC_MPMCQUEUE_H
+#define LDSC_MPMCQUEUE_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+typedef struct LDSC_mpmcQueue LDSC_mpmcQueue;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes a bounded multi-producer/multi-consumer queue.
+ * Any number of threads may enqueue and dequeue concurrently.
+ * tryEnqueue and tryDequeue never block; they report STRUCTURE_FULL and STRUCTURE_EMPTY instead.
+ */
+struct LDSC_mpmcQueue {
+  /**
+   * @brief Check is queue is empty.
+   * @param self MPMC queue pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   * @details
+   * The result is a snapshot and may be stale under concurrent use.
+   */
+  int (*empty)(LDSC_mpmcQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Get length of the queue.
+   * @param self MPMC queue pointer.
+   * @param status Error pointer.
+   * @return Length of the queue as integer type.
+   * @details
+   * The result is a snapshot and may be stale under concurrent use.
+   */
+  int (*length)(LDSC_mpmcQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Try to add item to end of the queue.
+   * @param self MPMC queue pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that tryEnqueue performs a shallow copy of the data.
+   * Reports STRUCTURE_FULL when the queue is at capacity.
+   */
+  void (*tryEnqueue)(LDSC_mpmcQueue* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Try to remove item from front of the queue.
+   * @param self MPMC queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   * @details
+   * Reports STRUCTURE_EMPTY and returns NULL when the queue is empty.
+   */
+  void* (*tryDequeue)(LDSC_mpmcQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Delete the queue.
+   * @param self MPMC queue pointer.
+   * @param status Error pointer.
+   * @details
+   * No thread may use the queue during or after delete.
+   */
+  void (*delete)(LDSC_mpmcQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new MPMC queue.
+ * @param capacity Maximum number of items, rounded up to a power of two.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_mpmcQueue.
+ */
+LDSC_mpmcQueue* LDSC_mpmcQueue_init(int capacity, LDSC_error* status);
+
+/**
+ * @brief Create a new MPMC queue using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Maximum number of items, rounded up to a power of two.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_mpmcQueue.
+ */
+LDSC_mpmcQueue* LDSC_mpmcQueue_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status);
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef LDSC_PRIORITYQUEUE_H
+#define LDSC_PRIORITYQUEUE_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/**
+ * @brief Default number of children per heap node.
+ */
+#define LDSC_PRIORITYQUEUE_DEFAULT_ARITY 4
+
+/**
+ * @brief Largest number of children per heap node.
+ */
+#define LDSC_PRIORITYQUEUE_MAX_ARITY 64
+
+/**
+ * @brief Initial capacity of a priority queue.
+ */
+#define LDSC_PRIORITYQUEUE_DEFAULT_CAPACITY 16
+
+typedef struct LDSC_priorityQueue LDSC_priorityQueue;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes an array-backed d-ary heap.
+ * pop and peek return the item comparing smallest under the comparator
+ * given at creation; invert the comparator for largest first. Items with
+ * equal keys leave in no particular order.
+ * Every pushed item gets an integer handle that stays valid until the item
+ * is popped, so its key can be changed later with decreaseKey. Handles of
+ * popped items are reused by later pushes.
+ * A higher arity gives a shallower heap and cheaper push and decreaseKey
+ * at the cost of more comparisons per pop; with 4 or 8 children the
+ * siblings compared by pop share one or two cache lines.
+ */
+struct LDSC_priorityQueue {
+  /**
+   * @brief Get length of the priority queue.
+   * @param self Priority queue pointer.
+   * @param status Error pointer.
+   * @return Length of the priority queue as integer type.
+   */
+  int (*length)(LDSC_priorityQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Check if priority queue is empty.
+   * @param self Priority queue pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(LDSC_priorityQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Add an item to the priority queue.
+   * @param self Priority queue pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @return Handle of the item, ERROR on failure.
+   * @details
+   * O(log n) comparisons. The buffers double in capacity when full.
+   * Keep note that push performs a shallow copy of the data.
+   */
+  int (*push)(LDSC_priorityQueue* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Remove the smallest item from the priority queue.
+   * @param self Priority queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to the smallest item, NULL if the priority queue is empty.
+   * @details
+   * O(arity * log n) comparisons. The handle of the item becomes invalid.
+   */
+  void* (*pop)(LDSC_priorityQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Peek the smallest item of the priority queue.
+   * @param self Priority queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to the smallest item, NULL if the priority queue is empty.
+   */
+  void* (*peek)(LDSC_priorityQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Add many items at once.
+   * @param self Priority queue pointer.
+   * @param items Array of data pointers.
+   * @param count Number of items.
+   * @param handles Array receiving the handle of each item, may be NULL.
+   * @param status Error pointer.
+   * @details
+   * The items are appended and the heap is rebuilt bottom-up in O(n) total,
+   * cheaper than count pushes once count is a sizeable part of the result.
+   * Every item is checked and the buffers are grown before anything is
+   * added, so on NULL_DATAPTR or BUFFER_MALLOC the queue is left unchanged.
+   * Keep note that heapify performs a shallow copy of the data.
+   */
+  void (*heapify)(LDSC_priorityQueue* self, void** items, int count, int* handles, LDSC_error* status);
+
+  /**
+   * @brief Move an item whose key was lowered towards the front.
+   * @param self Priority queue pointer.
+   * @param handle Handle returned when the item was added.
+   * @param dataPtr New pointer to data, may be the old one after changing its key in place.
+   * @param status Error pointer.
+   * @details
+   * O(log n) comparisons. An item whose key grew instead is moved towards
+   * the back, so any key change keeps the heap valid. A handle that was
+   * never issued reports LESS_THAN_INDEX or GREATER_THAN_INDEX, the handle
+   * of a popped item reports ERROR.
+   */
+  void (*decreaseKey)(LDSC_priorityQueue* self, int handle, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Delete the priority queue.
+   * @param self Priority queue pointer.
+   * @param status Error pointer.
+   */
+  void (*delete)(LDSC_priorityQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+} ;
+
+/**
+ * @brief Create a new priority queue.
+ * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_priorityQueue.
+ */
+LDSC_priorityQueue* LDSC_priorityQueue_init(int (*cmp)(const void* a, const void* b), LDSC_error* status);
+
+/**
+ * @brief Create a new priority queue with explicit arity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param arity Children per heap node from 2 to LDSC_PRIORITYQUEUE_MAX_ARITY, 0 for LDSC_PRIORITYQUEUE_DEFAULT_ARITY.
+ * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_priorityQueue.
+ * @details
+ * The allocator is used for the structure, its private data and the buffers.
+ * The structure and its private data share a single allocation.
+ */
+LDSC_priorityQueue* LDSC_priorityQueue_init_with(const LDSC_allocator* allocator, int arity, int (*cmp)(const void* a, const void* b), LDSC_error* status);
+
+#endif
@@ -2,6 +2,8 @@
 #define LDSC_QUEUE_H
 
 #include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+#include <LDSC_stats.h>
 
 typedef struct LDSC_queue LDSC_queue;
 typedef struct privateData privateData;
@@ -49,6 +51,116 @@ struct LDSC_queue {
    */
   void* (*peek)(LDSC_queue* self, LDSC_error* status);
 
+  /**
+   * @brief Add items to end of the queue.
+   * @param self Queue pointer.
+   * @param items Array of data pointers, items[0] is dequeued first.
+   * @param count Number of items.
+   * @param status Error pointer.
+   * @details
+   * Every item is checked before any is added and all nodes are obtained
+   * before the batch is linked in with a single splice, so on NULL_DATAPTR
+   * or NODE_MALLOC the queue is left unchanged.
+   * Keep note that enqueueMany performs a shallow copy of the data.
+   */
+  void (*enqueueMany)(LDSC_queue* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Remove up to count items from front of the queue.
+   * @param self Queue pointer.
+   * @param items Array receiving the data pointers in dequeue order.
+   * @param count Maximum number of items to remove.
+   * @param status Error pointer.
+   * @return Number of items dequeued, less than count if the queue ran empty.
+   */
+  int (*dequeueMany)(LDSC_queue* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Pre-allocate nodes into the node pool.
+   * @param self Queue pointer.
+   * @param count Number of nodes the pool should hold.
+   * @param status Error pointer.
+   * @details
+   * The pool capacity is raised to count if it is smaller.
+   */
+  void (*reserve)(LDSC_queue* self, int count, LDSC_error* status);
+
+  /**
+   * @brief Set the maximum number of recycled nodes kept in the node pool.
+   * @param self Queue pointer.
+   * @param cap Maximum number of pooled nodes, 0 disables pooling.
+   * @param status Error pointer.
+   * @details
+   * Removed nodes are kept for reuse until the pool holds cap nodes.
+   * The default cap is LDSC_NODE_POOL_DEFAULT_CAP.
+   */
+  void (*setPoolCap)(LDSC_queue* self, int cap, LDSC_error* status);
+
+  /**
+   * @brief Copy the operation counters of the queue.
+   * @param self Queue pointer.
+   * @param out Stats pointer receiving the counters.
+   * @param status Error pointer.
+   * @details
+   * Counters are only kept when the library is built with LDSC_STATS,
+   * otherwise out is zeroed. See LDSC_stats.h.
+   */
+  void (*stats)(LDSC_queue* self, LDSC_stats* out, LDSC_error* status);
+
+  /**
+   * @brief Zero the operation counters of the queue.
+   * @param self Queue pointer.
+   * @param status Error pointer.
+   * @details
+   * The high-water length restarts at the current length.
+   */
+  void (*resetStats)(LDSC_queue* self, LDSC_error* status);
+
+  /**
+   * @brief Time every rate-th enqueue and dequeue into latency histograms.
+   * @param self Queue pointer.
+   * @param insertHist Histogram receiving enqueue latencies in nanoseconds, NULL to not time enqueue.
+   * @param removeHist Histogram receiving dequeue latencies in nanoseconds, NULL to not time dequeue.
+   * @param rate Sampling rate, 1 times every call and 0 switches sampling off.
+   * @param status Error pointer.
+   * @details
+   * The sampler is compiled in only when the library is built with
+   * LDSC_TIMING; without it the calls carry no sampling cost and anything
+   * but switching sampling off reports ERROR. With it a call costs one
+   * branch while sampling is off. A dequeue of an empty queue is not
+   * timed. The histograms must stay alive until sampling is switched off or
+   * the queue is deleted.
+   */
+  void (*sampleLatency)(LDSC_queue* self, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status);
+
+  /**
+   * @brief Stamp enqueued items with their enqueue time.
+   * @param self Queue pointer.
+   * @param enable 1 stamps items from now on, 0 stops stamping.
+   * @param residencyHist Histogram receiving the nanoseconds each stamped item spent in the queue when it is dequeued, may be NULL.
+   * @param status Error pointer.
+   * @details
+   * Stamping reads the clock on every enqueue. Items enqueued while it was
+   * off carry no stamp and are not recorded. Stamps are compiled in only
+   * when the library is built with LDSC_TIMING; without it queue nodes stay
+   * two pointers and anything but switching tracking off reports ERROR.
+   * With it a call costs one branch while tracking is off. The histogram
+   * must stay alive until tracking is switched off or the queue is deleted.
+   */
+  void (*trackResidency)(LDSC_queue* self, int enable, LDSC_histogram* residencyHist, LDSC_error* status);
+
+  /**
+   * @brief Get how long the item at the front of the queue has waited.
+   * @param self Queue pointer.
+   * @param status Error pointer.
+   * @return Age of the oldest item in nanoseconds, 0 if the queue is empty or its front item carries no stamp.
+   * @details
+   * The front item is the oldest, so this is the age of the whole backlog;
+   * a growing value means consumers are falling behind. Without
+   * LDSC_TIMING it reports ERROR.
+   */
+  long long (*peekAge)(LDSC_queue* self, LDSC_error* status);
+
   /**
    * @brief Delete the queue.
    * @param self Queue pointer.
@@ -69,4 +181,15 @@ struct LDSC_queue {
  */
 LDSC_queue* LDSC_queue_init(LDSC_error* status);
 
+/**
+ * @brief Create a new queue using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_queue.
+ * @details
+ * The allocator is used for the structure, its private data and all nodes.
+ * The structure and its private data share a single allocation.
+ */
+LDSC_queue* LDSC_queue_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
 #endif
@@ -0,0 +1,179 @@
+#ifndef LDSC_QUEUEFAST_H
+#define LDSC_QUEUEFAST_H
+
+#include <assert.h>
+#include <LDSC_queue.h>
+
+/**
+ * Unchecked inline fast path for LDSC_queue.
+ * These functions skip the NULL checks and status writes of the checked
+ * methods and are inlined into the caller instead of going through the
+ * function pointers of the structure. The caller guarantees that self is a
+ * live queue created by LDSC_queue_init or LDSC_queue_init_with and that
+ * data pointers are not NULL; debug builds assert this, NDEBUG builds
+ * trust it. Fast and checked calls may be mixed freely on the same queue.
+ * The mirrored layouts below depend on LDSC_STATS and LDSC_TIMING, so the
+ * caller must be built with the same settings as the library; with GCC or
+ * Clang a mismatch fails to link on the layout tag.
+ * With LDSC_STATS the fast path updates the same counters as the methods.
+ * With LDSC_TIMING it calls the methods while latency sampling or residency
+ * tracking is on, so every call counts toward the sampling rate and every
+ * item is stamped.
+ */
+
+/**
+ * @brief Node layout of LDSC_queue, mirrored from src/LDSC_queue.c.
+ */
+typedef struct LDSC_queueFastNode {
+  void* dataPtr;
+  struct LDSC_queueFastNode* next;
+#ifdef LDSC_TIMING
+  long long enqueuedAt;
+#endif
+} LDSC_queueFastNode;
+
+/**
+ * @brief Private data layout of LDSC_queue, mirrored from src/LDSC_queue.c.
+ */
+typedef struct LDSC_queueFastData {
+  int length;
+  LDSC_queueFastNode* front;
+  LDSC_queueFastNode* back;
+  LDSC_allocator allocator;
+  LDSC_queueFastNode* pool;
+  int poolSize;
+  int poolCap;
+#ifdef LDSC_TIMING
+  int residencyOn;
+  LDSC_histogram* residencyHist;
+  LDSC_latency insertLatency;
+  LDSC_latency removeLatency;
+#endif
+#ifdef LDSC_STATS
+  LDSC_stats stats;
+#endif
+} LDSC_queueFastData;
+
+/** layout tag defined by src/LDSC_queue.c, see LDSC_LAYOUT_TAG */
+extern const int LDSC_LAYOUT_TAG(LDSC_queue);
+
+#ifdef __GNUC__
+/** reference to the layout tag, so code built with other settings than the library fails to link */
+static const int* const LDSC_queueFast_layout __attribute__((used)) = &LDSC_LAYOUT_TAG(LDSC_queue);
+#endif
+
+#ifdef LDSC_TIMING
+/** nonzero while the queue of pd stamps items with their enqueue time */
+#define LDSC_QUEUE_RESIDENCY_ON(pd) ((pd)->residencyOn)
+#else
+#define LDSC_QUEUE_RESIDENCY_ON(pd) 0
+#endif
+
+void LDSC_queue_enqueue(LDSC_queue* self, void* dataPtr, LDSC_error* status);
+void* LDSC_queue_dequeue(LDSC_queue* self, LDSC_error* status);
+
+/** private data of a queue, asserting in debug builds that it is a plain LDSC_queue */
+static inline LDSC_queueFastData* LDSC_queue_fastData(LDSC_queue* self) {
+  assert(self && self->pd && self->enqueue == &LDSC_queue_enqueue);
+  return (LDSC_queueFastData*)self->pd;
+}
+
+/**
+ * @brief Get length of the queue without checks.
+ * @param self Queue pointer.
+ * @return Length of the queue.
+ */
+static inline int LDSC_queue_length_fast(LDSC_queue* self) {
+  return LDSC_queue_fastData(self)->length;
+}
+
+/**
+ * @brief Check if queue is empty without checks.
+ * @param self Queue pointer.
+ * @return Integer where 1 = empty and 0 = not empty.
+ */
+static inline int LDSC_queue_empty_fast(LDSC_queue* self) {
+  return LDSC_queue_fastData(self)->length == 0;
+}
+
+/**
+ * @brief Add item to end of the queue without checks.
+ * @param self Queue pointer.
+ * @param dataPtr Pointer to data, not NULL.
+ * @return OK, or NODE_MALLOC if no node could be allocated.
+ * @details
+ * A pooled node is linked in inline; with an empty pool the call falls
+ * back to the out of line enqueue to allocate one.
+ */
+static inline LDSC_error LDSC_queue_enqueue_fast(LDSC_queue* self, void* dataPtr) {
+  LDSC_queueFastData* pd = LDSC_queue_fastData(self);
+  assert(dataPtr);
+
+  LDSC_queueFastNode* newNode = pd->pool;
+  if (!newNode || LDSC_LATENCY_ON(pd, insertLatency) || LDSC_QUEUE_RESIDENCY_ON(pd)) {
+    LDSC_error status = OK;
+    LDSC_queue_enqueue(self, dataPtr, &status);
+    return status;
+  }
+
+  pd->pool = newNode->next;
+  pd->poolSize--;
+  newNode->dataPtr = dataPtr;
+  newNode->next = NULL;
+
+  if (!pd->back) pd->front = newNode;
+  else pd->back->next = newNode;
+  pd->back = newNode;
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  return OK;
+}
+
+/**
+ * @brief Remove item from front of the queue without checks.
+ * @param self Queue pointer.
+ * @return Pointer to data at the front of the queue, NULL if it is empty.
+ */
+static inline void* LDSC_queue_dequeue_fast(LDSC_queue* self) {
+  LDSC_queueFastData* pd = LDSC_queue_fastData(self);
+  if (LDSC_LATENCY_ON(pd, removeLatency) || LDSC_QUEUE_RESIDENCY_ON(pd))
+    return LDSC_queue_dequeue(self, NULL);
+
+  LDSC_queueFastNode* oldFront = pd->front;
+  if (!oldFront)
+    return NULL;
+
+  void* dataFront = oldFront->dataPtr;
+  pd->front = oldFront->next;
+  if (!pd->front)
+    pd->back = NULL;
+  pd->length--;
+  LDSC_STATS_ADD(pd, removals, 1);
+
+  if (pd->poolSize < pd->poolCap) {
+    oldFront->next = pd->pool;
+    pd->pool = oldFront;
+    pd->poolSize++;
+  } else {
+    pd->allocator.free(oldFront, sizeof(LDSC_queueFastNode), pd->allocator.context);
+    LDSC_STATS_ADD(pd, nodeFrees, 1);
+  }
+  return dataFront;
+}
+
+/**
+ * @brief Peek item at the front of the queue without checks.
+ * @param self Queue pointer.
+ * @return Pointer to data at the front of the queue, NULL if it is empty.
+ */
+static inline void* LDSC_queue_peek_fast(LDSC_queue* self) {
+  LDSC_queueFastData* pd = LDSC_queue_fastData(self);
+  if (!pd->front)
+    return NULL;
+
+  LDSC_STATS_ADD(pd, lookups, 1);
+  return pd->front->dataPtr;
+}
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef LDSC_QUEUEREF_H
+#define LDSC_QUEUEREF_H
+
+#include <LDSC_queue.h>
+
+/**
+ * Compact handle for LDSC_queue, for programs keeping very many queues.
+ * An LDSC_queue carries its own copy of every method pointer; this handle
+ * carries a single pointer to the operation table shared by all handles,
+ * so each queue costs two pointers plus its private data. An operation
+ * takes the private data of the handle in place of self:
+ *   q->ops->enqueue(q->pd, item, &status);
+ * A NULL pd reports NULL_SELF. Deleting is not an operation, it is done
+ * with LDSC_queueRef_delete on the handle.
+ * The handle and its private data share a single allocation.
+ */
+
+typedef struct LDSC_queueOps LDSC_queueOps;
+
+struct LDSC_queueOps {
+  /**
+   * @brief Check is queue is empty.
+   * @param pd Private data of the queue.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Get length of the queue.
+   * @param pd Private data of the queue.
+   * @param status Error pointer.
+   * @return Length of the stack as integer type.
+   */
+  int (*length)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Add item to end of the queue.
+   * @param pd Private data of the queue.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that enqueue performs a shallow copy of the data.
+   */
+  void (*enqueue)(privateData* pd, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Remove item from fron of the queue.
+   * @param pd Private data of the queue.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   */
+  void* (*dequeue)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Peek item at the front of the queue.
+   * @param pd Private data of the queue.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   */
+  void* (*peek)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Add items to end of the queue.
+   * @param pd Private data of the queue.
+   * @param items Array of data pointers, items[0] is dequeued first.
+   * @param count Number of items.
+   * @param status Error pointer.
+   * @details
+   * Every item is checked before any is added and all nodes are obtained
+   * before the batch is linked in with a single splice, so on NULL_DATAPTR
+   * or NODE_MALLOC the queue is left unchanged.
+   * Keep note that enqueueMany performs a shallow copy of the data.
+   */
+  void (*enqueueMany)(privateData* pd, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Remove up to count items from front of the queue.
+   * @param pd Private data of the queue.
+   * @param items Array receiving the data pointers in dequeue order.
+   * @param count Maximum number of items to remove.
+   * @param status Error pointer.
+   * @return Number of items dequeued, less than count if the queue ran empty.
+   */
+  int (*dequeueMany)(privateData* pd, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Pre-allocate nodes into the node pool.
+   * @param pd Private data of the queue.
+   * @param count Number of nodes the pool should hold.
+   * @param status Error pointer.
+   * @details
+   * The pool capacity is raised to count if it is smaller.
+   */
+  void (*reserve)(privateData* pd, int count, LDSC_error* status);
+
+  /**
+   * @brief Set the maximum number of recycled nodes kept in the node pool.
+   * @param pd Private data of the queue.
+   * @param cap Maximum number of pooled nodes, 0 disables pooling.
+   * @param status Error pointer.
+   * @details
+   * Removed nodes are kept for reuse until the pool holds cap nodes.
+   * The default cap is LDSC_NODE_POOL_DEFAULT_CAP.
+   */
+  void (*setPoolCap)(privateData* pd, int cap, LDSC_error* status);
+
+  /**
+   * @brief Copy the operation counters of the queue.
+   * @param pd Private data of the queue.
+   * @param out Stats pointer receiving the counters.
+   * @param status Error pointer.
+   * @details
+   * Counters are only kept when the library is built with LDSC_STATS,
+   * otherwise out is zeroed. See LDSC_stats.h.
+   */
+  void (*stats)(privateData* pd, LDSC_stats* out, LDSC_error* status);
+
+  /**
+   * @brief Zero the operation counters of the queue.
+   * @param pd Private data of the queue.
+   * @param status Error pointer.
+   * @details
+   * The high-water length restarts at the current length.
+   */
+  void (*resetStats)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Time every rate-th enqueue and dequeue into latency histograms.
+   * @param pd Private data of the queue.
+   * @param insertHist Histogram receiving enqueue latencies in nanoseconds, NULL to not time enqueue.
+   * @param removeHist Histogram receiving dequeue latencies in nanoseconds, NULL to not time dequeue.
+   * @param rate Sampling rate, 1 times every call and 0 switches sampling off.
+   * @param status Error pointer.
+   * @details
+   * The sampler is compiled in only when the library is built with
+   * LDSC_TIMING; without it the calls carry no sampling cost and anything
+   * but switching sampling off reports ERROR. With it a call costs one
+   * branch while sampling is off. A dequeue of an empty queue is not
+   * timed. The histograms must stay alive until sampling is switched off or
+   * the queue is deleted.
+   */
+  void (*sampleLatency)(privateData* pd, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status);
+
+  /**
+   * @brief Stamp enqueued items with their enqueue time.
+   * @param pd Private data of the queue.
+   * @param enable 1 stamps items from now on, 0 stops stamping.
+   * @param residencyHist Histogram receiving the nanoseconds each stamped item spent in the queue when it is dequeued, may be NULL.
+   * @param status Error pointer.
+   * @details
+   * Stamping reads the clock on every enqueue. Items enqueued while it was
+   * off carry no stamp and are not recorded. Stamps are compiled in only
+   * when the library is built with LDSC_TIMING; without it queue nodes stay
+   * two pointers and anything but switching tracking off reports ERROR.
+   * With it a call costs one branch while tracking is off. The histogram
+   * must stay alive until tracking is switched off or the queue is deleted.
+   */
+  void (*trackResidency)(privateData* pd, int enable, LDSC_histogram* residencyHist, LDSC_error* status);
+
+  /**
+   * @brief Get how long the item at the front of the queue has waited.
+   * @param pd Private data of the queue.
+   * @param status Error pointer.
+   * @return Age of the oldest item in nanoseconds, 0 if the queue is empty or its front item carries no stamp.
+   * @details
+   * The front item is the oldest, so this is the age of the whole backlog;
+   * a growing value means consumers are falling behind. Without
+   * LDSC_TIMING it reports ERROR.
+   */
+  long long (*peekAge)(privateData* pd, LDSC_error* status);
+} ;
+
+typedef struct LDSC_queueRef LDSC_queueRef;
+
+struct LDSC_queueRef {
+  /**
+   * @brief Operation table shared by every compact queue handle.
+   */
+  const LDSC_queueOps* ops;
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+} ;
+
+/**
+ * @brief Create a new compact queue handle.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_queueRef.
+ */
+LDSC_queueRef* LDSC_queueRef_init(LDSC_error* status);
+
+/**
+ * @brief Create a new compact queue handle using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_queueRef.
+ * @details
+ * The allocator is used for the handle, its private data and all nodes.
+ */
+LDSC_queueRef* LDSC_queueRef_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+/**
+ * @brief Delete the queue behind a compact handle.
+ * @param self Compact queue handle.
+ * @param status Error pointer.
+ */
+void LDSC_queueRef_delete(LDSC_queueRef* self, LDSC_error* status);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef LDSC_RINGQUEUE_H
+#define LDSC_RINGQUEUE_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/**
+ * @brief Default initial capacity of a growable ring queue.
+ */
+#define LDSC_RINGQUEUE_DEFAULT_CAPACITY 16
+
+typedef struct LDSC_ringQueue LDSC_ringQueue;
+typedef struct privateData privateData;
+
+struct LDSC_ringQueue {
+  /**
+   * @brief Check is queue is empty.
+   * @param self Ring queue pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(LDSC_ringQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Get length of the queue.
+   * @param self Ring queue pointer.
+   * @param status Error pointer.
+   * @return Length of the queue as integer type.
+   */
+  int (*length)(LDSC_ringQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Add item to end of the queue.
+   * @param self Ring queue pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that enqueue performs a shallow copy of the data.
+   * A fixed capacity queue reports STRUCTURE_FULL instead of growing.
+   */
+  void (*enqueue)(LDSC_ringQueue* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Remove item from front of the queue.
+   * @param self Ring queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   */
+  void* (*dequeue)(LDSC_ringQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Peek item at the front of the queue.
+   * @param self Ring queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   */
+  void* (*peek)(LDSC_ringQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Delete the queue.
+   * @param self Ring queue pointer.
+   * @param status Error pointer.
+   */
+  void (*delete)(LDSC_ringQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new growable ring queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_ringQueue.
+ */
+LDSC_ringQueue* LDSC_ringQueue_init(LDSC_error* status);
+
+/**
+ * @brief Create a new ring queue with explicit capacity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Initial capacity, 0 for LDSC_RINGQUEUE_DEFAULT_CAPACITY.
+ * @param fixed Integer where 1 = fixed capacity and 0 = growable.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_ringQueue.
+ * @details
+ * The buffer is rounded up to a power of two and doubles when full.
+ * A fixed capacity queue holds at most capacity items and never grows.
+ */
+LDSC_ringQueue* LDSC_ringQueue_init_with(const LDSC_allocator* allocator, int capacity, int fixed, LDSC_error* status);
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef LDSC_SKIPLIST_H
+#define LDSC_SKIPLIST_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/**
+ * @brief Maximum number of levels of a skip list.
+ */
+#define LDSC_SKIPLIST_MAX_LEVEL 16
+
+typedef struct LDSC_skipList LDSC_skipList;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes an indexable skip list.
+ * Every link of every level stores its span width, the number of items it
+ * skips, so at, add, remove and replace locate an index in expected
+ * O(log n). Nodes get a random height with a 1/4 chance per extra level.
+ * append, prepend and pop only touch the ends and never search.
+ */
+struct LDSC_skipList {
+  /**
+   * @brief Get length of the skip list.
+   * @param self LDSC_skipList pointer.
+   * @param status Error pointer.
+   * @return Length of the skip list as integer type.
+   */
+  int (*length)(LDSC_skipList* self, LDSC_error* status);
+
+  /**
+   * @brief Check if skip list is empty.
+   * @param self LDSC_skipList pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(LDSC_skipList* self, LDSC_error* status);
+
+  /**
+   * @brief Add item at the end of the skip list.
+   * @param self LDSC_skipList pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that append performs a shallow copy of the data.
+   */
+  void (*append)(LDSC_skipList* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add item at the front of the skip list.
+   * @param self LDSC_skipList pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that prepend performs a shallow copy of the data.
+   */
+  void (*prepend)(LDSC_skipList* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add item at index of the skip list.
+   * @param self LDSC_skipList pointer.
+   * @param dataPtr Pointer to data.
+   * @param index Index to add item at.
+   * @param status Error pointer.
+   * @details
+   * Keep note that add performs a shallow copy of the data.
+   */
+  void (*add)(LDSC_skipList* self, void* dataPtr, int index, LDSC_error* status);
+
+  /**
+   * @brief Get item at index.
+   * @param self LDSC_skipList pointer.
+   * @param index Index of item to get.
+   * @param status Error pointer.
+   * @return Data pointer of item at index.
+   */
+  void* (*at)(LDSC_skipList* self, int index, LDSC_error* status);
+
+  /**
+   * @brief Replace item at index.
+   * @param self LDSC_skipList pointer.
+   * @param dataPtr Pointer to data.
+   * @param index Index of item to replace with dataPtr.
+   * @param status Error pointer.
+   * @return Data pointer of item that was replaced.
+   * @details
+   * Keep note that replace performs a shallow copy of the data.
+   */
+  void* (*replace)(LDSC_skipList* self, void* dataPtr, int index, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the front of the list.
+   * @param self LDSC_skipList pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*pop)(LDSC_skipList* self, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the end of the list.
+   * @param self LDSC_skipList pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*pull)(LDSC_skipList* self, LDSC_error* status);
+
+  /**
+   * @brief Remove item at index.
+   * @param self LDSC_skipList pointer.
+   * @param index Index of item to remove.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*remove)(LDSC_skipList* self, int index, LDSC_error* status);
+
+  /**
+   * @brief Remove all items in the list.
+   * @param self LDSC_skipList pointer.
+   * @param status Error pointer.
+   */
+  void (*clear)(LDSC_skipList* self, LDSC_error* status);
+
+  /**
+   * @brief Call a function on every item from head to tail.
+   * @param self LDSC_skipList pointer.
+   * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+   * @param ctx User context passed to callback.
+   * @param status Error pointer.
+   */
+  void (*forEach)(LDSC_skipList* self, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status);
+
+  /**
+   * @brief Delete the skip list.
+   * @param self LDSC_skipList pointer.
+   * @param status Error pointer.
+   */
+  void (*delete)(LDSC_skipList* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new skip list.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_skipList.
+ */
+LDSC_skipList* LDSC_skipList_init(LDSC_error* status);
+
+/**
+ * @brief Create a new skip list using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_skipList.
+ * @details
+ * The allocator is used for the structure, its private data and all nodes.
+ */
+LDSC_skipList* LDSC_skipList_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef LDSC_SPSCQUEUE_H
+#define LDSC_SPSCQUEUE_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+typedef struct LDSC_spscQueue LDSC_spscQueue;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes a bounded single-producer/single-consumer queue.
+ * Exactly one thread may call the producer methods (enqueue, enqueueMany) and
+ * exactly one thread may call the consumer methods (dequeue, dequeueMany, peek).
+ * Both sides are wait-free. length and empty may be called from either side.
+ */
+struct LDSC_spscQueue {
+  /**
+   * @brief Check is queue is empty.
+   * @param self SPSC queue pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(LDSC_spscQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Get length of the queue.
+   * @param self SPSC queue pointer.
+   * @param status Error pointer.
+   * @return Length of the queue as integer type.
+   * @details
+   * The length is a snapshot and may be stale while the other side is active.
+   */
+  int (*length)(LDSC_spscQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Add item to end of the queue. Producer only.
+   * @param self SPSC queue pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that enqueue performs a shallow copy of the data.
+   * Reports STRUCTURE_FULL when the queue is at capacity.
+   */
+  void (*enqueue)(LDSC_spscQueue* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add several items to end of the queue. Producer only.
+   * @param self SPSC queue pointer.
+   * @param items Array of data pointers.
+   * @param count Number of items in the array.
+   * @param status Error pointer.
+   * @return Number of items enqueued.
+   * @details
+   * Enqueues as many items as fit, reporting STRUCTURE_FULL if not all of them did.
+   */
+  int (*enqueueMany)(LDSC_spscQueue* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Remove item from front of the queue. Consumer only.
+   * @param self SPSC queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   */
+  void* (*dequeue)(LDSC_spscQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Remove several items from front of the queue. Consumer only.
+   * @param self SPSC queue pointer.
+   * @param items Array receiving the data pointers.
+   * @param count Maximum number of items to remove.
+   * @param status Error pointer.
+   * @return Number of items dequeued.
+   */
+  int (*dequeueMany)(LDSC_spscQueue* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Peek item at the front of the queue. Consumer only.
+   * @param self SPSC queue pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the front of the queue.
+   */
+  void* (*peek)(LDSC_spscQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Delete the queue.
+   * @param self SPSC queue pointer.
+   * @param status Error pointer.
+   * @details
+   * Neither side may use the queue during or after delete.
+   */
+  void (*delete)(LDSC_spscQueue* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new SPSC queue.
+ * @param capacity Maximum number of items in the queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_spscQueue.
+ */
+LDSC_spscQueue* LDSC_spscQueue_init(int capacity, LDSC_error* status);
+
+/**
+ * @brief Create a new SPSC queue using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Maximum number of items in the queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_spscQueue.
+ */
+LDSC_spscQueue* LDSC_spscQueue_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status);
+
+#endif
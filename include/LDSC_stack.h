@@ -2,6 +2,8 @@
 #define LDSC_STACK_H
 
 #include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+#include <LDSC_stats.h>
 
 typedef struct LDSC_stack LDSC_stack;
 typedef struct privateData privateData;
@@ -49,6 +51,89 @@ struct LDSC_stack {
    */
   void* (*pop)(LDSC_stack* self, LDSC_error* status);
 
+  /**
+   * @brief Push items to the stack.
+   * @param self Stack pointer.
+   * @param items Array of data pointers, pushed in order so items[count - 1] ends on top.
+   * @param count Number of items.
+   * @param status Error pointer.
+   * @details
+   * Every item is checked before any is pushed and all nodes are obtained
+   * before the batch is linked in at once, so on NULL_DATAPTR or
+   * NODE_MALLOC the stack is left unchanged.
+   * Keep note that pushMany performs a shallow copy of the data.
+   */
+  void (*pushMany)(LDSC_stack* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Pop up to count items from the stack.
+   * @param self Stack pointer.
+   * @param items Array receiving the data pointers, items[0] was the top.
+   * @param count Maximum number of items to pop.
+   * @param status Error pointer.
+   * @return Number of items popped, less than count if the stack ran empty.
+   */
+  int (*popMany)(LDSC_stack* self, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Pre-allocate nodes into the node pool.
+   * @param self Stack pointer.
+   * @param count Number of nodes the pool should hold.
+   * @param status Error pointer.
+   * @details
+   * The pool capacity is raised to count if it is smaller.
+   */
+  void (*reserve)(LDSC_stack* self, int count, LDSC_error* status);
+
+  /**
+   * @brief Set the maximum number of recycled nodes kept in the node pool.
+   * @param self Stack pointer.
+   * @param cap Maximum number of pooled nodes, 0 disables pooling.
+   * @param status Error pointer.
+   * @details
+   * Removed nodes are kept for reuse until the pool holds cap nodes.
+   * The default cap is LDSC_NODE_POOL_DEFAULT_CAP.
+   */
+  void (*setPoolCap)(LDSC_stack* self, int cap, LDSC_error* status);
+
+  /**
+   * @brief Copy the operation counters of the stack.
+   * @param self Stack pointer.
+   * @param out Stats pointer receiving the counters.
+   * @param status Error pointer.
+   * @details
+   * Counters are only kept when the library is built with LDSC_STATS,
+   * otherwise out is zeroed. See LDSC_stats.h.
+   */
+  void (*stats)(LDSC_stack* self, LDSC_stats* out, LDSC_error* status);
+
+  /**
+   * @brief Zero the operation counters of the stack.
+   * @param self Stack pointer.
+   * @param status Error pointer.
+   * @details
+   * The high-water length restarts at the current length.
+   */
+  void (*resetStats)(LDSC_stack* self, LDSC_error* status);
+
+  /**
+   * @brief Time every rate-th push and pop into latency histograms.
+   * @param self Stack pointer.
+   * @param insertHist Histogram receiving push latencies in nanoseconds, NULL to not time push.
+   * @param removeHist Histogram receiving pop latencies in nanoseconds, NULL to not time pop.
+   * @param rate Sampling rate, 1 times every call and 0 switches sampling off.
+   * @param status Error pointer.
+   * @details
+   * The sampler is compiled in only when the library is built with
+   * LDSC_TIMING; without it the calls carry no sampling cost and anything
+   * but switching sampling off reports ERROR. With it a call costs one
+   * branch while sampling is off. A pop of an empty stack is not timed. The
+   * histograms must stay alive until sampling is switched off or the stack
+   * is deleted.
+   * The lock-free stack does not sample and reports ERROR when asked to.
+   */
+  void (*sampleLatency)(LDSC_stack* self, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status);
+
   /**
    * @brief Delete the stack.
    * @param self Stack pointer.
@@ -68,4 +153,34 @@ struct LDSC_stack {
  */
 LDSC_stack* LDSC_stack_init(LDSC_error* status);
 
+/**
+ * @brief Create a new stack using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_stack.
+ * @details
+ * The allocator is used for the structure, its private data and all nodes.
+ * The structure and its private data share a single allocation.
+ */
+LDSC_stack* LDSC_stack_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+/**
+ * @brief Create a new lock-free stack.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_stack.
+ * @details
+ * Any number of threads may push and pop concurrently without a lock.
+ * The top is a version-tagged node index updated by CAS, so a pop cannot
+ * be fooled by a node that was popped and pushed again meanwhile (ABA).
+ * pushMany and popMany move their whole batch with a single CAS.
+ * Nodes are kept in a free list until delete instead of being returned to
+ * the allocator, so setPoolCap only validates its argument.
+ * sampleLatency reports ERROR unless it is switching sampling off, since a
+ * histogram cannot be shared by concurrent threads; time calls into
+ * per-thread histograms and merge them instead.
+ * size, empty and peek are snapshots under concurrent use.
+ */
+LDSC_stack* LDSC_stack_init_lockfree(const LDSC_allocator* allocator, LDSC_error* status);
+
 #endif
@@ -0,0 +1,161 @@
+#ifndef LDSC_STACKFAST_H
+#define LDSC_STACKFAST_H
+
+#include <assert.h>
+#include <LDSC_stack.h>
+
+/**
+ * Unchecked inline fast path for LDSC_stack.
+ * These functions skip the NULL checks and status writes of the checked
+ * methods and are inlined into the caller instead of going through the
+ * function pointers of the structure. The caller guarantees that self is a
+ * live stack created by LDSC_stack_init or LDSC_stack_init_with (not the
+ * lock-free variant) and that data pointers are not NULL; debug builds
+ * assert this, NDEBUG builds trust it. Fast and checked calls may be mixed
+ * freely on the same stack.
+ * The mirrored layouts below depend on LDSC_STATS and LDSC_TIMING, so the
+ * caller must be built with the same settings as the library; with GCC or
+ * Clang a mismatch fails to link on the layout tag.
+ * With LDSC_STATS the fast path updates the same counters as the methods.
+ * With LDSC_TIMING it calls the methods while latency sampling is on, so
+ * every call counts toward the sampling rate.
+ */
+
+/**
+ * @brief Node layout of LDSC_stack, mirrored from src/LDSC_stack.c.
+ */
+typedef struct LDSC_stackFastNode {
+  void* dataPtr;
+  struct LDSC_stackFastNode* next;
+} LDSC_stackFastNode;
+
+/**
+ * @brief Private data layout of LDSC_stack, mirrored from src/LDSC_stack.c.
+ */
+typedef struct LDSC_stackFastData {
+  int size;
+  LDSC_stackFastNode* top;
+  LDSC_allocator allocator;
+  LDSC_stackFastNode* pool;
+  int poolSize;
+  int poolCap;
+#ifdef LDSC_TIMING
+  LDSC_latency insertLatency;
+  LDSC_latency removeLatency;
+#endif
+#ifdef LDSC_STATS
+  LDSC_stats stats;
+#endif
+} LDSC_stackFastData;
+
+/** layout tag defined by src/LDSC_stack.c, see LDSC_LAYOUT_TAG */
+extern const int LDSC_LAYOUT_TAG(LDSC_stack);
+
+#ifdef __GNUC__
+/** reference to the layout tag, so code built with other settings than the library fails to link */
+static const int* const LDSC_stackFast_layout __attribute__((used)) = &LDSC_LAYOUT_TAG(LDSC_stack);
+#endif
+
+void LDSC_stack_push(LDSC_stack* self, void* dataPtr, LDSC_error* status);
+void* LDSC_stack_pop(LDSC_stack* self, LDSC_error* status);
+
+/** private data of a stack, asserting in debug builds that it is a plain LDSC_stack */
+static inline LDSC_stackFastData* LDSC_stack_fastData(LDSC_stack* self) {
+  assert(self && self->pd && self->push == &LDSC_stack_push);
+  return (LDSC_stackFastData*)self->pd;
+}
+
+/**
+ * @brief Get size of the stack without checks.
+ * @param self Stack pointer.
+ * @return Size of the stack.
+ */
+static inline int LDSC_stack_size_fast(LDSC_stack* self) {
+  return LDSC_stack_fastData(self)->size;
+}
+
+/**
+ * @brief Check if stack is empty without checks.
+ * @param self Stack pointer.
+ * @return Integer where 1 = empty and 0 = not empty.
+ */
+static inline int LDSC_stack_empty_fast(LDSC_stack* self) {
+  return LDSC_stack_fastData(self)->size == 0;
+}
+
+/**
+ * @brief Push an item to the stack without checks.
+ * @param self Stack pointer.
+ * @param dataPtr Pointer to data, not NULL.
+ * @return OK, or NODE_MALLOC if no node could be allocated.
+ * @details
+ * A pooled node is linked in inline; with an empty pool the call falls
+ * back to the out of line push to allocate one.
+ */
+static inline LDSC_error LDSC_stack_push_fast(LDSC_stack* self, void* dataPtr) {
+  LDSC_stackFastData* pd = LDSC_stack_fastData(self);
+  assert(dataPtr);
+
+  LDSC_stackFastNode* newNode = pd->pool;
+  if (!newNode || LDSC_LATENCY_ON(pd, insertLatency)) {
+    LDSC_error status = OK;
+    LDSC_stack_push(self, dataPtr, &status);
+    return status;
+  }
+
+  pd->pool = newNode->next;
+  pd->poolSize--;
+  newNode->dataPtr = dataPtr;
+  newNode->next = pd->top;
+  pd->top = newNode;
+  pd->size++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->size);
+  return OK;
+}
+
+/**
+ * @brief Pop an item from the stack without checks.
+ * @param self Stack pointer.
+ * @return Pointer to data at the top of the stack, NULL if it is empty.
+ */
+static inline void* LDSC_stack_pop_fast(LDSC_stack* self) {
+  LDSC_stackFastData* pd = LDSC_stack_fastData(self);
+  if (LDSC_LATENCY_ON(pd, removeLatency))
+    return LDSC_stack_pop(self, NULL);
+
+  LDSC_stackFastNode* oldTop = pd->top;
+  if (!oldTop)
+    return NULL;
+
+  void* dataTop = oldTop->dataPtr;
+  pd->top = oldTop->next;
+  pd->size--;
+  LDSC_STATS_ADD(pd, removals, 1);
+
+  if (pd->poolSize < pd->poolCap) {
+    oldTop->next = pd->pool;
+    pd->pool = oldTop;
+    pd->poolSize++;
+  } else {
+    pd->allocator.free(oldTop, sizeof(LDSC_stackFastNode), pd->allocator.context);
+    LDSC_STATS_ADD(pd, nodeFrees, 1);
+  }
+  return dataTop;
+}
+
+/**
+ * @brief Peek item at the top of the stack without checks.
+ * @param self Stack pointer.
+ * @return Pointer to data at the top of the stack, NULL if it is empty.
+ */
+static inline void* LDSC_stack_peek_fast(LDSC_stack* self) {
+  LDSC_stackFastData* pd = LDSC_stack_fastData(self);
+  if (!pd->top)
+    return NULL;
+
+  LDSC_STATS_ADD(pd, lookups, 1);
+  return pd->top->dataPtr;
+}
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef LDSC_STACKREF_H
+#define LDSC_STACKREF_H
+
+#include <LDSC_stack.h>
+
+/**
+ * Compact handle for LDSC_stack, for programs keeping very many stacks.
+ * An LDSC_stack carries its own copy of every method pointer; this handle
+ * carries a single pointer to the operation table shared by all handles,
+ * so each stack costs two pointers plus its private data. An operation
+ * takes the private data of the handle in place of self:
+ *   s->ops->push(s->pd, item, &status);
+ * A NULL pd reports NULL_SELF. Deleting is not an operation, it is done
+ * with LDSC_stackRef_delete on the handle.
+ * The handle and its private data share a single allocation.
+ */
+
+typedef struct LDSC_stackOps LDSC_stackOps;
+
+struct LDSC_stackOps {
+  /**
+   * @brief Get size of the stack.
+   * @param pd Private data of the stack.
+   * @param status Error pointer.
+   * @return Size of the stack as integer type.
+   */
+  int (*size)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Push an item to the stack.
+   * @param pd Private data of the stack.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that push performs a shallow copy of the data.
+   */
+  void (*push)(privateData* pd, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Check if stack is empty.
+   * @param pd Private data of the stack.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty
+   */
+  int (*empty)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Peek item at the top of the stack.
+   * @param pd Private data of the stack.
+   * @param status Error pointer.
+   * @return Pointer to data at the top of the stack.
+   */
+  void* (*peek)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Pop an item from the stack.
+   * @param pd Private data of the stack.
+   * @param status Error pointer.
+   * @return Pointer to data at the top of the stack.
+   */
+  void* (*pop)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Push items to the stack.
+   * @param pd Private data of the stack.
+   * @param items Array of data pointers, pushed in order so items[count - 1] ends on top.
+   * @param count Number of items.
+   * @param status Error pointer.
+   * @details
+   * Every item is checked before any is pushed and all nodes are obtained
+   * before the batch is linked in at once, so on NULL_DATAPTR or
+   * NODE_MALLOC the stack is left unchanged.
+   * Keep note that pushMany performs a shallow copy of the data.
+   */
+  void (*pushMany)(privateData* pd, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Pop up to count items from the stack.
+   * @param pd Private data of the stack.
+   * @param items Array receiving the data pointers, items[0] was the top.
+   * @param count Maximum number of items to pop.
+   * @param status Error pointer.
+   * @return Number of items popped, less than count if the stack ran empty.
+   */
+  int (*popMany)(privateData* pd, void** items, int count, LDSC_error* status);
+
+  /**
+   * @brief Pre-allocate nodes into the node pool.
+   * @param pd Private data of the stack.
+   * @param count Number of nodes the pool should hold.
+   * @param status Error pointer.
+   * @details
+   * The pool capacity is raised to count if it is smaller.
+   */
+  void (*reserve)(privateData* pd, int count, LDSC_error* status);
+
+  /**
+   * @brief Set the maximum number of recycled nodes kept in the node pool.
+   * @param pd Private data of the stack.
+   * @param cap Maximum number of pooled nodes, 0 disables pooling.
+   * @param status Error pointer.
+   * @details
+   * Removed nodes are kept for reuse until the pool holds cap nodes.
+   * The default cap is LDSC_NODE_POOL_DEFAULT_CAP.
+   */
+  void (*setPoolCap)(privateData* pd, int cap, LDSC_error* status);
+
+  /**
+   * @brief Copy the operation counters of the stack.
+   * @param pd Private data of the stack.
+   * @param out Stats pointer receiving the counters.
+   * @param status Error pointer.
+   * @details
+   * Counters are only kept when the library is built with LDSC_STATS,
+   * otherwise out is zeroed. See LDSC_stats.h.
+   */
+  void (*stats)(privateData* pd, LDSC_stats* out, LDSC_error* status);
+
+  /**
+   * @brief Zero the operation counters of the stack.
+   * @param pd Private data of the stack.
+   * @param status Error pointer.
+   * @details
+   * The high-water length restarts at the current length.
+   */
+  void (*resetStats)(privateData* pd, LDSC_error* status);
+
+  /**
+   * @brief Time every rate-th push and pop into latency histograms.
+   * @param pd Private data of the stack.
+   * @param insertHist Histogram receiving push latencies in nanoseconds, NULL to not time push.
+   * @param removeHist Histogram receiving pop latencies in nanoseconds, NULL to not time pop.
+   * @param rate Sampling rate, 1 times every call and 0 switches sampling off.
+   * @param status Error pointer.
+   * @details
+   * The sampler is compiled in only when the library is built with
+   * LDSC_TIMING; without it the calls carry no sampling cost and anything
+   * but switching sampling off reports ERROR. With it a call costs one
+   * branch while sampling is off. A pop of an empty stack is not timed. The
+   * histograms must stay alive until sampling is switched off or the stack
+   * is deleted.
+   * The lock-free stack does not sample and reports ERROR when asked to.
+   */
+  void (*sampleLatency)(privateData* pd, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status);
+} ;
+
+typedef struct LDSC_stackRef LDSC_stackRef;
+
+struct LDSC_stackRef {
+  /**
+   * @brief Operation table shared by every compact stack handle.
+   */
+  const LDSC_stackOps* ops;
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+} ;
+
+/**
+ * @brief Create a new compact stack handle.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_stackRef.
+ */
+LDSC_stackRef* LDSC_stackRef_init(LDSC_error* status);
+
+/**
+ * @brief Create a new compact stack handle using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_stackRef.
+ * @details
+ * The allocator is used for the handle, its private data and all nodes.
+ */
+LDSC_stackRef* LDSC_stackRef_init_with(const LDSC_allocator* allocator, LDSC_error* status);
+
+/**
+ * @brief Delete the stack behind a compact handle.
+ * @param self Compact stack handle.
+ * @param status Error pointer.
+ */
+void LDSC_stackRef_delete(LDSC_stackRef* self, LDSC_error* status);
+
+#endif
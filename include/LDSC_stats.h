@@ -0,0 +1,91 @@
+#ifndef LDSC_STATS_H
+#define LDSC_STATS_H
+
+#include <LDSC_histogram.h>
+
+/**
+ * Operation counters of LDSC_linkedList, LDSC_stack and LDSC_queue.
+ * Counting is compiled in only when the library is built with LDSC_STATS
+ * defined (make LDSC_STATS=1). Without it the private data carries no
+ * counters, the counting macros below expand to nothing and the stats
+ * method reports all zeros.
+ * Latency sampling is compiled in only when the library is built with
+ * LDSC_TIMING defined (make LDSC_TIMING=1). It times every n-th insert and
+ * removal of LDSC_queue and LDSC_stack into an LDSC_histogram, see their
+ * sampleLatency method, and stamps LDSC_queue items to measure how long
+ * they wait, see trackResidency. Without it the private data carries no
+ * sampler, queue nodes carry no stamp, the latency macros below expand to
+ * constants and both methods report ERROR when asked to switch on.
+ * Code using the inline fast paths of LDSC_queueFast.h and LDSC_stackFast.h
+ * must be compiled with the same LDSC_STATS and LDSC_TIMING settings as the
+ * library; with GCC or Clang a mismatch fails to link, see LDSC_LAYOUT_TAG.
+ */
+
+/**
+ * @brief Counters of a single structure.
+ */
+typedef struct LDSC_stats {
+  long inserts;        /**< Items inserted */
+  long removals;       /**< Items removed */
+  long lookups;        /**< Items read or replaced in place */
+  long nodeAllocs;     /**< Nodes obtained from the allocator rather than the pool */
+  long nodeFrees;      /**< Nodes released to the allocator rather than the pool */
+  long nodesTraversed; /**< Nodes walked to reach an index */
+  int highWater;       /**< Largest length reached since creation or reset */
+} LDSC_stats;
+
+/**
+ * @brief Latency sampling state of one kind of operation.
+ */
+typedef struct LDSC_latency {
+  LDSC_histogram* hist; /**< Histogram receiving the samples */
+  int rate;             /**< Every rate-th call is timed, 0 when sampling is off */
+  int countdown;        /**< Calls left until the next timed one */
+} LDSC_latency;
+
+#ifdef LDSC_STATS
+/** add n to a counter of the stats block of pd */
+#define LDSC_STATS_ADD(pd, field, n) ((pd)->stats.field += (n))
+/** raise the high-water length of pd to length */
+#define LDSC_STATS_LENGTH(pd, length) \
+  do { if ((length) > (pd)->stats.highWater) (pd)->stats.highWater = (length); } while (0)
+#else
+#define LDSC_STATS_ADD(pd, field, n) ((void)0)
+#define LDSC_STATS_LENGTH(pd, length) ((void)0)
+#endif
+
+#ifdef LDSC_TIMING
+/** nonzero while the latency sampler kind of pd is on */
+#define LDSC_LATENCY_ON(pd, kind) ((pd)->kind.rate != 0)
+/** start time if this call is due to be timed by the sampler kind of pd, 0 otherwise */
+#define LDSC_LATENCY_START(pd, kind) \
+  ((pd)->kind.rate && --(pd)->kind.countdown == 0 \
+    ? ((pd)->kind.countdown = (pd)->kind.rate, LDSC_histogram_now()) : 0LL)
+/** record the time elapsed since a nonzero start in the histogram of the sampler kind of pd */
+#define LDSC_LATENCY_STOP(pd, kind, start) \
+  do { if (start) (pd)->kind.hist->record((pd)->kind.hist, LDSC_histogram_now() - (start), NULL); } while (0)
+#else
+#define LDSC_LATENCY_ON(pd, kind) 0
+#define LDSC_LATENCY_START(pd, kind) 0LL
+#define LDSC_LATENCY_STOP(pd, kind, start) ((void)(start))
+#endif
+
+/**
+ * @brief Name of the layout tag of a structure built with the current settings.
+ * @details
+ * A structure whose private data is mirrored by a fast path header defines
+ * LDSC_LAYOUT_TAG(its name) and the header references it, so code built with
+ * other LDSC_STATS or LDSC_TIMING settings than the library looks for a tag
+ * the library does not define.
+ */
+#if defined(LDSC_STATS) && defined(LDSC_TIMING)
+#define LDSC_LAYOUT_TAG(name) name##_layout_stats_timing
+#elif defined(LDSC_STATS)
+#define LDSC_LAYOUT_TAG(name) name##_layout_stats
+#elif defined(LDSC_TIMING)
+#define LDSC_LAYOUT_TAG(name) name##_layout_timing
+#else
+#define LDSC_LAYOUT_TAG(name) name##_layout_plain
+#endif
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef LDSC_UNROLLEDLIST_H
+#define LDSC_UNROLLEDLIST_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/**
+ * @brief Default number of items per block of an unrolled list.
+ */
+#define LDSC_UNROLLEDLIST_DEFAULT_BLOCK_ITEMS 32
+
+typedef struct LDSC_unrolledList LDSC_unrolledList;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes an unrolled linked list.
+ * Items are stored in a doubly linked list of blocks holding up to K data
+ * pointers each. A full block splits in two on insert and a block that falls
+ * below half full merges with a neighbour on remove, so no two neighbouring
+ * blocks are both less than half full.
+ */
+struct LDSC_unrolledList {
+  /**
+   * @brief Get length of the unrolled list.
+   * @param self LDSC_unrolledList pointer.
+   * @param status Error pointer.
+   * @return Length of the unrolled list as integer type.
+   */
+  int (*length)(LDSC_unrolledList* self, LDSC_error* status);
+
+  /**
+   * @brief Check if unrolled list is empty.
+   * @param self LDSC_unrolledList pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   */
+  int (*empty)(LDSC_unrolledList* self, LDSC_error* status);
+
+  /**
+   * @brief Add item at the end of the unrolled list.
+   * @param self LDSC_unrolledList pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that append performs a shallow copy of the data.
+   */
+  void (*append)(LDSC_unrolledList* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add item at the front of the unrolled list.
+   * @param self LDSC_unrolledList pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that prepend performs a shallow copy of the data.
+   */
+  void (*prepend)(LDSC_unrolledList* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Add item at index of the unrolled list.
+   * @param self LDSC_unrolledList pointer.
+   * @param dataPtr Pointer to data.
+   * @param index Index to add item at.
+   * @param status Error pointer.
+   * @details
+   * Keep note that add performs a shallow copy of the data.
+   */
+  void (*add)(LDSC_unrolledList* self, void* dataPtr, int index, LDSC_error* status);
+
+  /**
+   * @brief Get item at index.
+   * @param self LDSC_unrolledList pointer.
+   * @param index Index of item to get.
+   * @param status Error pointer.
+   * @return Data pointer of item at index.
+   */
+  void* (*at)(LDSC_unrolledList* self, int index, LDSC_error* status);
+
+  /**
+   * @brief Replace item at index.
+   * @param self LDSC_unrolledList pointer.
+   * @param dataPtr Pointer to data.
+   * @param index Index of item to replace with dataPtr.
+   * @param status Error pointer.
+   * @return Data pointer of item that was replaced.
+   * @details
+   * Keep note that replace performs a shallow copy of the data.
+   */
+  void* (*replace)(LDSC_unrolledList* self, void* dataPtr, int index, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the front of the list.
+   * @param self LDSC_unrolledList pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*pop)(LDSC_unrolledList* self, LDSC_error* status);
+
+  /**
+   * @brief Remove item at the end of the list.
+   * @param self LDSC_unrolledList pointer.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*pull)(LDSC_unrolledList* self, LDSC_error* status);
+
+  /**
+   * @brief Remove item at index.
+   * @param self LDSC_unrolledList pointer.
+   * @param index Index of item to remove.
+   * @param status Error pointer.
+   * @return Data pointer of item that was removed.
+   */
+  void* (*remove)(LDSC_unrolledList* self, int index, LDSC_error* status);
+
+  /**
+   * @brief Remove all items in the list.
+   * @param self LDSC_unrolledList pointer.
+   * @param status Error pointer.
+   */
+  void (*clear)(LDSC_unrolledList* self, LDSC_error* status);
+
+  /**
+   * @brief Call a function on every item from head to tail.
+   * @param self LDSC_unrolledList pointer.
+   * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+   * @param ctx User context passed to callback.
+   * @param status Error pointer.
+   */
+  void (*forEach)(LDSC_unrolledList* self, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status);
+
+  /**
+   * @brief Delete the unrolled list.
+   * @param self LDSC_unrolledList pointer.
+   * @param status Error pointer.
+   */
+  void (*delete)(LDSC_unrolledList* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new unrolled list.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_unrolledList.
+ */
+LDSC_unrolledList* LDSC_unrolledList_init(LDSC_error* status);
+
+/**
+ * @brief Create a new unrolled list with explicit block size and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param blockItems Items per block (K), 0 for LDSC_UNROLLEDLIST_DEFAULT_BLOCK_ITEMS.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_unrolledList.
+ * @details
+ * blockItems must be at least 2 so that a full block can split.
+ */
+LDSC_unrolledList* LDSC_unrolledList_init_with(const LDSC_allocator* allocator, int blockItems, LDSC_error* status);
+
+#endif
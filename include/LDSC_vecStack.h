@@ -0,0 +1,122 @@
+#ifndef LDSC_VECSTACK_H
+#define LDSC_VECSTACK_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/**
+ * @brief Default initial capacity of a vector stack.
+ */
+#define LDSC_VECSTACK_DEFAULT_CAPACITY 16
+
+typedef struct LDSC_vecStack LDSC_vecStack;
+typedef struct privateData privateData;
+
+struct LDSC_vecStack {
+  /**
+   * @brief Get size of the stack.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   * @return Size of the stack as integer type.
+   */
+  int (*size)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Push an item to the stack.
+   * @param self Vector stack pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that push performs a shallow copy of the data.
+   * The buffer doubles in capacity when full.
+   */
+  void (*push)(LDSC_vecStack* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Check if stack is empty.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty
+   */
+  int (*empty)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Peek item at the top of the stack.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the top of the stack.
+   */
+  void* (*peek)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Pop an item from the stack.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   * @return Pointer to data at the top of the stack.
+   * @details
+   * With auto shrink enabled the buffer halves once it is a quarter full,
+   * but never below the initial capacity.
+   */
+  void* (*pop)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Get capacity of the stack.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   * @return Number of items the stack holds before growing.
+   */
+  int (*capacity)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Grow the buffer to hold at least count items.
+   * @param self Vector stack pointer.
+   * @param count Number of items to reserve space for.
+   * @param status Error pointer.
+   */
+  void (*reserve)(LDSC_vecStack* self, int count, LDSC_error* status);
+
+  /**
+   * @brief Shrink the buffer to the current size of the stack.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   */
+  void (*shrinkToFit)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Enable or disable shrinking the buffer on pop.
+   * @param self Vector stack pointer.
+   * @param enabled Integer where 1 = enabled and 0 = disabled.
+   * @param status Error pointer.
+   */
+  void (*setAutoShrink)(LDSC_vecStack* self, int enabled, LDSC_error* status);
+
+  /**
+   * @brief Delete the stack.
+   * @param self Vector stack pointer.
+   * @param status Error pointer.
+   */
+  void (*delete)(LDSC_vecStack* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new vector stack.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_vecStack.
+ */
+LDSC_vecStack* LDSC_vecStack_init(LDSC_error* status);
+
+/**
+ * @brief Create a new vector stack with explicit capacity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Initial capacity, 0 for LDSC_VECSTACK_DEFAULT_CAPACITY.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_vecStack.
+ */
+LDSC_vecStack* LDSC_vecStack_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status);
+
+#endif
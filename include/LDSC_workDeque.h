@@ -0,0 +1,105 @@
+#ifndef LDSC_WORKDEQUE_H
+#define LDSC_WORKDEQUE_H
+
+#include <LDSC_errors.h>
+#include <LDSC_allocator.h>
+
+/** default initial capacity of a work-stealing deque */
+#define LDSC_WORKDEQUE_DEFAULT_CAPACITY 64
+
+typedef struct LDSC_workDeque LDSC_workDeque;
+typedef struct privateData privateData;
+
+/**
+ * The following structure describes a growable work-stealing deque (Chase-Lev).
+ * Exactly one thread, the owner, may call push and pop, which work at the bottom.
+ * Any number of other threads may call steal, which takes from the top.
+ * The buffer doubles when full; replaced buffers are kept until delete because
+ * a thief may still be reading them.
+ */
+struct LDSC_workDeque {
+  /**
+   * @brief Check if deque is empty.
+   * @param self Work deque pointer.
+   * @param status Error pointer.
+   * @return Integer where 1 = empty and 0 = not empty.
+   * @details
+   * The result is a snapshot and may be stale under concurrent use.
+   */
+  int (*empty)(LDSC_workDeque* self, LDSC_error* status);
+
+  /**
+   * @brief Get length of the deque.
+   * @param self Work deque pointer.
+   * @param status Error pointer.
+   * @return Length of the deque as integer type.
+   * @details
+   * The result is a snapshot and may be stale under concurrent use.
+   */
+  int (*length)(LDSC_workDeque* self, LDSC_error* status);
+
+  /**
+   * @brief Push item to the bottom of the deque. Owner only.
+   * @param self Work deque pointer.
+   * @param dataPtr Pointer to data.
+   * @param status Error pointer.
+   * @details
+   * Keep note that push performs a shallow copy of the data.
+   * Reports BUFFER_MALLOC if the deque is full and cannot grow.
+   */
+  void (*push)(LDSC_workDeque* self, void* dataPtr, LDSC_error* status);
+
+  /**
+   * @brief Pop item from the bottom of the deque. Owner only.
+   * @param self Work deque pointer.
+   * @param status Error pointer.
+   * @return Pointer to the most recently pushed data.
+   * @details
+   * Reports STRUCTURE_EMPTY and returns NULL when the deque is empty or the
+   * last item was stolen concurrently.
+   */
+  void* (*pop)(LDSC_workDeque* self, LDSC_error* status);
+
+  /**
+   * @brief Steal item from the top of the deque. Any thread.
+   * @param self Work deque pointer.
+   * @param status Error pointer.
+   * @return Pointer to the oldest data.
+   * @details
+   * Retries when it loses a race against another thief or the owner.
+   * Reports STRUCTURE_EMPTY and returns NULL when the deque is empty.
+   */
+  void* (*steal)(LDSC_workDeque* self, LDSC_error* status);
+
+  /**
+   * @brief Delete the deque.
+   * @param self Work deque pointer.
+   * @param status Error pointer.
+   * @details
+   * No thread may use the deque during or after delete.
+   */
+  void (*delete)(LDSC_workDeque* self, LDSC_error* status);
+
+  /**
+   * @brief Opaque container for private data.
+   */
+  privateData* pd;
+};
+
+/**
+ * @brief Create a new work-stealing deque.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_workDeque.
+ */
+LDSC_workDeque* LDSC_workDeque_init(LDSC_error* status);
+
+/**
+ * @brief Create a new work-stealing deque using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Initial capacity, rounded up to a power of two, 0 for the default.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_workDeque.
+ */
+LDSC_workDeque* LDSC_workDeque_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status);
+
+#endif
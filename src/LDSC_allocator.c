@@ -0,0 +1,29 @@
+#include <LDSC_allocator.h>
+#include <stdlib.h>
+
+/* malloc backed allocation */
+static void* LDSC_allocator_malloc(size_t size, void* context) {
+  (void)context;
+  return malloc(size);
+}
+
+/* free backed release */
+static void LDSC_allocator_free(void* ptr, size_t size, void* context) {
+  (void)size;
+  (void)context;
+  free(ptr);
+}
+
+static const LDSC_allocator defaultAllocator = {
+  .alloc = &LDSC_allocator_malloc,
+  .free = &LDSC_allocator_free,
+  .context = NULL
+};
+
+/**
+ * @brief Get the default allocator.
+ * @return Pointer to an allocator backed by malloc and free.
+ */
+const LDSC_allocator* LDSC_allocator_default(void) {
+  return &defaultAllocator;
+}
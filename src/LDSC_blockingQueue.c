@@ -0,0 +1,360 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <LDSC_blockingQueue.h>
+#include <LDSC_queue.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+  * @brief Opaque container for private data.
+  */
+struct privateData {
+  LDSC_queue* queue;
+  int capacity;
+  int closed;
+  pthread_mutex_t lock;
+  pthread_cond_t notEmpty;
+  pthread_cond_t notFull;
+  LDSC_allocator allocator;
+};
+
+/** absolute CLOCK_MONOTONIC deadline timeoutMs milliseconds from now */
+static struct timespec BlockingQueue_deadline(long timeoutMs) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_MONOTONIC, &deadline);
+  deadline.tv_sec += timeoutMs / 1000;
+  deadline.tv_nsec += (timeoutMs % 1000) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  return deadline;
+}
+
+/** wait for an item with the lock held, until closed or past an optional deadline */
+static LDSC_error BlockingQueue_waitItem(privateData* pd, const struct timespec* deadline) {
+  while (pd->queue->empty(pd->queue, NULL)) {
+    if (pd->closed)
+      return STRUCTURE_CLOSED;
+
+    if (!deadline) {
+      pthread_cond_wait(&pd->notEmpty, &pd->lock);
+      continue;
+    }
+
+    if (pthread_cond_timedwait(&pd->notEmpty, &pd->lock, deadline) == ETIMEDOUT
+        && pd->queue->empty(pd->queue, NULL))
+      return pd->closed ? STRUCTURE_CLOSED : TIMED_OUT;
+  }
+  return OK;
+}
+
+/** remove the front item, waiting until an optional deadline */
+static void* BlockingQueue_take(privateData* pd, const struct timespec* deadline, LDSC_error* status) {
+  pthread_mutex_lock(&pd->lock);
+
+  LDSC_error result = BlockingQueue_waitItem(pd, deadline);
+  void* dataFront = NULL;
+  if (result == OK) {
+    dataFront = pd->queue->dequeue(pd->queue, NULL);
+    if (pd->capacity)
+      pthread_cond_signal(&pd->notFull);
+  }
+
+  pthread_mutex_unlock(&pd->lock);
+
+  if (status) *status = result;
+  return dataFront;
+}
+
+/**************************************************/
+/* LDSC_blockingQueue */
+
+/**
+  * @brief Check is queue is empty.
+  * @param self Blocking queue pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_blockingQueue_empty(LDSC_blockingQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  pthread_mutex_lock(&self->pd->lock);
+  int empty = self->pd->queue->empty(self->pd->queue, NULL);
+  pthread_mutex_unlock(&self->pd->lock);
+  return empty;
+}
+
+/**
+  * @brief Get length of the queue.
+  * @param self Blocking queue pointer.
+  * @param status Error pointer.
+  * @return Length of the queue as integer type.
+  */
+int LDSC_blockingQueue_length(LDSC_blockingQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  pthread_mutex_lock(&self->pd->lock);
+  int length = self->pd->queue->length(self->pd->queue, NULL);
+  pthread_mutex_unlock(&self->pd->lock);
+  return length;
+}
+
+/**
+  * @brief Add item to end of the queue, waiting for room if the queue is bounded.
+  * @param self Blocking queue pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that enqueue performs a shallow copy of the data.
+  */
+void LDSC_blockingQueue_enqueue(LDSC_blockingQueue* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  LDSC_error result = OK;
+  pthread_mutex_lock(&pd->lock);
+
+  while (!pd->closed && pd->capacity && pd->queue->length(pd->queue, NULL) >= pd->capacity)
+    pthread_cond_wait(&pd->notFull, &pd->lock);
+
+  if (pd->closed) {
+    result = STRUCTURE_CLOSED;
+  } else {
+    pd->queue->enqueue(pd->queue, dataPtr, &result);
+    if (result == OK)
+      pthread_cond_signal(&pd->notEmpty);
+  }
+
+  pthread_mutex_unlock(&pd->lock);
+
+  if (status) *status = result;
+  return;
+}
+
+/**
+  * @brief Remove item from front of the queue, waiting until one is available.
+  * @param self Blocking queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_blockingQueue_dequeue(LDSC_blockingQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  return BlockingQueue_take(self->pd, NULL, status);
+}
+
+/**
+  * @brief Remove item from front of the queue, waiting at most timeoutMs milliseconds.
+  * @param self Blocking queue pointer.
+  * @param timeoutMs Maximum wait in milliseconds.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_blockingQueue_dequeueTimed(LDSC_blockingQueue* self, long timeoutMs, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (timeoutMs < 0)
+    timeoutMs = 0;
+
+  struct timespec deadline = BlockingQueue_deadline(timeoutMs);
+  return BlockingQueue_take(self->pd, &deadline, status);
+}
+
+/**
+  * @brief Remove up to count items, waiting until at least one is available.
+  * @param self Blocking queue pointer.
+  * @param items Array receiving the data pointers.
+  * @param count Maximum number of items to remove.
+  * @param status Error pointer.
+  * @return Number of items dequeued.
+  */
+int LDSC_blockingQueue_dequeueMany(LDSC_blockingQueue* self, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  if (!count)
+    return 0;
+
+  privateData* pd = self->pd;
+  pthread_mutex_lock(&pd->lock);
+
+  LDSC_error result = BlockingQueue_waitItem(pd, NULL);
+  int total = 0;
+  if (result == OK) {
+    total = pd->queue->dequeueMany(pd->queue, items, count, NULL);
+    if (pd->capacity)
+      pthread_cond_broadcast(&pd->notFull);
+  }
+
+  pthread_mutex_unlock(&pd->lock);
+
+  if (status) *status = result;
+  return total;
+}
+
+/**
+  * @brief Close the queue and wake all waiting threads.
+  * @param self Blocking queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_blockingQueue_close(LDSC_blockingQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  pthread_mutex_lock(&self->pd->lock);
+  self->pd->closed = 1;
+  pthread_cond_broadcast(&self->pd->notEmpty);
+  pthread_cond_broadcast(&self->pd->notFull);
+  pthread_mutex_unlock(&self->pd->lock);
+  return;
+}
+
+/**
+  * @brief Delete the queue.
+  * @param self Blocking queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_blockingQueue_delete(LDSC_blockingQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  self->pd->queue->delete(self->pd->queue, status);
+  pthread_cond_destroy(&self->pd->notFull);
+  pthread_cond_destroy(&self->pd->notEmpty);
+  pthread_mutex_destroy(&self->pd->lock);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_blockingQueue), allocator.context);
+  return;
+}
+
+/**
+ * @brief Create a new unbounded blocking queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_blockingQueue.
+ */
+LDSC_blockingQueue* LDSC_blockingQueue_init(LDSC_error* status) {
+  return LDSC_blockingQueue_init_with(NULL, 0, status);
+}
+
+/**
+ * @brief Create a new blocking queue with explicit capacity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Maximum number of items, 0 for unbounded.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_blockingQueue.
+ */
+LDSC_blockingQueue* LDSC_blockingQueue_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (capacity < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_blockingQueue* newQueue = allocator->alloc(sizeof(LDSC_blockingQueue), allocator->context);
+  if (!newQueue) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newQueue->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newQueue->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newQueue, sizeof(LDSC_blockingQueue), allocator->context);
+    return NULL;
+  }
+
+  newQueue->pd->queue = LDSC_queue_init_with(allocator, status);
+  if (!newQueue->pd->queue) {
+    allocator->free(newQueue->pd, sizeof(privateData), allocator->context);
+    allocator->free(newQueue, sizeof(LDSC_blockingQueue), allocator->context);
+    return NULL;
+  }
+
+  pthread_condattr_t condAttr;
+  pthread_condattr_init(&condAttr);
+  pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+  pthread_mutex_init(&newQueue->pd->lock, NULL);
+  pthread_cond_init(&newQueue->pd->notEmpty, &condAttr);
+  pthread_cond_init(&newQueue->pd->notFull, NULL);
+  pthread_condattr_destroy(&condAttr);
+
+  newQueue->pd->capacity = capacity;
+  newQueue->pd->closed = 0;
+  newQueue->pd->allocator = *allocator;
+
+  newQueue->empty = &LDSC_blockingQueue_empty;
+  newQueue->length = &LDSC_blockingQueue_length;
+  newQueue->enqueue = &LDSC_blockingQueue_enqueue;
+  newQueue->dequeue = &LDSC_blockingQueue_dequeue;
+  newQueue->dequeueTimed = &LDSC_blockingQueue_dequeueTimed;
+  newQueue->dequeueMany = &LDSC_blockingQueue_dequeueMany;
+  newQueue->close = &LDSC_blockingQueue_close;
+  newQueue->delete = &LDSC_blockingQueue_delete;
+
+  return newQueue;
+}
+
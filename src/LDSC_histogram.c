@@ -0,0 +1,364 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <LDSC_histogram.h>
+#include <string.h>
+#include <time.h>
+
+/** log2 of LDSC_HISTOGRAM_SUB_BUCKETS */
+#define HISTOGRAM_SUB_BITS 6
+/** bits of LDSC_HISTOGRAM_MAX_VALUE */
+#define HISTOGRAM_VALUE_BITS 42
+/** buckets needed to cover 0 to LDSC_HISTOGRAM_MAX_VALUE */
+#define HISTOGRAM_BUCKETS ((HISTOGRAM_VALUE_BITS - HISTOGRAM_SUB_BITS + 1) * LDSC_HISTOGRAM_SUB_BUCKETS)
+
+_Static_assert((1 << HISTOGRAM_SUB_BITS) == LDSC_HISTOGRAM_SUB_BUCKETS, "HISTOGRAM_SUB_BITS matches LDSC_HISTOGRAM_SUB_BUCKETS");
+_Static_assert((1LL << HISTOGRAM_VALUE_BITS) - 1 == LDSC_HISTOGRAM_MAX_VALUE, "HISTOGRAM_VALUE_BITS matches LDSC_HISTOGRAM_MAX_VALUE");
+
+/**
+  * @brief Opaque container for private data.
+  */
+struct privateData {
+  long total;
+  long long min;
+  long long max;
+  long long sum;
+  LDSC_allocator allocator;
+  long counts[HISTOGRAM_BUCKETS];
+};
+
+/** structure and private data allocated as one block */
+typedef struct Instance {
+  LDSC_histogram self;
+  privateData pd;
+} Instance;
+
+/** index of the most significant set bit of a positive value */
+static int Histogram_msb(long long value) {
+#if defined(__GNUC__)
+  return 63 - __builtin_clzll((unsigned long long)value);
+#else
+  int msb = 0;
+  while (value >>= 1) msb++;
+  return msb;
+#endif
+}
+
+/** bucket holding value */
+static int Histogram_index(long long value) {
+  if (value > LDSC_HISTOGRAM_MAX_VALUE) value = LDSC_HISTOGRAM_MAX_VALUE;
+  if (value < 2 * LDSC_HISTOGRAM_SUB_BUCKETS) return (int)value;
+
+  int shift = Histogram_msb(value) - HISTOGRAM_SUB_BITS;
+  return (shift + 1) * LDSC_HISTOGRAM_SUB_BUCKETS + (int)(value >> shift) - LDSC_HISTOGRAM_SUB_BUCKETS;
+}
+
+/** largest value falling into bucket index */
+static long long Histogram_highest(int index) {
+  if (index < 2 * LDSC_HISTOGRAM_SUB_BUCKETS) return index;
+
+  int shift = index / LDSC_HISTOGRAM_SUB_BUCKETS - 1;
+  long long mantissa = index % LDSC_HISTOGRAM_SUB_BUCKETS + LDSC_HISTOGRAM_SUB_BUCKETS;
+  return ((mantissa + 1) << shift) - 1;
+}
+
+/** forget all values recorded in pd */
+static void Histogram_clear(privateData* pd) {
+  pd->total = 0;
+  pd->min = 0;
+  pd->max = 0;
+  pd->sum = 0;
+  memset(pd->counts, 0, sizeof(pd->counts));
+}
+
+/**************************************************/
+/* LDSC_histogram */
+
+/**
+  * @brief Record a value.
+  * @param self Histogram pointer.
+  * @param value Value to record, at least 0.
+  * @param status Error pointer.
+  */
+void LDSC_histogram_record(LDSC_histogram* self, long long value, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (value < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  if (!pd->total || value < pd->min) pd->min = value;
+  if (value > pd->max) pd->max = value;
+  pd->counts[Histogram_index(value)]++;
+  pd->sum += value;
+  pd->total++;
+  return;
+}
+
+/**
+  * @brief Get the number of recorded values.
+  * @param self Histogram pointer.
+  * @param status Error pointer.
+  * @return Number of values recorded since creation or reset.
+  */
+long LDSC_histogram_count(LDSC_histogram* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->total;
+}
+
+/**
+  * @brief Get the smallest recorded value.
+  * @param self Histogram pointer.
+  * @param status Error pointer.
+  * @return Smallest value.
+  */
+long long LDSC_histogram_min(LDSC_histogram* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!self->pd->total) {
+    if (status) *status = STRUCTURE_EMPTY;
+    return 0;
+  }
+
+  return self->pd->min;
+}
+
+/**
+  * @brief Get the largest recorded value.
+  * @param self Histogram pointer.
+  * @param status Error pointer.
+  * @return Largest value.
+  */
+long long LDSC_histogram_max(LDSC_histogram* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!self->pd->total) {
+    if (status) *status = STRUCTURE_EMPTY;
+    return 0;
+  }
+
+  return self->pd->max;
+}
+
+/**
+  * @brief Get the mean of the recorded values.
+  * @param self Histogram pointer.
+  * @param status Error pointer.
+  * @return Mean of the recorded values.
+  */
+double LDSC_histogram_mean(LDSC_histogram* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!self->pd->total) {
+    if (status) *status = STRUCTURE_EMPTY;
+    return 0;
+  }
+
+  return (double)self->pd->sum / (double)self->pd->total;
+}
+
+/**
+  * @brief Get the value at a percentile.
+  * @param self Histogram pointer.
+  * @param percentile Percentile from 0 to 100.
+  * @param status Error pointer.
+  * @return Value that percentile of the recorded values are at or below.
+  * @details
+  * The buckets are walked from the smallest until their counts reach
+  * percentile / 100 * count, rounded to the nearest rank.
+  */
+long long LDSC_histogram_percentile(LDSC_histogram* self, double percentile, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (percentile < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return 0;
+  }
+
+  if (percentile > 100) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return 0;
+  }
+
+  privateData* pd = self->pd;
+  if (!pd->total) {
+    if (status) *status = STRUCTURE_EMPTY;
+    return 0;
+  }
+
+  long rank = (long)(percentile / 100 * (double)pd->total + 0.5);
+  if (rank < 1) return pd->min;
+
+  long seen = 0;
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    seen += pd->counts[i];
+    if (seen >= rank) {
+      long long value = Histogram_highest(i);
+      return value < pd->max && i < HISTOGRAM_BUCKETS - 1 ? value : pd->max;
+    }
+  }
+  return pd->max;
+}
+
+/**
+  * @brief Add the values recorded in another histogram.
+  * @param self Histogram pointer.
+  * @param other Histogram to merge in.
+  * @param status Error pointer.
+  */
+void LDSC_histogram_merge(LDSC_histogram* self, LDSC_histogram* other, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!other) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  privateData* src = other->pd;
+  if (!src->total)
+    return;
+
+  if (!pd->total || src->min < pd->min) pd->min = src->min;
+  if (src->max > pd->max) pd->max = src->max;
+  pd->sum += src->sum;
+  pd->total += src->total;
+  for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    pd->counts[i] += src->counts[i];
+  return;
+}
+
+/**
+  * @brief Forget all recorded values.
+  * @param self Histogram pointer.
+  * @param status Error pointer.
+  */
+void LDSC_histogram_reset(LDSC_histogram* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  Histogram_clear(self->pd);
+  return;
+}
+
+/**
+  * @brief Delete the histogram.
+  * @param self Histogram pointer.
+  * @param status Error pointer.
+  */
+void LDSC_histogram_delete(LDSC_histogram* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(Instance), allocator.context);
+  return;
+}
+
+/** method table copied into every new histogram */
+static const LDSC_histogram LDSC_histogram_methods = {
+  .record = &LDSC_histogram_record,
+  .count = &LDSC_histogram_count,
+  .min = &LDSC_histogram_min,
+  .max = &LDSC_histogram_max,
+  .mean = &LDSC_histogram_mean,
+  .percentile = &LDSC_histogram_percentile,
+  .merge = &LDSC_histogram_merge,
+  .reset = &LDSC_histogram_reset,
+  .delete = &LDSC_histogram_delete
+};
+
+/**
+ * @brief Create a new histogram.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_histogram.
+ */
+LDSC_histogram* LDSC_histogram_init(LDSC_error* status) {
+  return LDSC_histogram_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new histogram using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_histogram.
+ */
+LDSC_histogram* LDSC_histogram_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  Instance* instance = allocator->alloc(sizeof(Instance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  LDSC_histogram* newHistogram = &instance->self;
+  *newHistogram = LDSC_histogram_methods;
+  newHistogram->pd = &instance->pd;
+
+  newHistogram->pd->allocator = *allocator;
+  Histogram_clear(newHistogram->pd);
+
+  return newHistogram;
+}
+
+/**
+ * @brief Read the monotonic clock.
+ * @return CLOCK_MONOTONIC time in nanoseconds.
+ */
+long long LDSC_histogram_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
@@ -1,5 +1,6 @@
 #include "LDSC_errors.h"
 #include <LDSC_linkedList.h>
+#include <LDSC_linkedListRef.h>
 #include <stdlib.h>
 
 /** node structure */
@@ -9,81 +10,252 @@ typedef struct Node {
   struct Node* prev;
 } Node;
 
-/** create and return a new linked list node */
-static Node* Node_init(void* dataPtrIn) {
-  Node* newNode = (Node*)malloc(sizeof(Node));
+/** slab of contiguous nodes used in arena mode */
+typedef struct Slab {
+  struct Slab* next;
+  Node nodes[];
+} Slab;
+
+/* private data structure */
+struct privateData {
+  int length;
+  Node* head;
+  Node* tail;
+  LDSC_allocator allocator;
+  Node* pool;
+  int poolSize;
+  int poolCap;
+  Slab* slabs;
+  int slabNodes;
+  int slabUsed;
+  Node* finger;
+  int fingerIndex;
+#ifdef LDSC_STATS
+  LDSC_stats stats;
+#endif
+};
+
+/** structure and private data allocated as one block */
+typedef struct Instance {
+  LDSC_linkedList self;
+  privateData pd;
+} Instance;
+
+/** compact handle and private data allocated as one block */
+typedef struct RefInstance {
+  LDSC_linkedListRef ref;
+  privateData pd;
+} RefInstance;
+
+/** carve a node out of the current slab, allocating a new slab when it is full */
+static Node* Slab_carve(privateData* pd) {
+  if (!pd->slabs || pd->slabUsed == pd->slabNodes) {
+    size_t slabBytes = sizeof(Slab) + (size_t)pd->slabNodes * sizeof(Node);
+    Slab* newSlab = (Slab*)pd->allocator.alloc(slabBytes, pd->allocator.context);
+    if (!newSlab) return NULL;
+
+    newSlab->next = pd->slabs;
+    pd->slabs = newSlab;
+    pd->slabUsed = 0;
+  }
+
+  return &pd->slabs->nodes[pd->slabUsed++];
+}
+
+/** release every slab and forget all nodes carved from them */
+static void Slab_releaseAll(privateData* pd) {
+  size_t slabBytes = sizeof(Slab) + (size_t)pd->slabNodes * sizeof(Node);
+  while (pd->slabs) {
+    Slab* nextSlab = pd->slabs->next;
+    pd->allocator.free(pd->slabs, slabBytes, pd->allocator.context);
+    pd->slabs = nextSlab;
+  }
+
+  pd->slabUsed = 0;
+  pd->pool = NULL;
+  pd->poolSize = 0;
+  pd->head = NULL;
+  pd->tail = NULL;
+  pd->length = 0;
+  pd->finger = NULL;
+}
+
+/** allocate an uninitialized node from the slabs in arena mode or the allocator otherwise */
+static Node* Node_alloc(privateData* pd) {
+  Node* newNode;
+  if (pd->slabNodes)
+    newNode = Slab_carve(pd);
+  else
+    newNode = (Node*)pd->allocator.alloc(sizeof(Node), pd->allocator.context);
   if (!newNode) return NULL;
 
+  LDSC_STATS_ADD(pd, nodeAllocs, 1);
+  return newNode;
+}
+
+/** create and return a new linked list node, reusing a pooled node if available */
+static Node* Node_init(privateData* pd, void* dataPtrIn) {
+  Node* newNode = pd->pool;
+  if (newNode) {
+    pd->pool = newNode->next;
+    pd->poolSize--;
+  } else {
+    newNode = Node_alloc(pd);
+    if (!newNode) return NULL;
+  }
+
   newNode->dataPtr = dataPtrIn;
   newNode->next = NULL;
   newNode->prev = NULL;
   return newNode;
 }
 
-/* private data structure */
-struct privateData {
-  int length;
-  Node* head;
-  Node* tail;
-};
+/** release a linked list node, keeping it in the pool if there is room or it belongs to a slab */
+static void Node_free(privateData* pd, Node* node) {
+  if (pd->slabNodes || pd->poolSize < pd->poolCap) {
+    node->next = pd->pool;
+    pd->pool = node;
+    pd->poolSize++;
+    return;
+  }
+  pd->allocator.free(node, sizeof(Node), pd->allocator.context);
+  LDSC_STATS_ADD(pd, nodeFrees, 1);
+}
 
-/* get node of linkedd list at index */
-static Node* LDSC_linkedList_getNode(LDSC_linkedList* self, int index) {
-  Node* currNode = self->pd->head;
-  for (int i = 0; i < index; i++)
+/** release pooled nodes until the pool holds at most count nodes */
+static void Node_trimPool(privateData* pd, int count) {
+  if (pd->slabNodes) return;
+
+  while (pd->poolSize > count) {
+    Node* node = pd->pool;
+    pd->pool = node->next;
+    pd->poolSize--;
+    pd->allocator.free(node, sizeof(Node), pd->allocator.context);
+    LDSC_STATS_ADD(pd, nodeFrees, 1);
+  }
+}
+
+/** link the chain first..last before nextNode, or at the tail if nextNode is NULL */
+static void Node_linkBefore(privateData* pd, Node* first, Node* last, Node* nextNode) {
+  Node* prevNode = nextNode ? nextNode->prev : pd->tail;
+
+  first->prev = prevNode;
+  last->next = nextNode;
+
+  if (prevNode) prevNode->next = first;
+  else pd->head = first;
+
+  if (nextNode) nextNode->prev = last;
+  else pd->tail = last;
+}
+
+/** unlink the chain first..last from the list */
+static void Node_unlink(privateData* pd, Node* first, Node* last) {
+  if (first->prev) first->prev->next = last->next;
+  else pd->head = last->next;
+
+  if (last->next) last->next->prev = first->prev;
+  else pd->tail = first->prev;
+}
+
+/** whether nodes may move between two lists: same allocator and no arena */
+static int LDSC_linkedList_compatible(privateData* a, privateData* b) {
+  return !a->slabNodes && !b->slabNodes &&
+         a->allocator.alloc == b->allocator.alloc &&
+         a->allocator.free == b->allocator.free &&
+         a->allocator.context == b->allocator.context;
+}
+
+/** forget the cached finger, called whenever node indices shift */
+static void Finger_reset(privateData* pd) {
+  pd->finger = NULL;
+}
+
+/**
+  * @brief Get node of linked list at index.
+  * @details
+  * The walk starts from whichever of head, tail and the finger (the node
+  * returned by the previous lookup) is closest to index, moving forward
+  * or backward. The found node becomes the new finger.
+  */
+static Node* LDSC_linkedList_getNode(privateData* pd, int index) {
+  Node* currNode = pd->head;
+  int currIndex = 0;
+  int distance = index;
+
+  if (pd->length - 1 - index < distance) {
+    currNode = pd->tail;
+    currIndex = pd->length - 1;
+    distance = currIndex - index;
+  }
+
+  if (pd->finger && abs(index - pd->fingerIndex) < distance) {
+    currNode = pd->finger;
+    currIndex = pd->fingerIndex;
+  }
+  LDSC_STATS_ADD(pd, nodesTraversed, abs(index - currIndex));
+
+  for (; currIndex < index; currIndex++)
     currNode = currNode->next;
+  for (; currIndex > index; currIndex--)
+    currNode = currNode->prev;
+
+  pd->finger = currNode;
+  pd->fingerIndex = index;
   return currNode;
 }
 
+/** set up empty private data using allocator */
+static void List_setup(privateData* pd, const LDSC_allocator* allocator) {
+  pd->length = 0;
+  pd->head = NULL;
+  pd->tail = NULL;
+  pd->allocator = *allocator;
+  pd->pool = NULL;
+  pd->poolSize = 0;
+  pd->poolCap = LDSC_NODE_POOL_DEFAULT_CAP;
+  pd->slabs = NULL;
+  pd->slabNodes = 0;
+  pd->slabUsed = 0;
+  pd->finger = NULL;
+  pd->fingerIndex = 0;
+#ifdef LDSC_STATS
+  pd->stats = (LDSC_stats){ 0 };
+#endif
+}
+
 /**************************************************/
-/* LDSC_linkedList */
+/* operations on the private data of a list, a NULL pd reports NULL_SELF */
 
-/**
-  * @brief Get length of the linked list.
-  * @param self LDSC_linkedList pointer.
-  * @param status Error pointer.
-  * @return Length of the linked list as integer type.
-  */
-int LDSC_linkedList_length(LDSC_linkedList* self, LDSC_error* status) {
+/** get length of the linked list */
+static int List_length(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return ERROR;
   }
 
-  return self->pd->length;
+  return pd->length;
 }
 
-/**
-  * @brief Check if linked list is empty.
-  * @param self LDSC_linkedList pointer.
-  * @param status Error pointer.
-  * @return Integer where 1 = empty and 0 = not empty.
-  */
-int LDSC_linkedList_empty(LDSC_linkedList* self, LDSC_error* status) {
+/** check if linked list is empty */
+static int List_empty(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return ERROR;
   }
 
-  return self->pd->length == 0;
+  return pd->length == 0;
 }
 
-/**
-  * @brief Add item at the end of the linked list.
-  * @param self LDSC_linkedList pointer.
-  * @param dataPtr Pointer to data.
-  * @param status Error pointer.
-  * @details
-  * Keep note that prepend performs a shallow copy of the data.
-  */
-void LDSC_linkedList_append(LDSC_linkedList* self, void* dataPtr, LDSC_error* status) {
+/** add item at the end of the linked list */
+static void List_append(privateData* pd, void* dataPtr, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
@@ -93,36 +265,31 @@ void LDSC_linkedList_append(LDSC_linkedList* self, void* dataPtr, LDSC_error* st
     return;
   }
 
-  Node* newNode = Node_init(dataPtr);
+  Node* newNode = Node_init(pd, dataPtr);
   if (!newNode) {
     if (status) *status = NODE_MALLOC;
     return;
   }
 
-  if (!self->pd->tail) {
-    self->pd->head = newNode;
+  if (!pd->tail) {
+    pd->head = newNode;
   } else {
-    self->pd->tail->next = newNode;
-    newNode->prev = self->pd->tail;
+    pd->tail->next = newNode;
+    newNode->prev = pd->tail;
   }
-  self->pd->tail = newNode;
+  pd->tail = newNode;
   
-  self->pd->length++;
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
   return;
 }
 
-/**
-  * @brief Add item at the front of the linked list.
-  * @param self LDSC_linkedList pointer.
-  * @param dataPtr Pointer to data.
-  * @param status Error pointer.
-  * @details
-  * Keep note that append performs a shallow copy of the data.
-  */
-void LDSC_linkedList_prepend(LDSC_linkedList* self, void* dataPtr, LDSC_error* status) {
+/** add item at the front of the linked list */
+static void List_prepend(privateData* pd, void* dataPtr, LDSC_error* status) {
   if (status) *status = OK;
   
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
@@ -132,37 +299,32 @@ void LDSC_linkedList_prepend(LDSC_linkedList* self, void* dataPtr, LDSC_error* s
     return;
   }
 
-  Node* newNode = Node_init(dataPtr);
+  Node* newNode = Node_init(pd, dataPtr);
   if (!newNode) {
     if (status) *status = NODE_MALLOC;
     return;
   }
 
-  if (!self->pd->head) {
-    self->pd->tail = newNode;
+  if (!pd->head) {
+    pd->tail = newNode;
   } else {
-    self->pd->head->prev = newNode;
-    newNode->next = self->pd->head;
+    pd->head->prev = newNode;
+    newNode->next = pd->head;
   }
-  self->pd->head = newNode;
+  pd->head = newNode;
 
-  self->pd->length++;
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  Finger_reset(pd);
   return;
 }
 
-/**
-  * @brief Add item at index of the linked list.
-  * @param self LDSC_linkedList pointer.
-  * @param dataPtr Pointer to data.
-  * @param index Index to add item at.
-  * @param status Error pointer.
-  * @details
-  * Keep note that add performs a shallow copy of the data.
-  */
-void LDSC_linkedList_add(LDSC_linkedList* self, void* dataPtr, int index, LDSC_error* status) {
+/** add item at index of the linked list */
+static void List_add(privateData* pd, void* dataPtr, int index, LDSC_error* status) {
   if (status) *status = OK;
   
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
@@ -177,21 +339,21 @@ void LDSC_linkedList_add(LDSC_linkedList* self, void* dataPtr, int index, LDSC_e
     return;
   }
 
-  if (index > self->pd->length) {
+  if (index > pd->length) {
     if (status) *status = GREATER_THAN_INDEX;
     return;
   }
 
-  if (index == 0) return LDSC_linkedList_append(self, dataPtr, status);
-  if (index == self->pd->length) return LDSC_linkedList_prepend(self, dataPtr, status);
+  if (index == 0) return List_prepend(pd, dataPtr, status);
+  if (index == pd->length) return List_append(pd, dataPtr, status);
 
-  Node* newNode = Node_init(dataPtr);
+  Node* newNode = Node_init(pd, dataPtr);
   if (!newNode) {
     if (status) *status = NODE_MALLOC;
     return;
   }
 
-  Node* prevNode = LDSC_linkedList_getNode(self, index - 1);
+  Node* prevNode = LDSC_linkedList_getNode(pd, index - 1);
   Node* nextNode = prevNode->next;
 
   prevNode->next = newNode;
@@ -199,21 +361,19 @@ void LDSC_linkedList_add(LDSC_linkedList* self, void* dataPtr, int index, LDSC_e
   newNode->next = nextNode;
   nextNode->prev = newNode;
 
-  self->pd->length++;
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  pd->finger = newNode;
+  pd->fingerIndex = index;
   return;
 }
 
-/**
-  * @brief Get item at index.
-  * @param self LDSC_linkedList pointer.
-  * @param index Index of item to get.
-  * @param status Error pointer.
-  * @return Data pointer of item at index.
-  */
-void* LDSC_linkedList_at(LDSC_linkedList* self, int index, LDSC_error* status) {
+/** get item at index */
+static void* List_at(privateData* pd, int index, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return NULL;
   }
@@ -223,30 +383,22 @@ void* LDSC_linkedList_at(LDSC_linkedList* self, int index, LDSC_error* status) {
     return NULL;
   }
 
-  if (index >= self->pd->length) {
+  if (index >= pd->length) {
     if (status) *status = GREATER_THAN_INDEX;
     return NULL;
   }
 
-  Node* targetNode = LDSC_linkedList_getNode(self, index);
+  Node* targetNode = LDSC_linkedList_getNode(pd, index);
+  LDSC_STATS_ADD(pd, lookups, 1);
 
   return targetNode->dataPtr;
 }
 
-/**
-  * @brief Replace item at index.
-  * @param self LDSC_linkedList pointer.
-  * @param dataPtr Pointer to data.
-  * @param index Index of item to replace with dataPtr.
-  * @param status Error pointer.
-  * @return Data pointer of item that was replaced.
-  * @details
-  * Keep note that replace performs a shallow copy of the data.
-  */
-void* LDSC_linkedList_replace(LDSC_linkedList* self, void* dataPtr, int index, LDSC_error* status) {
+/** replace item at index */
+static void* List_replace(privateData* pd, void* dataPtr, int index, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return NULL;
   }
@@ -261,12 +413,13 @@ void* LDSC_linkedList_replace(LDSC_linkedList* self, void* dataPtr, int index, L
     return NULL;
   }
 
-  if (index >= self->pd->length) {
+  if (index >= pd->length) {
     if (status) *status = GREATER_THAN_INDEX;
     return NULL;
   }
 
-  Node* targetNode = LDSC_linkedList_getNode(self, index);
+  Node* targetNode = LDSC_linkedList_getNode(pd, index);
+  LDSC_STATS_ADD(pd, lookups, 1);
 
   void* replacedDataPtr = targetNode->dataPtr;
   targetNode->dataPtr = dataPtr;
@@ -274,83 +427,72 @@ void* LDSC_linkedList_replace(LDSC_linkedList* self, void* dataPtr, int index, L
   return replacedDataPtr;
 }
 
-/**
-  * @brief Remove item at the front of the list.
-  * @param self LDSC_linkedList pointer.
-  * @param status Error pointer.
-  * @return Data pointer of item that was removed.
-  */
-void* LDSC_linkedList_pop(LDSC_linkedList* self, LDSC_error* status) {
+/** remove item at the front of the list */
+static void* List_pop(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return NULL;
   }
 
-  if (!self->pd->head)
+  if (!pd->head)
     return NULL;
 
-  Node* targetNode = self->pd->head;
+  Node* targetNode = pd->head;
   void* returnData = targetNode->dataPtr;
 
-  self->pd->head = targetNode->next;
+  pd->head = targetNode->next;
 
-  if (self->pd->head)
-    self->pd->head->prev = NULL;
+  if (pd->head)
+    pd->head->prev = NULL;
   else 
-    self->pd->tail = self->pd->head;
+    pd->tail = pd->head;
   
-  self->pd->length--;
+  pd->length--;
+  LDSC_STATS_ADD(pd, removals, 1);
+  Finger_reset(pd);
 
-  free(targetNode);
+  Node_free(pd, targetNode);
   return returnData;
 }
 
-/**
-  * @brief Remove item at the end of the list.
-  * @param self LDSC_linkedList pointer.
-  * @param status Error pointer.
-  * @return Data pointer of item that was removed.
-  */
-void* LDSC_linkedList_pull(LDSC_linkedList* self, LDSC_error* status) {
+/** remove item at the end of the list */
+static void* List_pull(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return NULL;
   }
 
-   if (!self->pd->tail)
+   if (!pd->tail)
      return NULL;
 
-  Node* targetNode = self->pd->tail;
+  Node* targetNode = pd->tail;
   void* returnData = targetNode->dataPtr;
 
-  self->pd->tail = targetNode->prev;
+  pd->tail = targetNode->prev;
 
-  if (self->pd->tail)
-    self->pd->tail->next = NULL;
+  if (pd->tail)
+    pd->tail->next = NULL;
   else
-    self->pd->head = self->pd->tail;
+    pd->head = pd->tail;
 
-  self->pd->length--;
+  pd->length--;
+  LDSC_STATS_ADD(pd, removals, 1);
+  if (pd->finger == targetNode)
+    Finger_reset(pd);
 
-  free(targetNode);
+  Node_free(pd, targetNode);
   return returnData;
 }
 
-/**
-  * @brief Remove item at index.
-  * @param self LDSC_linkedList pointer.
-  * @param index Index of item to remove.
-  * @param status Error pointer.
-  * @return Data pointer of item that was removed.
-  */
-void* LDSC_linkedList_remove(LDSC_linkedList* self, int index, LDSC_error* status) {
+/** remove item at index */
+static void* List_remove(privateData* pd, int index, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return NULL;
   }
@@ -360,15 +502,15 @@ void* LDSC_linkedList_remove(LDSC_linkedList* self, int index, LDSC_error* statu
     return NULL;
   }
 
-  if (index >= self->pd->length) {
+  if (index >= pd->length) {
     if (status) *status = GREATER_THAN_INDEX;
     return NULL;
   }
 
-  if (index == 0) return LDSC_linkedList_pop(self, status);
-  if (index == self->pd->length - 1) return LDSC_linkedList_pull(self, status);
+  if (index == 0) return List_pop(pd, status);
+  if (index == pd->length - 1) return List_pull(pd, status);
 
-  Node* targetNode = LDSC_linkedList_getNode(self, index); 
+  Node* targetNode = LDSC_linkedList_getNode(pd, index); 
   void* returnData = targetNode->dataPtr;
 
   Node* prevNode = targetNode->prev;
@@ -377,101 +519,1268 @@ void* LDSC_linkedList_remove(LDSC_linkedList* self, int index, LDSC_error* statu
   prevNode->next = nextNode;
   nextNode->prev = prevNode;
 
-  self->pd->length--;
+  pd->length--;
+  LDSC_STATS_ADD(pd, removals, 1);
+  pd->finger = nextNode; /* nextNode now sits at the finger index */
 
-  free(targetNode);
+  Node_free(pd, targetNode);
   return returnData;
 }
 
-/**
-  * @brief Remove all items in the list.
-  * @param self LDSC_linkedList pointer.
-  * @param status Error pointer.
-  */
-void LDSC_linkedList_clear(LDSC_linkedList* self, LDSC_error* status) {
+/** remove all items in the list */
+static void List_clear(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
 
-  //while (!self->empty(self, status)) {
-  while (self->pd->length != 0) {
-    self->pop(self, status);
-    if (*status != OK)
+  if (pd->slabNodes) {
+    LDSC_STATS_ADD(pd, removals, pd->length);
+    Slab_releaseAll(pd);
+    return;
+  }
+
+  while (pd->length != 0) {
+    List_pop(pd, status);
+    if (status && *status != OK)
       return;
   }
 
-  if (self->pd->length != 0)
+  if (pd->length != 0)
     if (status) *status = ERROR;
 
   return;
 }
 
-/**
-  * @brief Delete the linked list
-  * @param self LDSC_ilnkedList pionter.
-  * @param status Error pointer.
-  */
-void LDSC_linkedList_delete(LDSC_linkedList* self, LDSC_error* status) {
+/** pre-allocate nodes into the node pool */
+static void List_reserve(privateData* pd, int count, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
 
-  self->clear(self, status);
-  
-  if (self->pd->length != 0)
-    if (status) *status = DELETE_FAIL;
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  if (count > pd->poolCap)
+    pd->poolCap = count;
+
+  while (pd->poolSize < count) {
+    Node* newNode = Node_alloc(pd);
+    if (!newNode) {
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+
+    newNode->next = pd->pool;
+    pd->pool = newNode;
+    pd->poolSize++;
+  }
 
-  free(self->pd);
-  free(self);
   return;
 }
 
-/**************************************************/
+/** set the maximum number of recycled nodes kept in the node pool */
+static void List_setPoolCap(privateData* pd, int cap, LDSC_error* status) {
+  if (status) *status = OK;
 
-/**
- * @brief Create a new linked list.
- * @param status Error pointer.
- * @return Pointer to a LDSC_linkedList.
- */
-LDSC_linkedList* LDSC_linkedList_init(LDSC_error* status) {
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (cap < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  pd->poolCap = cap;
+  Node_trimPool(pd, cap);
+  return;
+}
+
+/** get a cursor to the first item */
+static LDSC_listCursor List_begin(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  LDSC_linkedList* newLL = malloc(sizeof(LDSC_linkedList));
-  if (!newLL) {
-    if (status) *status = STRUCTURE_MALLOC;
-    return NULL;
+  LDSC_listCursor cursor = { NULL };
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return cursor;
+  }
+
+  cursor.node = pd->head;
+  return cursor;
+}
+
+/** get a cursor to the end position one past the tail */
+static LDSC_listCursor List_end(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  LDSC_listCursor cursor = { NULL };
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return cursor;
+  }
+
+  return cursor;
+}
+
+/** move the cursor to the next item */
+static int List_next(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!cursor) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (!cursor->node) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return 0;
+  }
+
+  cursor->node = ((Node*)cursor->node)->next;
+  return cursor->node != NULL;
+}
+
+/** move the cursor to the previous item */
+static int List_prev(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!cursor) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  Node* prevNode = cursor->node ? ((Node*)cursor->node)->prev : pd->tail;
+  if (!prevNode) {
+    if (status) *status = LESS_THAN_INDEX;
+    return 0;
   }
 
+  cursor->node = prevNode;
+  return 1;
+}
+
+/** get item at the cursor */
+static void* List_get(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status) {
+  if (status) *status = OK;
 
-  newLL->pd = malloc(sizeof(privateData));
-  if (!newLL->pd) {
-    if (status) *status = PRIVATEDATA_MALLOC;
+  if (!pd) {
+    if (status) *status = NULL_SELF;
     return NULL;
   }
 
-  newLL->pd->length = 0;
-  newLL->pd->head = NULL;
-  newLL->pd->tail = NULL;
+  if (!cursor) {
+    if (status) *status = NULL_DATAPTR;
+    return NULL;
+  }
 
-  newLL->length = &LDSC_linkedList_length;
-  newLL->empty = &LDSC_linkedList_empty;
-  newLL->append = &LDSC_linkedList_append;
-  newLL->prepend = &LDSC_linkedList_prepend;
-  newLL->add = &LDSC_linkedList_add;
-  newLL->at= &LDSC_linkedList_at;
-  newLL->replace = &LDSC_linkedList_replace;
-  newLL->pop = &LDSC_linkedList_pop;
-  newLL->pull = &LDSC_linkedList_pull;
-  newLL->remove = &LDSC_linkedList_remove;
-  newLL->clear = &LDSC_linkedList_clear;
-  newLL->delete = &LDSC_linkedList_delete;
+  if (!cursor->node) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
 
-  return newLL;
+  LDSC_STATS_ADD(pd, lookups, 1);
+  return ((Node*)cursor->node)->dataPtr;
 }
 
+/** add item before the cursor */
+static void List_insertAt(privateData* pd, LDSC_listCursor* cursor, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!cursor || !dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  Node* newNode = Node_init(pd, dataPtr);
+  if (!newNode) {
+    if (status) *status = NODE_MALLOC;
+    return;
+  }
+
+  Node_linkBefore(pd, newNode, newNode, cursor->node);
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  Finger_reset(pd);
+  return;
+}
+
+/** remove item at the cursor */
+static void* List_removeAt(privateData* pd, LDSC_listCursor* cursor, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!cursor) {
+    if (status) *status = NULL_DATAPTR;
+    return NULL;
+  }
+
+  if (!cursor->node) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  Node* targetNode = cursor->node;
+  void* returnData = targetNode->dataPtr;
+  cursor->node = targetNode->next;
+
+  Node_unlink(pd, targetNode, targetNode);
+  pd->length--;
+  LDSC_STATS_ADD(pd, removals, 1);
+  Finger_reset(pd);
+
+  Node_free(pd, targetNode);
+  return returnData;
+}
+
+/** move all items of another list before the cursor in O(1) */
+static void List_spliceAt(privateData* pd, LDSC_listCursor* cursor, privateData* other, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!cursor || !other) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (other == pd) {
+    if (status) *status = ERROR;
+    return;
+  }
+
+  if (!LDSC_linkedList_compatible(pd, other)) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return;
+  }
+
+  if (!other->head)
+    return;
+
+  Node_linkBefore(pd, other->head, other->tail, cursor->node);
+  pd->length += other->length;
+  LDSC_STATS_LENGTH(pd, pd->length);
+  Finger_reset(pd);
+
+  other->head = NULL;
+  other->tail = NULL;
+  other->length = 0;
+  Finger_reset(other);
+  return;
+}
+
+/** add items to the end of the list */
+static void List_appendMany(privateData* pd, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!items[i]) {
+      if (status) *status = NULL_DATAPTR;
+      return;
+    }
+  }
+
+  if (!count)
+    return;
+
+  Node* first = NULL;
+  Node* last = NULL;
+  for (int i = 0; i < count; i++) {
+    Node* newNode = Node_init(pd, items[i]);
+    if (!newNode) {
+      while (first) {
+        Node* nextNode = first->next;
+        Node_free(pd, first);
+        first = nextNode;
+      }
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+
+    newNode->prev = last;
+    if (last) last->next = newNode;
+    else first = newNode;
+    last = newNode;
+  }
+
+  Node_linkBefore(pd, first, last, NULL);
+  pd->length += count;
+  LDSC_STATS_ADD(pd, inserts, count);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  return;
+}
+
+/** remove up to count items from the start of the list */
+static int List_popMany(privateData* pd, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  int total = 0;
+  while (total < count && pd->head) {
+    Node* targetNode = pd->head;
+    items[total++] = targetNode->dataPtr;
+    pd->head = targetNode->next;
+    Node_free(pd, targetNode);
+  }
+
+  if (pd->head) pd->head->prev = NULL;
+  else pd->tail = NULL;
+
+  pd->length -= total;
+  LDSC_STATS_ADD(pd, removals, total);
+  if (total) Finger_reset(pd);
+  return total;
+}
+
+/** move all items of another list to the end in O(1) */
+static void List_concat(privateData* pd, privateData* other, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_listCursor cursor = { NULL };
+  List_spliceAt(pd, &cursor, other, status);
+  return;
+}
+
+/** move the items in range [from, to) of another list before index */
+static void List_splice(privateData* pd, int index, privateData* other, int from, int to, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!other) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (other == pd) {
+    if (status) *status = ERROR;
+    return;
+  }
+
+  if (!LDSC_linkedList_compatible(pd, other)) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return;
+  }
+
+  if (index < 0 || from < 0 || to < from) {
+    if (status) *status = LESS_THAN_INDEX;
+    return;
+  }
+
+  if (index > pd->length || to > other->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return;
+  }
+
+  if (from == to)
+    return;
+
+  Node* first = LDSC_linkedList_getNode(other, from);
+  Node* last = LDSC_linkedList_getNode(other, to - 1);
+  Node_unlink(other, first, last);
+  other->length -= to - from;
+  Finger_reset(other);
+
+  Node* nextNode = index < pd->length ? LDSC_linkedList_getNode(pd, index) : NULL;
+  Node_linkBefore(pd, first, last, nextNode);
+  pd->length += to - from;
+  LDSC_STATS_LENGTH(pd, pd->length);
+  Finger_reset(pd);
+  return;
+}
+
+
+/** call a function on every item from head to tail */
+static void List_forEach(privateData* pd, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!callback) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  for (Node* currNode = pd->head; currNode; currNode = currNode->next)
+    if (callback(currNode->dataPtr, ctx))
+      return;
+
+  return;
+}
+
+/** sort the linked list */
+static void List_sort(privateData* pd, int (*cmp)(const void* a, const void* b), LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!cmp) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (pd->length < 2)
+    return;
+
+  Node* list = pd->head;
+  for (int width = 1; width < pd->length; width *= 2) {
+    Node* sorted = NULL;
+    Node** sortedTail = &sorted;
+
+    while (list) {
+      Node* left = list;
+      Node* right = left;
+      int leftSize = 0;
+      for (; leftSize < width && right; leftSize++)
+        right = right->next;
+
+      Node* rest = right;
+      int rightSize = 0;
+      for (; rightSize < width && rest; rightSize++)
+        rest = rest->next;
+
+      while (leftSize && rightSize) {
+        if (cmp(right->dataPtr, left->dataPtr) < 0) {
+          *sortedTail = right;
+          right = right->next;
+          rightSize--;
+        } else {
+          *sortedTail = left;
+          left = left->next;
+          leftSize--;
+        }
+        sortedTail = &(*sortedTail)->next;
+      }
+      for (; leftSize; leftSize--, left = left->next, sortedTail = &(*sortedTail)->next)
+        *sortedTail = left;
+      for (; rightSize; rightSize--, right = right->next, sortedTail = &(*sortedTail)->next)
+        *sortedTail = right;
+
+      list = rest;
+    }
+
+    *sortedTail = NULL;
+    list = sorted;
+  }
+
+  Node* prevNode = NULL;
+  pd->head = list;
+  for (Node* currNode = list; currNode; currNode = currNode->next) {
+    currNode->prev = prevNode;
+    prevNode = currNode;
+  }
+  pd->tail = prevNode;
+
+  Finger_reset(pd);
+  return;
+}
+
+/** add item in sorted position */
+static void List_insertSorted(privateData* pd, void* dataPtr, int (*cmp)(const void* a, const void* b), LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr || !cmp) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  Node* nextNode = NULL;
+  if (pd->tail && cmp(dataPtr, pd->tail->dataPtr) < 0) {
+    nextNode = pd->head;
+    while (cmp(dataPtr, nextNode->dataPtr) >= 0)
+      nextNode = nextNode->next;
+  }
+
+  Node* newNode = Node_init(pd, dataPtr);
+  if (!newNode) {
+    if (status) *status = NODE_MALLOC;
+    return;
+  }
+
+  Node_linkBefore(pd, newNode, newNode, nextNode);
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  if (nextNode)
+    Finger_reset(pd);
+  return;
+}
+
+/** copy the operation counters of the list */
+static void List_stats(privateData* pd, LDSC_stats* out, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!out) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  *out = pd->stats;
+#else
+  *out = (LDSC_stats){ 0 };
+#endif
+  return;
+}
+
+/** zero the operation counters of the list */
+static void List_resetStats(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  pd->stats = (LDSC_stats){ .highWater = pd->length };
+#endif
+  return;
+}
+
+/** whether the list of pd can be split at index, reporting why not in status */
+static int List_canSplit(privateData* pd, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (pd->slabNodes) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return 0;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return 0;
+  }
+
+  if (index > pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return 0;
+  }
+  return 1;
+}
+
+/** move the items of pd from index on into the empty list of to */
+static void List_moveTail(privateData* pd, int index, privateData* to) {
+  if (index == pd->length)
+    return;
+
+  Node* first = LDSC_linkedList_getNode(pd, index);
+  Node* last = pd->tail;
+  Node_unlink(pd, first, last);
+  Node_linkBefore(to, first, last, NULL);
+  to->length = pd->length - index;
+  LDSC_STATS_LENGTH(to, to->length);
+  pd->length = index;
+  Finger_reset(pd);
+}
+
+/** release every node of the list, leaving only the block of the structure */
+static void List_release(privateData* pd, LDSC_error* status) {
+  List_clear(pd, status);
+
+  if (pd->length != 0)
+    if (status) *status = DELETE_FAIL;
+
+  Node_trimPool(pd, 0);
+}
+
+/**************************************************/
+/* LDSC_linkedList */
+
+/**
+  * @brief Remove all items in the list.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_clear(LDSC_linkedList* self, LDSC_error* status) {
+  List_clear(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Get length of the linked list.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  * @return Length of the linked list as integer type.
+  */
+int LDSC_linkedList_length(LDSC_linkedList* self, LDSC_error* status) {
+  return List_length(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Check if linked list is empty.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_linkedList_empty(LDSC_linkedList* self, LDSC_error* status) {
+  return List_empty(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Add item at the end of the linked list.
+  * @param self LDSC_linkedList pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that prepend performs a shallow copy of the data.
+  */
+void LDSC_linkedList_append(LDSC_linkedList* self, void* dataPtr, LDSC_error* status) {
+  List_append(self ? self->pd : NULL, dataPtr, status);
+}
+
+/**
+  * @brief Add item at the front of the linked list.
+  * @param self LDSC_linkedList pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that append performs a shallow copy of the data.
+  */
+void LDSC_linkedList_prepend(LDSC_linkedList* self, void* dataPtr, LDSC_error* status) {
+  List_prepend(self ? self->pd : NULL, dataPtr, status);
+}
+
+/**
+  * @brief Add item at index of the linked list.
+  * @param self LDSC_linkedList pointer.
+  * @param dataPtr Pointer to data.
+  * @param index Index to add item at.
+  * @param status Error pointer.
+  * @details
+  * Keep note that add performs a shallow copy of the data.
+  */
+void LDSC_linkedList_add(LDSC_linkedList* self, void* dataPtr, int index, LDSC_error* status) {
+  List_add(self ? self->pd : NULL, dataPtr, index, status);
+}
+
+/**
+  * @brief Get item at index.
+  * @param self LDSC_linkedList pointer.
+  * @param index Index of item to get.
+  * @param status Error pointer.
+  * @return Data pointer of item at index.
+  */
+void* LDSC_linkedList_at(LDSC_linkedList* self, int index, LDSC_error* status) {
+  return List_at(self ? self->pd : NULL, index, status);
+}
+
+/**
+  * @brief Replace item at index.
+  * @param self LDSC_linkedList pointer.
+  * @param dataPtr Pointer to data.
+  * @param index Index of item to replace with dataPtr.
+  * @param status Error pointer.
+  * @return Data pointer of item that was replaced.
+  * @details
+  * Keep note that replace performs a shallow copy of the data.
+  */
+void* LDSC_linkedList_replace(LDSC_linkedList* self, void* dataPtr, int index, LDSC_error* status) {
+  return List_replace(self ? self->pd : NULL, dataPtr, index, status);
+}
+
+/**
+  * @brief Remove item at the front of the list.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_linkedList_pop(LDSC_linkedList* self, LDSC_error* status) {
+  return List_pop(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Remove item at the end of the list.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_linkedList_pull(LDSC_linkedList* self, LDSC_error* status) {
+  return List_pull(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Remove item at index.
+  * @param self LDSC_linkedList pointer.
+  * @param index Index of item to remove.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_linkedList_remove(LDSC_linkedList* self, int index, LDSC_error* status) {
+  return List_remove(self ? self->pd : NULL, index, status);
+}
+
+/**
+  * @brief Pre-allocate nodes into the node pool.
+  * @param self LDSC_linkedList pointer.
+  * @param count Number of nodes the pool should hold.
+  * @param status Error pointer.
+  * @details
+  * The pool capacity is raised to count if it is smaller.
+  */
+void LDSC_linkedList_reserve(LDSC_linkedList* self, int count, LDSC_error* status) {
+  List_reserve(self ? self->pd : NULL, count, status);
+}
+
+/**
+  * @brief Set the maximum number of recycled nodes kept in the node pool.
+  * @param self LDSC_linkedList pointer.
+  * @param cap Maximum number of pooled nodes, 0 disables pooling.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_setPoolCap(LDSC_linkedList* self, int cap, LDSC_error* status) {
+  List_setPoolCap(self ? self->pd : NULL, cap, status);
+}
+
+/**
+  * @brief Get a cursor to the first item.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  * @return Cursor at the head, or at the end position if the list is empty.
+  */
+LDSC_listCursor LDSC_linkedList_begin(LDSC_linkedList* self, LDSC_error* status) {
+  return List_begin(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Get a cursor to the end position one past the tail.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  * @return Cursor at the end position.
+  */
+LDSC_listCursor LDSC_linkedList_end(LDSC_linkedList* self, LDSC_error* status) {
+  return List_end(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Move the cursor to the next item.
+  * @param self LDSC_linkedList pointer.
+  * @param cursor Cursor pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = cursor is on an item and 0 = cursor is at the end.
+  */
+int LDSC_linkedList_next(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status) {
+  return List_next(self ? self->pd : NULL, cursor, status);
+}
+
+/**
+  * @brief Move the cursor to the previous item.
+  * @param self LDSC_linkedList pointer.
+  * @param cursor Cursor pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = cursor is on an item and 0 = it did not move.
+  */
+int LDSC_linkedList_prev(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status) {
+  return List_prev(self ? self->pd : NULL, cursor, status);
+}
+
+/**
+  * @brief Get item at the cursor.
+  * @param self LDSC_linkedList pointer.
+  * @param cursor Cursor pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item at the cursor, NULL at the end position.
+  */
+void* LDSC_linkedList_get(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status) {
+  return List_get(self ? self->pd : NULL, cursor, status);
+}
+
+/**
+  * @brief Add item before the cursor.
+  * @param self LDSC_linkedList pointer.
+  * @param cursor Cursor pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that insertAt performs a shallow copy of the data.
+  */
+void LDSC_linkedList_insertAt(LDSC_linkedList* self, LDSC_listCursor* cursor, void* dataPtr, LDSC_error* status) {
+  List_insertAt(self ? self->pd : NULL, cursor, dataPtr, status);
+}
+
+/**
+  * @brief Remove item at the cursor.
+  * @param self LDSC_linkedList pointer.
+  * @param cursor Cursor pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_linkedList_removeAt(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_error* status) {
+  return List_removeAt(self ? self->pd : NULL, cursor, status);
+}
+
+/**
+  * @brief Move all items of another list before the cursor in O(1).
+  * @param self LDSC_linkedList pointer.
+  * @param cursor Cursor pointer.
+  * @param other List whose items are moved, left empty.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_spliceAt(LDSC_linkedList* self, LDSC_listCursor* cursor, LDSC_linkedList* other, LDSC_error* status) {
+  List_spliceAt(self ? self->pd : NULL, cursor, other ? other->pd : NULL, status);
+}
+
+/**
+  * @brief Add items to the end of the list.
+  * @param self LDSC_linkedList pointer.
+  * @param items Array of data pointers, appended in order.
+  * @param count Number of items.
+  * @param status Error pointer.
+  * @details
+  * Keep note that appendMany performs a shallow copy of the data.
+  */
+void LDSC_linkedList_appendMany(LDSC_linkedList* self, void** items, int count, LDSC_error* status) {
+  List_appendMany(self ? self->pd : NULL, items, count, status);
+}
+
+/**
+  * @brief Remove up to count items from the start of the list.
+  * @param self LDSC_linkedList pointer.
+  * @param items Array receiving the data pointers in list order.
+  * @param count Maximum number of items to remove.
+  * @param status Error pointer.
+  * @return Number of items removed.
+  */
+int LDSC_linkedList_popMany(LDSC_linkedList* self, void** items, int count, LDSC_error* status) {
+  return List_popMany(self ? self->pd : NULL, items, count, status);
+}
+
+/**
+  * @brief Move all items of another list to the end in O(1).
+  * @param self LDSC_linkedList pointer.
+  * @param other List whose items are moved, left empty.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_concat(LDSC_linkedList* self, LDSC_linkedList* other, LDSC_error* status) {
+  List_concat(self ? self->pd : NULL, other ? other->pd : NULL, status);
+}
+
+/**
+  * @brief Move the items in range [from, to) of another list before index.
+  * @param self LDSC_linkedList pointer.
+  * @param index Index the first moved item will have, 0 to length.
+  * @param other List whose items are moved.
+  * @param from Index in other of the first item to move.
+  * @param to Index in other one past the last item to move.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_splice(LDSC_linkedList* self, int index, LDSC_linkedList* other, int from, int to, LDSC_error* status) {
+  List_splice(self ? self->pd : NULL, index, other ? other->pd : NULL, from, to, status);
+}
+
+/**
+  * @brief Call a function on every item from head to tail.
+  * @param self LDSC_linkedList pointer.
+  * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+  * @param ctx User context passed to callback.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_forEach(LDSC_linkedList* self, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status) {
+  List_forEach(self ? self->pd : NULL, callback, ctx, status);
+}
+
+/**
+  * @brief Sort the linked list.
+  * @param self LDSC_linkedList pointer.
+  * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+  * @param status Error pointer.
+  * @details
+  * Runs of width 1, 2, 4, ... are merged pairwise along the next links only;
+  * prev links and the tail are rebuilt in one final pass.
+  */
+void LDSC_linkedList_sort(LDSC_linkedList* self, int (*cmp)(const void* a, const void* b), LDSC_error* status) {
+  List_sort(self ? self->pd : NULL, cmp, status);
+}
+
+/**
+  * @brief Add item in sorted position.
+  * @param self LDSC_linkedList pointer.
+  * @param dataPtr Pointer to data.
+  * @param cmp Function comparing two data pointers, negative, zero or positive like strcmp.
+  * @param status Error pointer.
+  * @details
+  * Keep note that insertSorted performs a shallow copy of the data.
+  */
+void LDSC_linkedList_insertSorted(LDSC_linkedList* self, void* dataPtr, int (*cmp)(const void* a, const void* b), LDSC_error* status) {
+  List_insertSorted(self ? self->pd : NULL, dataPtr, cmp, status);
+}
+
+/**
+  * @brief Copy the operation counters of the list.
+  * @param self LDSC_linkedList pointer.
+  * @param out Stats pointer receiving the counters.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_stats(LDSC_linkedList* self, LDSC_stats* out, LDSC_error* status) {
+  List_stats(self ? self->pd : NULL, out, status);
+}
+
+/**
+  * @brief Zero the operation counters of the list.
+  * @param self LDSC_linkedList pointer.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_resetStats(LDSC_linkedList* self, LDSC_error* status) {
+  List_resetStats(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Split the linked list at index.
+  * @param self LDSC_linkedList pointer.
+  * @param index Index of the first item to move out, 0 to length.
+  * @param status Error pointer.
+  * @return New list holding the items from index on.
+  */
+LDSC_linkedList* LDSC_linkedList_splitAt(LDSC_linkedList* self, int index, LDSC_error* status) {
+  if (!List_canSplit(self ? self->pd : NULL, index, status))
+    return NULL;
+
+  LDSC_linkedList* newLL = LDSC_linkedList_init_with(&self->pd->allocator, status);
+  if (!newLL) return NULL;
+
+  List_moveTail(self->pd, index, newLL->pd);
+  return newLL;
+}
+
+/**
+  * @brief Delete the linked list
+  * @param self LDSC_ilnkedList pionter.
+  * @param status Error pointer.
+  */
+void LDSC_linkedList_delete(LDSC_linkedList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  List_release(self->pd, status);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(Instance), allocator.context);
+  return;
+}
+
+/**************************************************/
+
+/** method table copied into every new linked list */
+static const LDSC_linkedList LDSC_linkedList_methods = {
+  .length = &LDSC_linkedList_length,
+  .empty = &LDSC_linkedList_empty,
+  .append = &LDSC_linkedList_append,
+  .prepend = &LDSC_linkedList_prepend,
+  .add = &LDSC_linkedList_add,
+  .at = &LDSC_linkedList_at,
+  .replace = &LDSC_linkedList_replace,
+  .pop = &LDSC_linkedList_pop,
+  .pull = &LDSC_linkedList_pull,
+  .remove = &LDSC_linkedList_remove,
+  .clear = &LDSC_linkedList_clear,
+  .reserve = &LDSC_linkedList_reserve,
+  .setPoolCap = &LDSC_linkedList_setPoolCap,
+  .begin = &LDSC_linkedList_begin,
+  .end = &LDSC_linkedList_end,
+  .next = &LDSC_linkedList_next,
+  .prev = &LDSC_linkedList_prev,
+  .get = &LDSC_linkedList_get,
+  .insertAt = &LDSC_linkedList_insertAt,
+  .removeAt = &LDSC_linkedList_removeAt,
+  .spliceAt = &LDSC_linkedList_spliceAt,
+  .appendMany = &LDSC_linkedList_appendMany,
+  .popMany = &LDSC_linkedList_popMany,
+  .concat = &LDSC_linkedList_concat,
+  .splice = &LDSC_linkedList_splice,
+  .splitAt = &LDSC_linkedList_splitAt,
+  .forEach = &LDSC_linkedList_forEach,
+  .sort = &LDSC_linkedList_sort,
+  .insertSorted = &LDSC_linkedList_insertSorted,
+  .stats = &LDSC_linkedList_stats,
+  .resetStats = &LDSC_linkedList_resetStats,
+  .delete = &LDSC_linkedList_delete
+};
+
+/**
+ * @brief Create a new linked list.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_linkedList.
+ */
+LDSC_linkedList* LDSC_linkedList_init(LDSC_error* status) {
+  return LDSC_linkedList_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new linked list using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_linkedList.
+ */
+LDSC_linkedList* LDSC_linkedList_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  Instance* instance = allocator->alloc(sizeof(Instance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  LDSC_linkedList* newLL = &instance->self;
+  *newLL = LDSC_linkedList_methods;
+  newLL->pd = &instance->pd;
+  List_setup(newLL->pd, allocator);
+
+  return newLL;
+}
+
+/**
+ * @brief Create a new linked list in arena mode.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param slabNodes Number of nodes per slab, 0 for LDSC_ARENA_DEFAULT_SLAB_NODES.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_linkedList.
+ */
+LDSC_linkedList* LDSC_linkedList_init_arena(const LDSC_allocator* allocator, int slabNodes, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (slabNodes < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  LDSC_linkedList* newLL = LDSC_linkedList_init_with(allocator, status);
+  if (!newLL) return NULL;
+
+  newLL->pd->slabNodes = slabNodes ? slabNodes : LDSC_ARENA_DEFAULT_SLAB_NODES;
+  return newLL;
+}
+
+
+/**************************************************/
+/* LDSC_linkedListRef */
+
+/** methods shared by every LDSC_linkedListRef */
+static const LDSC_linkedListOps LDSC_linkedListRef_ops = {
+  .length = &List_length,
+  .empty = &List_empty,
+  .append = &List_append,
+  .prepend = &List_prepend,
+  .add = &List_add,
+  .at = &List_at,
+  .replace = &List_replace,
+  .pop = &List_pop,
+  .pull = &List_pull,
+  .remove = &List_remove,
+  .clear = &List_clear,
+  .reserve = &List_reserve,
+  .setPoolCap = &List_setPoolCap,
+  .begin = &List_begin,
+  .end = &List_end,
+  .next = &List_next,
+  .prev = &List_prev,
+  .get = &List_get,
+  .insertAt = &List_insertAt,
+  .removeAt = &List_removeAt,
+  .spliceAt = &List_spliceAt,
+  .appendMany = &List_appendMany,
+  .popMany = &List_popMany,
+  .concat = &List_concat,
+  .splice = &List_splice,
+  .forEach = &List_forEach,
+  .sort = &List_sort,
+  .insertSorted = &List_insertSorted,
+  .stats = &List_stats,
+  .resetStats = &List_resetStats
+};
+
+/**
+ * @brief Create a new compact linked list handle.
+ * @param status Error pointer.
+ * @return Pointer to a new compact linked list handle.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_init(LDSC_error* status) {
+  return LDSC_linkedListRef_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new compact linked list handle using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a new compact linked list handle.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  RefInstance* instance = allocator->alloc(sizeof(RefInstance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  LDSC_linkedListRef* newRef = &instance->ref;
+  newRef->ops = &LDSC_linkedListRef_ops;
+  newRef->pd = &instance->pd;
+  List_setup(newRef->pd, allocator);
+
+  return newRef;
+}
+
+/**
+ * @brief Create a new compact linked list handle in arena mode.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param slabNodes Number of nodes per slab, 0 for LDSC_ARENA_DEFAULT_SLAB_NODES.
+ * @param status Error pointer.
+ * @return Pointer to a new compact linked list handle.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_init_arena(const LDSC_allocator* allocator, int slabNodes, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (slabNodes < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  LDSC_linkedListRef* newRef = LDSC_linkedListRef_init_with(allocator, status);
+  if (!newRef) return NULL;
+
+  newRef->pd->slabNodes = slabNodes ? slabNodes : LDSC_ARENA_DEFAULT_SLAB_NODES;
+  return newRef;
+}
+
+/**
+ * @brief Split the linked list behind a compact handle at index.
+ * @param self Compact linked list handle.
+ * @param index Index of the first item to move out, 0 to length.
+ * @param status Error pointer.
+ * @return New compact handle of a list holding the items from index on.
+ */
+LDSC_linkedListRef* LDSC_linkedListRef_splitAt(LDSC_linkedListRef* self, int index, LDSC_error* status) {
+  if (!List_canSplit(self ? self->pd : NULL, index, status))
+    return NULL;
+
+  LDSC_linkedListRef* newRef = LDSC_linkedListRef_init_with(&self->pd->allocator, status);
+  if (!newRef) return NULL;
+
+  List_moveTail(self->pd, index, newRef->pd);
+  return newRef;
+}
+
+/**
+ * @brief Delete the linked list behind a compact handle.
+ * @param self Compact linked list handle.
+ * @param status Error pointer.
+ */
+void LDSC_linkedListRef_delete(LDSC_linkedListRef* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  List_release(self->pd, status);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(RefInstance), allocator.context);
+  return;
+}
@@ -0,0 +1,691 @@
+#include <LDSC_stack.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/** assumed cache line size used to keep the two tops apart */
+#define LOCKFREE_CACHE_LINE 64
+
+/** number of nodes in the first segment, every following segment doubles */
+#define LOCKFREE_SEGMENT_BASE 64
+
+/** number of segments, enough to address every 32 bit node index */
+#define LOCKFREE_SEGMENT_COUNT 26
+
+/**
+  * @brief Stack node.
+  * @details
+  * Nodes are addressed by index and never released before delete, so a
+  * thread holding a stale index can always read next safely.
+  * next and dataPtr are atomic because such a thread may read them while
+  * the node is being reused.
+  */
+typedef struct Node {
+  _Atomic(void*) dataPtr;
+  _Atomic uint32_t next;
+} Node;
+
+#ifdef LDSC_STATS
+/** counters of LDSC_stats as relaxed atomics, updated by every thread */
+typedef struct LockFree_stats {
+  atomic_long inserts;
+  atomic_long removals;
+  atomic_long lookups;
+  atomic_long nodeAllocs;
+  atomic_int highWater;
+} LockFree_stats;
+
+#define LOCKFREE_STATS_ADD(pd, field, n) \
+  atomic_fetch_add_explicit(&(pd)->stats.field, (n), memory_order_relaxed)
+#define LOCKFREE_STATS_LENGTH(pd, length) LockFree_statsLength(pd, length)
+#else
+#define LOCKFREE_STATS_ADD(pd, field, n) ((void)0)
+#define LOCKFREE_STATS_LENGTH(pd, length) ((void)0)
+#endif
+
+/**
+  * @brief Opaque container for private data.
+  * @details
+  * top and freeList pack a 32 bit version tag above a 32 bit node handle
+  * (index + 1, 0 means empty). Every successful CAS bumps the tag, so a
+  * pop that read a top which was since popped and pushed again fails
+  * instead of installing a stale next (ABA).
+  */
+struct privateData {
+  _Atomic(Node*) segments[LOCKFREE_SEGMENT_COUNT];
+  atomic_uint nodeCount;
+  LDSC_allocator allocator;
+
+  char padTop[LOCKFREE_CACHE_LINE];
+  atomic_uint_fast64_t top;
+  atomic_int size;
+
+  char padFree[LOCKFREE_CACHE_LINE];
+  atomic_uint_fast64_t freeList;
+
+#ifdef LDSC_STATS
+  char padStats[LOCKFREE_CACHE_LINE];
+  LockFree_stats stats;
+#endif
+
+  char padEnd[LOCKFREE_CACHE_LINE];
+};
+
+/** structure and private data allocated as one block */
+typedef struct Instance {
+  LDSC_stack self;
+  privateData pd;
+} Instance;
+
+#ifdef LDSC_STATS
+/** raise the high-water size to length unless another thread raised it further */
+static void LockFree_statsLength(privateData* pd, int length) {
+  int highWater = atomic_load_explicit(&pd->stats.highWater, memory_order_relaxed);
+  while (length > highWater &&
+         !atomic_compare_exchange_weak_explicit(&pd->stats.highWater, &highWater, length,
+                                                memory_order_relaxed, memory_order_relaxed))
+    ;
+}
+#endif
+
+/** pack a node handle and version tag into a tagged top */
+static uint64_t Tagged_make(uint32_t handle, uint32_t tag) {
+  return ((uint64_t)tag << 32) | handle;
+}
+
+/** node handle of a tagged top */
+static uint32_t Tagged_handle(uint64_t tagged) {
+  return (uint32_t)tagged;
+}
+
+/** version tag of a tagged top */
+static uint32_t Tagged_tag(uint64_t tagged) {
+  return (uint32_t)(tagged >> 32);
+}
+
+/** size of segment k in nodes */
+static uint32_t Segment_nodes(int k) {
+  return (uint32_t)LOCKFREE_SEGMENT_BASE << k;
+}
+
+/** node of a handle, its segment must already be installed */
+static Node* Node_at(privateData* pd, uint32_t handle) {
+  uint32_t index = handle - 1;
+  int k = 0;
+  while (index >= Segment_nodes(k)) {
+    index -= Segment_nodes(k);
+    k++;
+  }
+  return &atomic_load_explicit(&pd->segments[k], memory_order_acquire)[index];
+}
+
+/** install segment k if no other thread has done so yet */
+static int Segment_install(privateData* pd, int k) {
+  if (atomic_load_explicit(&pd->segments[k], memory_order_acquire))
+    return 1;
+
+  size_t bytes = Segment_nodes(k) * sizeof(Node);
+  Node* segment = (Node*)pd->allocator.alloc(bytes, pd->allocator.context);
+  if (!segment) return 0;
+
+  for (uint32_t i = 0; i < Segment_nodes(k); i++) {
+    atomic_init(&segment[i].dataPtr, NULL);
+    atomic_init(&segment[i].next, 0);
+  }
+
+  Node* expected = NULL;
+  if (!atomic_compare_exchange_strong_explicit(&pd->segments[k], &expected, segment,
+                                               memory_order_acq_rel, memory_order_acquire))
+    pd->allocator.free(segment, bytes, pd->allocator.context);
+  else
+    LOCKFREE_STATS_ADD(pd, nodeAllocs, (long)Segment_nodes(k));
+  return 1;
+}
+
+/** push the chain first..last, already linked through next, onto a tagged Treiber list */
+static void Tagged_pushChain(privateData* pd, atomic_uint_fast64_t* head, uint32_t first, uint32_t last) {
+  Node* node = Node_at(pd, last);
+  uint64_t old = atomic_load_explicit(head, memory_order_relaxed);
+  do {
+    atomic_store_explicit(&node->next, Tagged_handle(old), memory_order_relaxed);
+  } while (!atomic_compare_exchange_weak_explicit(head, &old,
+                                                  Tagged_make(first, Tagged_tag(old) + 1),
+                                                  memory_order_release, memory_order_relaxed));
+}
+
+/** push handle onto a tagged Treiber list */
+static void Tagged_push(privateData* pd, atomic_uint_fast64_t* head, uint32_t handle) {
+  Tagged_pushChain(pd, head, handle, handle);
+}
+
+/** pop a handle from a tagged Treiber list, 0 if it is empty */
+static uint32_t Tagged_pop(privateData* pd, atomic_uint_fast64_t* head) {
+  uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+  for (;;) {
+    uint32_t handle = Tagged_handle(old);
+    if (!handle) return 0;
+
+    uint32_t next = atomic_load_explicit(&Node_at(pd, handle)->next, memory_order_relaxed);
+    if (atomic_compare_exchange_weak_explicit(head, &old, Tagged_make(next, Tagged_tag(old) + 1),
+                                              memory_order_acquire, memory_order_acquire))
+      return handle;
+  }
+}
+
+/**
+  * @brief Pop up to count handles from a tagged Treiber list with one CAS.
+  * @details
+  * The detached handles stay linked through next from the returned first
+  * handle to *last. Data pointers read on the way are stored in items if it
+  * is not NULL. A successful CAS means the tag did not move, so no node of
+  * the walked chain was popped or pushed in between and the reads are valid.
+  */
+static int Tagged_popChain(privateData* pd, atomic_uint_fast64_t* head, int count,
+                           void** items, uint32_t* first, uint32_t* last) {
+  uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+  for (;;) {
+    uint32_t handle = Tagged_handle(old);
+    int total = 0;
+    *first = handle;
+    while (total < count && handle) {
+      Node* node = Node_at(pd, handle);
+      if (items) items[total] = atomic_load_explicit(&node->dataPtr, memory_order_relaxed);
+      *last = handle;
+      handle = atomic_load_explicit(&node->next, memory_order_relaxed);
+      total++;
+    }
+
+    if (!total) return 0;
+    if (atomic_compare_exchange_weak_explicit(head, &old, Tagged_make(handle, Tagged_tag(old) + 1),
+                                              memory_order_acquire, memory_order_acquire))
+      return total;
+  }
+}
+
+/** claim a never used node, 0 on failure; a failed index is burnt, later ones may be owned */
+static uint32_t Node_claim(privateData* pd) {
+  uint32_t index = atomic_fetch_add_explicit(&pd->nodeCount, 1, memory_order_relaxed);
+
+  uint32_t offset = index;
+  int k = 0;
+  while (k < LOCKFREE_SEGMENT_COUNT && offset >= Segment_nodes(k)) {
+    offset -= Segment_nodes(k);
+    k++;
+  }
+  if (k == LOCKFREE_SEGMENT_COUNT || !Segment_install(pd, k))
+    return 0;
+  return index + 1;
+}
+
+/** take a node from the free list or claim a new one, 0 on failure */
+static uint32_t Node_init(privateData* pd) {
+  uint32_t handle = Tagged_pop(pd, &pd->freeList);
+  if (handle) return handle;
+  return Node_claim(pd);
+}
+
+/**************************************************/
+/* LDSC_stack lock-free */
+
+/**
+  * @brief Get size of the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  * @return Size of the stack as integer type.
+  * @details
+  * The result is a snapshot and may be stale under concurrent use.
+  */
+int LDSC_lockFreeStack_size(LDSC_stack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  int size = atomic_load_explicit(&self->pd->size, memory_order_relaxed);
+  return size > 0 ? size : 0;
+}
+
+/**
+  * @brief Push an item to the stack.
+  * @param self Stack pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that push performs a shallow copy of the data.
+  */
+void LDSC_lockFreeStack_push(LDSC_stack* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  uint32_t handle = Node_init(self->pd);
+  if (!handle) {
+    if (status) *status = NODE_MALLOC;
+    return;
+  }
+
+  atomic_store_explicit(&Node_at(self->pd, handle)->dataPtr, dataPtr, memory_order_relaxed);
+  Tagged_push(self->pd, &self->pd->top, handle);
+  atomic_fetch_add_explicit(&self->pd->size, 1, memory_order_relaxed);
+  LOCKFREE_STATS_ADD(self->pd, inserts, 1);
+  LOCKFREE_STATS_LENGTH(self->pd, atomic_load_explicit(&self->pd->size, memory_order_relaxed));
+  return;
+}
+
+/**
+  * @brief Check if stack is empty.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty
+  * @details
+  * The result is a snapshot and may be stale under concurrent use.
+  */
+int LDSC_lockFreeStack_empty(LDSC_stack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return Tagged_handle(atomic_load_explicit(&self->pd->top, memory_order_acquire)) == 0;
+}
+
+/**
+  * @brief Peek item at the top of the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the top of the stack.
+  * @details
+  * The result is a snapshot; another thread may pop the item at any time.
+  */
+void* LDSC_lockFreeStack_peek(LDSC_stack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  uint32_t handle = Tagged_handle(atomic_load_explicit(&self->pd->top, memory_order_acquire));
+  if (!handle)
+    return NULL;
+
+  LOCKFREE_STATS_ADD(self->pd, lookups, 1);
+  return atomic_load_explicit(&Node_at(self->pd, handle)->dataPtr, memory_order_relaxed);
+}
+
+/**
+  * @brief Pop an item from the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the top of the stack.
+  */
+void* LDSC_lockFreeStack_pop(LDSC_stack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  uint32_t handle = Tagged_pop(self->pd, &self->pd->top);
+  if (!handle)
+    return NULL;
+
+  atomic_fetch_sub_explicit(&self->pd->size, 1, memory_order_relaxed);
+  LOCKFREE_STATS_ADD(self->pd, removals, 1);
+  void* dataTop = atomic_load_explicit(&Node_at(self->pd, handle)->dataPtr, memory_order_relaxed);
+  Tagged_push(self->pd, &self->pd->freeList, handle);
+  return dataTop;
+}
+
+/**
+  * @brief Push items to the stack.
+  * @param self Stack pointer.
+  * @param items Array of data pointers, pushed in order.
+  * @param count Number of items.
+  * @param status Error pointer.
+  * @details
+  * The nodes are linked privately and published with a single CAS.
+  * Keep note that pushMany performs a shallow copy of the data.
+  */
+void LDSC_lockFreeStack_pushMany(LDSC_stack* self, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!items[i]) {
+      if (status) *status = NULL_DATAPTR;
+      return;
+    }
+  }
+
+  if (!count)
+    return;
+
+  privateData* pd = self->pd;
+  uint32_t first = 0;
+  uint32_t last = 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t handle = Node_init(pd);
+    if (!handle) {
+      if (first)
+        Tagged_pushChain(pd, &pd->freeList, first, last);
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+
+    Node* node = Node_at(pd, handle);
+    atomic_store_explicit(&node->dataPtr, items[i], memory_order_relaxed);
+    atomic_store_explicit(&node->next, first, memory_order_relaxed);
+    first = handle;
+    if (!last) last = handle;
+  }
+
+  Tagged_pushChain(pd, &pd->top, first, last);
+  atomic_fetch_add_explicit(&pd->size, count, memory_order_relaxed);
+  LOCKFREE_STATS_ADD(pd, inserts, count);
+  LOCKFREE_STATS_LENGTH(pd, atomic_load_explicit(&pd->size, memory_order_relaxed));
+  return;
+}
+
+/**
+  * @brief Pop up to count items from the stack.
+  * @param self Stack pointer.
+  * @param items Array receiving the data pointers, items[0] was the top.
+  * @param count Maximum number of items to pop.
+  * @param status Error pointer.
+  * @return Number of items popped.
+  * @details
+  * The items are detached with a single CAS and their nodes returned to the
+  * free list with another.
+  */
+int LDSC_lockFreeStack_popMany(LDSC_stack* self, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  uint32_t first = 0;
+  uint32_t last = 0;
+  int total = Tagged_popChain(self->pd, &self->pd->top, count, items, &first, &last);
+  if (!total)
+    return 0;
+
+  atomic_fetch_sub_explicit(&self->pd->size, total, memory_order_relaxed);
+  LOCKFREE_STATS_ADD(self->pd, removals, total);
+  Tagged_pushChain(self->pd, &self->pd->freeList, first, last);
+  return total;
+}
+
+/**
+  * @brief Pre-allocate nodes into the free list.
+  * @param self Stack pointer.
+  * @param count Number of nodes to add to the free list.
+  * @param status Error pointer.
+  */
+void LDSC_lockFreeStack_reserve(LDSC_stack* self, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    uint32_t handle = Node_claim(self->pd);
+    if (!handle) {
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+    Tagged_push(self->pd, &self->pd->freeList, handle);
+  }
+
+  return;
+}
+
+/**
+  * @brief Set the maximum number of recycled nodes kept in the node pool.
+  * @param self Stack pointer.
+  * @param cap Maximum number of pooled nodes, 0 disables pooling.
+  * @param status Error pointer.
+  * @details
+  * Only validates cap: a lock-free stack keeps every node until delete,
+  * since a concurrent pop may still read a node after it was removed.
+  */
+void LDSC_lockFreeStack_setPoolCap(LDSC_stack* self, int cap, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (cap < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  return;
+}
+
+/**
+  * @brief Copy the operation counters of the stack.
+  * @param self Stack pointer.
+  * @param out Stats pointer receiving the counters.
+  * @param status Error pointer.
+  * @details
+  * Nodes are allocated a segment at a time and released only by delete,
+  * so nodeFrees stays 0 and nodesTraversed is not used.
+  * Under concurrent use the counters are read one by one, not as a snapshot.
+  */
+void LDSC_lockFreeStack_stats(LDSC_stack* self, LDSC_stats* out, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!out) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  *out = (LDSC_stats){ 0 };
+#ifdef LDSC_STATS
+  LockFree_stats* stats = &self->pd->stats;
+  out->inserts = atomic_load_explicit(&stats->inserts, memory_order_relaxed);
+  out->removals = atomic_load_explicit(&stats->removals, memory_order_relaxed);
+  out->lookups = atomic_load_explicit(&stats->lookups, memory_order_relaxed);
+  out->nodeAllocs = atomic_load_explicit(&stats->nodeAllocs, memory_order_relaxed);
+  out->highWater = atomic_load_explicit(&stats->highWater, memory_order_relaxed);
+#endif
+  return;
+}
+
+/**
+  * @brief Zero the operation counters of the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  */
+void LDSC_lockFreeStack_resetStats(LDSC_stack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  LockFree_stats* stats = &self->pd->stats;
+  atomic_store_explicit(&stats->inserts, 0, memory_order_relaxed);
+  atomic_store_explicit(&stats->removals, 0, memory_order_relaxed);
+  atomic_store_explicit(&stats->lookups, 0, memory_order_relaxed);
+  atomic_store_explicit(&stats->nodeAllocs, 0, memory_order_relaxed);
+  atomic_store_explicit(&stats->highWater, LDSC_lockFreeStack_size(self, NULL), memory_order_relaxed);
+#endif
+  return;
+}
+
+/**
+  * @brief Reject latency sampling, which the lock-free stack does not support.
+  * @param self Stack pointer.
+  * @param insertHist Histogram that would receive push latencies.
+  * @param removeHist Histogram that would receive pop latencies.
+  * @param rate Sampling rate.
+  * @param status Error pointer.
+  * @details
+  * A histogram cannot be shared by concurrent threads, so the lock-free
+  * stack never samples. Switching sampling off succeeds, anything else
+  * reports ERROR; time calls into per-thread histograms and merge them
+  * instead.
+  */
+void LDSC_lockFreeStack_sampleLatency(LDSC_stack* self, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (rate < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  if (rate && (insertHist || removeHist)) {
+    if (status) *status = ERROR;
+    return;
+  }
+
+  return;
+}
+
+/**
+  * @brief Delete the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  * @details
+  * No thread may use the stack during or after delete.
+  */
+void LDSC_lockFreeStack_delete(LDSC_stack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  for (int k = 0; k < LOCKFREE_SEGMENT_COUNT; k++) {
+    Node* segment = atomic_load_explicit(&self->pd->segments[k], memory_order_relaxed);
+    if (segment)
+      allocator.free(segment, Segment_nodes(k) * sizeof(Node), allocator.context);
+  }
+
+  allocator.free(self, sizeof(Instance), allocator.context);
+  return;
+}
+
+/** method table copied into every new lock-free stack */
+static const LDSC_stack LDSC_lockFreeStack_methods = {
+  .size = &LDSC_lockFreeStack_size,
+  .push = &LDSC_lockFreeStack_push,
+  .empty = &LDSC_lockFreeStack_empty,
+  .peek = &LDSC_lockFreeStack_peek,
+  .pop = &LDSC_lockFreeStack_pop,
+  .pushMany = &LDSC_lockFreeStack_pushMany,
+  .popMany = &LDSC_lockFreeStack_popMany,
+  .reserve = &LDSC_lockFreeStack_reserve,
+  .setPoolCap = &LDSC_lockFreeStack_setPoolCap,
+  .stats = &LDSC_lockFreeStack_stats,
+  .resetStats = &LDSC_lockFreeStack_resetStats,
+  .sampleLatency = &LDSC_lockFreeStack_sampleLatency,
+  .delete = &LDSC_lockFreeStack_delete
+};
+
+/**
+ * @brief Create a new lock-free stack.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_stack.
+ */
+LDSC_stack* LDSC_stack_init_lockfree(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  Instance* instance = allocator->alloc(sizeof(Instance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  LDSC_stack* newStack = &instance->self;
+  *newStack = LDSC_lockFreeStack_methods;
+  newStack->pd = &instance->pd;
+
+  for (int k = 0; k < LOCKFREE_SEGMENT_COUNT; k++)
+    atomic_init(&newStack->pd->segments[k], NULL);
+  atomic_init(&newStack->pd->nodeCount, 0);
+  newStack->pd->allocator = *allocator;
+  atomic_init(&newStack->pd->top, 0);
+  atomic_init(&newStack->pd->size, 0);
+  atomic_init(&newStack->pd->freeList, 0);
+#ifdef LDSC_STATS
+  atomic_init(&newStack->pd->stats.inserts, 0);
+  atomic_init(&newStack->pd->stats.removals, 0);
+  atomic_init(&newStack->pd->stats.lookups, 0);
+  atomic_init(&newStack->pd->stats.nodeAllocs, 0);
+  atomic_init(&newStack->pd->stats.highWater, 0);
+#endif
+
+  return newStack;
+}
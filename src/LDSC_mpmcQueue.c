@@ -0,0 +1,262 @@
+#include <LDSC_mpmcQueue.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/** assumed cache line size used to keep the positions apart */
+#define MPMC_CACHE_LINE 64
+
+/** largest capacity a MPMC queue may hold */
+#define MPMC_MAX_CAPACITY (1 << 30)
+
+/**
+  * @brief Slot of the queue buffer.
+  * @details
+  * sequence equals the slot index when the slot is free for the enqueue at
+  * that position, and index + 1 once it holds data for the matching dequeue.
+  */
+typedef struct Cell {
+  atomic_size_t sequence;
+  void* dataPtr;
+} Cell;
+
+/**
+  * @brief Opaque container for private data.
+  */
+struct privateData {
+  Cell* buffer;
+  size_t mask;
+  LDSC_allocator allocator;
+
+  char padEnqueue[MPMC_CACHE_LINE];
+  atomic_size_t enqueuePos;
+
+  char padDequeue[MPMC_CACHE_LINE];
+  atomic_size_t dequeuePos;
+
+  char padEnd[MPMC_CACHE_LINE];
+};
+
+/** round capacity up to the next power of two */
+static size_t MpmcQueue_roundUp(int capacity) {
+  size_t size = 1;
+  while (size < (size_t)capacity)
+    size <<= 1;
+  return size;
+}
+
+/**************************************************/
+/* LDSC_mpmcQueue */
+
+/**
+  * @brief Get length of the queue.
+  * @param self MPMC queue pointer.
+  * @param status Error pointer.
+  * @return Length of the queue as integer type.
+  */
+int LDSC_mpmcQueue_length(LDSC_mpmcQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  size_t dequeuePos = atomic_load_explicit(&self->pd->dequeuePos, memory_order_acquire);
+  size_t enqueuePos = atomic_load_explicit(&self->pd->enqueuePos, memory_order_acquire);
+  intptr_t length = (intptr_t)(enqueuePos - dequeuePos);
+  return length > 0 ? (int)length : 0;
+}
+
+/**
+  * @brief Check is queue is empty.
+  * @param self MPMC queue pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_mpmcQueue_empty(LDSC_mpmcQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return LDSC_mpmcQueue_length(self, NULL) == 0;
+}
+
+/**
+  * @brief Try to add item to end of the queue.
+  * @param self MPMC queue pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that tryEnqueue performs a shallow copy of the data.
+  */
+void LDSC_mpmcQueue_tryEnqueue(LDSC_mpmcQueue* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  Cell* cell;
+  size_t pos = atomic_load_explicit(&pd->enqueuePos, memory_order_relaxed);
+  for (;;) {
+    cell = &pd->buffer[pos & pd->mask];
+    size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+    intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+    if (diff == 0) {
+      if (atomic_compare_exchange_weak_explicit(&pd->enqueuePos, &pos, pos + 1,
+                                                memory_order_relaxed, memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      if (status) *status = STRUCTURE_FULL;
+      return;
+    } else {
+      pos = atomic_load_explicit(&pd->enqueuePos, memory_order_relaxed);
+    }
+  }
+
+  cell->dataPtr = dataPtr;
+  atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+  return;
+}
+
+/**
+  * @brief Try to remove item from front of the queue.
+  * @param self MPMC queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_mpmcQueue_tryDequeue(LDSC_mpmcQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  Cell* cell;
+  size_t pos = atomic_load_explicit(&pd->dequeuePos, memory_order_relaxed);
+  for (;;) {
+    cell = &pd->buffer[pos & pd->mask];
+    size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+    intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+    if (diff == 0) {
+      if (atomic_compare_exchange_weak_explicit(&pd->dequeuePos, &pos, pos + 1,
+                                                memory_order_relaxed, memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      if (status) *status = STRUCTURE_EMPTY;
+      return NULL;
+    } else {
+      pos = atomic_load_explicit(&pd->dequeuePos, memory_order_relaxed);
+    }
+  }
+
+  void* dataFront = cell->dataPtr;
+  atomic_store_explicit(&cell->sequence, pos + pd->mask + 1, memory_order_release);
+  return dataFront;
+}
+
+/**
+  * @brief Delete the queue.
+  * @param self MPMC queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_mpmcQueue_delete(LDSC_mpmcQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd->buffer, (self->pd->mask + 1) * sizeof(Cell), allocator.context);
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_mpmcQueue), allocator.context);
+  return;
+}
+
+/**
+ * @brief Create a new MPMC queue.
+ * @param capacity Maximum number of items, rounded up to a power of two.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_mpmcQueue.
+ */
+LDSC_mpmcQueue* LDSC_mpmcQueue_init(int capacity, LDSC_error* status) {
+  return LDSC_mpmcQueue_init_with(NULL, capacity, status);
+}
+
+/**
+ * @brief Create a new MPMC queue using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Maximum number of items, rounded up to a power of two.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_mpmcQueue.
+ */
+LDSC_mpmcQueue* LDSC_mpmcQueue_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (capacity <= 0 || capacity > MPMC_MAX_CAPACITY) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_mpmcQueue* newQueue = allocator->alloc(sizeof(LDSC_mpmcQueue), allocator->context);
+  if (!newQueue) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newQueue->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newQueue->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newQueue, sizeof(LDSC_mpmcQueue), allocator->context);
+    return NULL;
+  }
+
+  size_t size = MpmcQueue_roundUp(capacity);
+  newQueue->pd->buffer = allocator->alloc(size * sizeof(Cell), allocator->context);
+  if (!newQueue->pd->buffer) {
+    if (status) *status = BUFFER_MALLOC;
+    allocator->free(newQueue->pd, sizeof(privateData), allocator->context);
+    allocator->free(newQueue, sizeof(LDSC_mpmcQueue), allocator->context);
+    return NULL;
+  }
+
+  for (size_t i = 0; i < size; i++)
+    atomic_init(&newQueue->pd->buffer[i].sequence, i);
+
+  newQueue->pd->mask = size - 1;
+  newQueue->pd->allocator = *allocator;
+  atomic_init(&newQueue->pd->enqueuePos, 0);
+  atomic_init(&newQueue->pd->dequeuePos, 0);
+
+  newQueue->empty = &LDSC_mpmcQueue_empty;
+  newQueue->length = &LDSC_mpmcQueue_length;
+  newQueue->tryEnqueue = &LDSC_mpmcQueue_tryEnqueue;
+  newQueue->tryDequeue = &LDSC_mpmcQueue_tryDequeue;
+  newQueue->delete = &LDSC_mpmcQueue_delete;
+
+  return newQueue;
+}
+
@@ -0,0 +1,436 @@
+#include <LDSC_priorityQueue.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** largest capacity a priority queue may grow to */
+#define PRIORITYQUEUE_MAX_CAPACITY (1 << 30)
+
+/** heap entry, the item and the handle whose position follows it */
+typedef struct Entry {
+  void* dataPtr;
+  int handle;
+} Entry;
+
+/**
+  * @brief Opaque container for private data.
+  * @details
+  * position[h] is the heap index of the item with handle h. Free handles
+  * form a list through position, holding -2 - next so they stay negative.
+  */
+struct privateData {
+  int length;
+  int capacity;
+  int arity;
+  Entry* heap;
+  int* position;
+  int freeHandle;
+  int (*cmp)(const void* a, const void* b);
+  LDSC_allocator allocator;
+};
+
+/** structure and private data allocated as one block */
+typedef struct Instance {
+  LDSC_priorityQueue self;
+  privateData pd;
+} Instance;
+
+/** take a handle from the free list */
+static int Handle_take(privateData* pd) {
+  int handle = pd->freeHandle;
+  pd->freeHandle = -2 - pd->position[handle];
+  return handle;
+}
+
+/** return a handle to the free list */
+static void Handle_release(privateData* pd, int handle) {
+  pd->position[handle] = -2 - pd->freeHandle;
+  pd->freeHandle = handle;
+}
+
+/** grow the buffers to hold at least count items, 0 if they could not be allocated */
+static int Heap_reserve(privateData* pd, long count) {
+  if (count <= pd->capacity) return 1;
+  if (count > PRIORITYQUEUE_MAX_CAPACITY) return 0;
+
+  int capacity = pd->capacity;
+  while (capacity < count) capacity *= 2;
+
+  Entry* heap = pd->allocator.alloc((size_t)capacity * sizeof(Entry), pd->allocator.context);
+  if (!heap) return 0;
+  int* position = pd->allocator.alloc((size_t)capacity * sizeof(int), pd->allocator.context);
+  if (!position) {
+    pd->allocator.free(heap, (size_t)capacity * sizeof(Entry), pd->allocator.context);
+    return 0;
+  }
+
+  memcpy(heap, pd->heap, (size_t)pd->length * sizeof(Entry));
+  memcpy(position, pd->position, (size_t)pd->capacity * sizeof(int));
+  pd->allocator.free(pd->heap, (size_t)pd->capacity * sizeof(Entry), pd->allocator.context);
+  pd->allocator.free(pd->position, (size_t)pd->capacity * sizeof(int), pd->allocator.context);
+  pd->heap = heap;
+  pd->position = position;
+
+  for (int handle = capacity - 1; handle >= pd->capacity; handle--)
+    Handle_release(pd, handle);
+  pd->capacity = capacity;
+  return 1;
+}
+
+/** store entry at heap index pos */
+static void Heap_place(privateData* pd, int pos, Entry entry) {
+  pd->heap[pos] = entry;
+  pd->position[entry.handle] = pos;
+}
+
+/** move the entry at pos up past larger parents, return its final index */
+static int Heap_siftUp(privateData* pd, int pos) {
+  Entry entry = pd->heap[pos];
+  while (pos > 0) {
+    int parent = (pos - 1) / pd->arity;
+    if (pd->cmp(entry.dataPtr, pd->heap[parent].dataPtr) >= 0) break;
+    Heap_place(pd, pos, pd->heap[parent]);
+    pos = parent;
+  }
+  Heap_place(pd, pos, entry);
+  return pos;
+}
+
+/** move the entry at pos down past smaller children, return its final index */
+static int Heap_siftDown(privateData* pd, int pos) {
+  Entry entry = pd->heap[pos];
+  for (;;) {
+    long first = (long)pos * pd->arity + 1;
+    if (first >= pd->length) break;
+    long last = first + pd->arity < pd->length ? first + pd->arity : pd->length;
+
+    int best = (int)first;
+    for (int child = best + 1; child < last; child++)
+      if (pd->cmp(pd->heap[child].dataPtr, pd->heap[best].dataPtr) < 0)
+        best = child;
+    if (pd->cmp(pd->heap[best].dataPtr, entry.dataPtr) >= 0) break;
+
+    Heap_place(pd, pos, pd->heap[best]);
+    pos = best;
+  }
+  Heap_place(pd, pos, entry);
+  return pos;
+}
+
+/**************************************************/
+/* LDSC_priorityQueue */
+
+/**
+  * @brief Get length of the priority queue.
+  * @param self Priority queue pointer.
+  * @param status Error pointer.
+  * @return Length of the priority queue as integer type.
+  */
+int LDSC_priorityQueue_length(LDSC_priorityQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length;
+}
+
+/**
+  * @brief Check if priority queue is empty.
+  * @param self Priority queue pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_priorityQueue_empty(LDSC_priorityQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length == 0;
+}
+
+/**
+  * @brief Add an item to the priority queue.
+  * @param self Priority queue pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @return Handle of the item, ERROR on failure.
+  * @details
+  * Keep note that push performs a shallow copy of the data.
+  */
+int LDSC_priorityQueue_push(LDSC_priorityQueue* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return ERROR;
+  }
+
+  privateData* pd = self->pd;
+  if (!Heap_reserve(pd, (long)pd->length + 1)) {
+    if (status) *status = BUFFER_MALLOC;
+    return ERROR;
+  }
+
+  int handle = Handle_take(pd);
+  int pos = pd->length++;
+  Heap_place(pd, pos, (Entry){ dataPtr, handle });
+  Heap_siftUp(pd, pos);
+  return handle;
+}
+
+/**
+  * @brief Remove the smallest item from the priority queue.
+  * @param self Priority queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to the smallest item.
+  */
+void* LDSC_priorityQueue_pop(LDSC_priorityQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  if (!pd->length)
+    return NULL;
+
+  Entry top = pd->heap[0];
+  Handle_release(pd, top.handle);
+  if (--pd->length) {
+    Heap_place(pd, 0, pd->heap[pd->length]);
+    Heap_siftDown(pd, 0);
+  }
+  return top.dataPtr;
+}
+
+/**
+  * @brief Peek the smallest item of the priority queue.
+  * @param self Priority queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to the smallest item.
+  */
+void* LDSC_priorityQueue_peek(LDSC_priorityQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!self->pd->length)
+    return NULL;
+
+  return self->pd->heap[0].dataPtr;
+}
+
+/**
+  * @brief Add many items at once.
+  * @param self Priority queue pointer.
+  * @param items Array of data pointers.
+  * @param count Number of items.
+  * @param handles Array receiving the handle of each item, may be NULL.
+  * @param status Error pointer.
+  * @details
+  * Floyd's construction: after appending, every node that has children is
+  * sifted down, from the last one back to the root.
+  */
+void LDSC_priorityQueue_heapify(LDSC_priorityQueue* self, void** items, int count, int* handles, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!items[i]) {
+      if (status) *status = NULL_DATAPTR;
+      return;
+    }
+  }
+
+  privateData* pd = self->pd;
+  if (!Heap_reserve(pd, (long)pd->length + count)) {
+    if (status) *status = BUFFER_MALLOC;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    int handle = Handle_take(pd);
+    Heap_place(pd, pd->length++, (Entry){ items[i], handle });
+    if (handles) handles[i] = handle;
+  }
+
+  for (int pos = (pd->length - 2) / pd->arity; pos >= 0 && pd->length > 1; pos--)
+    Heap_siftDown(pd, pos);
+  return;
+}
+
+/**
+  * @brief Move an item whose key was lowered towards the front.
+  * @param self Priority queue pointer.
+  * @param handle Handle returned when the item was added.
+  * @param dataPtr New pointer to data.
+  * @param status Error pointer.
+  */
+void LDSC_priorityQueue_decreaseKey(LDSC_priorityQueue* self, int handle, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  if (handle < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return;
+  }
+
+  if (handle >= pd->capacity) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return;
+  }
+
+  int pos = pd->position[handle];
+  if (pos < 0) {
+    if (status) *status = ERROR;
+    return;
+  }
+
+  pd->heap[pos].dataPtr = dataPtr;
+  if (Heap_siftUp(pd, pos) == pos)
+    Heap_siftDown(pd, pos);
+  return;
+}
+
+/**
+  * @brief Delete the priority queue.
+  * @param self Priority queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_priorityQueue_delete(LDSC_priorityQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd->heap, (size_t)self->pd->capacity * sizeof(Entry), allocator.context);
+  allocator.free(self->pd->position, (size_t)self->pd->capacity * sizeof(int), allocator.context);
+  allocator.free(self, sizeof(Instance), allocator.context);
+  return;
+}
+
+/** method table copied into every new priority queue */
+static const LDSC_priorityQueue LDSC_priorityQueue_methods = {
+  .length = &LDSC_priorityQueue_length,
+  .empty = &LDSC_priorityQueue_empty,
+  .push = &LDSC_priorityQueue_push,
+  .pop = &LDSC_priorityQueue_pop,
+  .peek = &LDSC_priorityQueue_peek,
+  .heapify = &LDSC_priorityQueue_heapify,
+  .decreaseKey = &LDSC_priorityQueue_decreaseKey,
+  .delete = &LDSC_priorityQueue_delete
+};
+
+/**
+ * @brief Create a new priority queue.
+ * @param cmp Function comparing two data pointers.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_priorityQueue.
+ */
+LDSC_priorityQueue* LDSC_priorityQueue_init(int (*cmp)(const void* a, const void* b), LDSC_error* status) {
+  return LDSC_priorityQueue_init_with(NULL, 0, cmp, status);
+}
+
+/**
+ * @brief Create a new priority queue with explicit arity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param arity Children per heap node, 0 for LDSC_PRIORITYQUEUE_DEFAULT_ARITY.
+ * @param cmp Function comparing two data pointers.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_priorityQueue.
+ */
+LDSC_priorityQueue* LDSC_priorityQueue_init_with(const LDSC_allocator* allocator, int arity, int (*cmp)(const void* a, const void* b), LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!cmp) {
+    if (status) *status = NULL_DATAPTR;
+    return NULL;
+  }
+
+  if (!arity) arity = LDSC_PRIORITYQUEUE_DEFAULT_ARITY;
+  if (arity < 2 || arity > LDSC_PRIORITYQUEUE_MAX_ARITY) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  Instance* instance = allocator->alloc(sizeof(Instance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  const int capacity = LDSC_PRIORITYQUEUE_DEFAULT_CAPACITY;
+  Entry* heap = allocator->alloc((size_t)capacity * sizeof(Entry), allocator->context);
+  int* position = heap ? allocator->alloc((size_t)capacity * sizeof(int), allocator->context) : NULL;
+  if (!position) {
+    if (status) *status = BUFFER_MALLOC;
+    if (heap) allocator->free(heap, (size_t)capacity * sizeof(Entry), allocator->context);
+    allocator->free(instance, sizeof(Instance), allocator->context);
+    return NULL;
+  }
+
+  LDSC_priorityQueue* newQueue = &instance->self;
+  *newQueue = LDSC_priorityQueue_methods;
+  newQueue->pd = &instance->pd;
+
+  newQueue->pd->length = 0;
+  newQueue->pd->capacity = capacity;
+  newQueue->pd->arity = arity;
+  newQueue->pd->heap = heap;
+  newQueue->pd->position = position;
+  newQueue->pd->freeHandle = -1;
+  newQueue->pd->cmp = cmp;
+  newQueue->pd->allocator = *allocator;
+  for (int handle = capacity - 1; handle >= 0; handle--)
+    Handle_release(newQueue->pd, handle);
+
+  return newQueue;
+}
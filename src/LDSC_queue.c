@@ -1,22 +1,18 @@
 #include <LDSC_queue.h>
+#include <LDSC_queueFast.h>
+#include <LDSC_queueRef.h>
+#include <stddef.h>
 #include <stdlib.h>
 
 /** node structure */
 typedef struct Node {
   void* dataPtr;
   struct Node* next;
+#ifdef LDSC_TIMING
+  long long enqueuedAt;
+#endif
 } Node;
 
-/** create and return a new queue node */
-static Node* Node_init(void* dataPtr) {
-  Node* newNode = (Node*)malloc(sizeof(Node));
-  if (!newNode) return NULL;
-
-  newNode->dataPtr = dataPtr;
-  newNode->next = NULL;
-  return newNode;
-}
-
 /**
   * @brief Opaque container for private data.
   */
@@ -24,57 +20,200 @@ struct privateData {
   int length;
   Node* front;
   Node* back;
+  LDSC_allocator allocator;
+  Node* pool;
+  int poolSize;
+  int poolCap;
+#ifdef LDSC_TIMING
+  int residencyOn;
+  LDSC_histogram* residencyHist;
+  LDSC_latency insertLatency;
+  LDSC_latency removeLatency;
+#endif
+#ifdef LDSC_STATS
+  LDSC_stats stats;
+#endif
 };
 
+/** structure and private data allocated as one block */
+typedef struct Instance {
+  LDSC_queue self;
+  privateData pd;
+} Instance;
+
+/** compact handle and private data allocated as one block */
+typedef struct RefInstance {
+  LDSC_queueRef ref;
+  privateData pd;
+} RefInstance;
+
+/** layout tag of the settings this file is built with, see LDSC_LAYOUT_TAG */
+const int LDSC_LAYOUT_TAG(LDSC_queue) = 1;
+
+/* the inline fast path in LDSC_queueFast.h relies on these layouts */
+_Static_assert(sizeof(Node) == sizeof(LDSC_queueFastNode), "LDSC_queueFastNode mirrors Node");
+_Static_assert(offsetof(Node, next) == offsetof(LDSC_queueFastNode, next), "LDSC_queueFastNode mirrors Node");
+#ifdef LDSC_TIMING
+_Static_assert(offsetof(Node, enqueuedAt) == offsetof(LDSC_queueFastNode, enqueuedAt), "LDSC_queueFastNode mirrors Node");
+#else
+_Static_assert(sizeof(Node) == 2 * sizeof(void*), "a queue node holds only its data and link");
+#endif
+_Static_assert(sizeof(privateData) == sizeof(LDSC_queueFastData), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, length) == offsetof(LDSC_queueFastData, length), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, front) == offsetof(LDSC_queueFastData, front), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, back) == offsetof(LDSC_queueFastData, back), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, allocator) == offsetof(LDSC_queueFastData, allocator), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, pool) == offsetof(LDSC_queueFastData, pool), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, poolSize) == offsetof(LDSC_queueFastData, poolSize), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, poolCap) == offsetof(LDSC_queueFastData, poolCap), "LDSC_queueFastData mirrors privateData");
+#ifdef LDSC_TIMING
+_Static_assert(offsetof(privateData, residencyOn) == offsetof(LDSC_queueFastData, residencyOn), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, residencyHist) == offsetof(LDSC_queueFastData, residencyHist), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, insertLatency) == offsetof(LDSC_queueFastData, insertLatency), "LDSC_queueFastData mirrors privateData");
+_Static_assert(offsetof(privateData, removeLatency) == offsetof(LDSC_queueFastData, removeLatency), "LDSC_queueFastData mirrors privateData");
+#endif
+#ifdef LDSC_STATS
+_Static_assert(offsetof(privateData, stats) == offsetof(LDSC_queueFastData, stats), "LDSC_queueFastData mirrors privateData");
+#endif
+
+/** create and return a new queue node, reusing a pooled node if available */
+static Node* Node_init(privateData* pd, void* dataPtr) {
+  Node* newNode = pd->pool;
+  if (newNode) {
+    pd->pool = newNode->next;
+    pd->poolSize--;
+  } else {
+    newNode = (Node*)pd->allocator.alloc(sizeof(Node), pd->allocator.context);
+    if (!newNode) return NULL;
+    LDSC_STATS_ADD(pd, nodeAllocs, 1);
+  }
+
+  newNode->dataPtr = dataPtr;
+  newNode->next = NULL;
+#ifdef LDSC_TIMING
+  newNode->enqueuedAt = pd->residencyOn ? LDSC_histogram_now() : 0;
+#endif
+  return newNode;
+}
+
+/** release a queue node, keeping it in the pool if there is room */
+static void Node_free(privateData* pd, Node* node) {
+  if (pd->poolSize < pd->poolCap) {
+    node->next = pd->pool;
+    pd->pool = node;
+    pd->poolSize++;
+    return;
+  }
+  pd->allocator.free(node, sizeof(Node), pd->allocator.context);
+  LDSC_STATS_ADD(pd, nodeFrees, 1);
+}
+
+/** build a chain of count nodes holding items in order, NULL if a node could not be allocated */
+static Node* Node_initChain(privateData* pd, void** items, int count, Node** last) {
+  Node* first = NULL;
+  Node** link = &first;
+  for (int i = 0; i < count; i++) {
+    Node* newNode = Node_init(pd, items[i]);
+    if (!newNode) {
+      while (first) {
+        Node* nextNode = first->next;
+        Node_free(pd, first);
+        first = nextNode;
+      }
+      return NULL;
+    }
+
+    *link = newNode;
+    link = &newNode->next;
+    *last = newNode;
+  }
+  return first;
+}
+
+/** release pooled nodes until the pool holds at most count nodes */
+static void Node_trimPool(privateData* pd, int count) {
+  while (pd->poolSize > count) {
+    Node* node = pd->pool;
+    pd->pool = node->next;
+    pd->poolSize--;
+    pd->allocator.free(node, sizeof(Node), pd->allocator.context);
+    LDSC_STATS_ADD(pd, nodeFrees, 1);
+  }
+}
+
+#ifdef LDSC_TIMING
+/** set a latency sampler to time every rate-th call into hist, off if hist is NULL or rate is 0 */
+static void Latency_set(LDSC_latency* latency, LDSC_histogram* hist, int rate) {
+  latency->hist = hist;
+  latency->rate = hist ? rate : 0;
+  latency->countdown = latency->rate;
+}
+#endif
+
+/** record how long a dequeued node waited if it carries a stamp and a histogram is set */
+static void Node_recordResidency(privateData* pd, Node* node, long long now) {
+#ifdef LDSC_TIMING
+  if (pd->residencyOn && pd->residencyHist && node->enqueuedAt)
+    pd->residencyHist->record(pd->residencyHist, now - node->enqueuedAt, NULL);
+#else
+  (void)pd;
+  (void)node;
+  (void)now;
+#endif
+}
+
+/** set up empty private data using allocator */
+static void Queue_setup(privateData* pd, const LDSC_allocator* allocator) {
+  pd->length = 0;
+  pd->front = NULL;
+  pd->back = NULL;
+  pd->allocator = *allocator;
+  pd->pool = NULL;
+  pd->poolSize = 0;
+  pd->poolCap = LDSC_NODE_POOL_DEFAULT_CAP;
+#ifdef LDSC_TIMING
+  pd->residencyOn = 0;
+  pd->residencyHist = NULL;
+  Latency_set(&pd->insertLatency, NULL, 0);
+  Latency_set(&pd->removeLatency, NULL, 0);
+#endif
+#ifdef LDSC_STATS
+  pd->stats = (LDSC_stats){ 0 };
+#endif
+}
+
 /**************************************************/
-/* LDSC_queue */
+/* operations on the private data of a queue, a NULL pd reports NULL_SELF */
 
-/**
-  * @brief Check is queue is empty.
-  * @param self Queue pointer.
-  * @param status Error pointer.
-  * @return Integer where 1 = empty and 0 = not empty.
-  */
-int LDSC_queue_empty(LDSC_queue* self, LDSC_error* status) {
+/** check is queue is empty */
+static int Queue_empty(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return ERROR;
   }
 
-  return self->pd->length == 0;
+  return pd->length == 0;
 }
 
-/**
-  * @brief Get length of the queue.
-  * @param self Queue pointer.
-  * @param status Error pointer.
-  * @return Length of the stack as integer type.
-  */
-int LDSC_queue_length(LDSC_queue* self, LDSC_error* status) {
+/** get length of the queue */
+static int Queue_length(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
   
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return ERROR;
   }
 
-  return self->pd->length;
+  return pd->length;
 }
 
-/**
-  * @brief Add item to end of the queue.
-  * @param self Queue pointer.
-  * @param dataPtr Pointer to data.
-  * @param status Error pointer.
-  * @details
-  * Keep note that enqueue performs a shallow copy of the data.
-  */
-void LDSC_queue_enqueue(LDSC_queue* self, void* dataPtr, LDSC_error* status) {
+/** add item to end of the queue */
+static void Queue_enqueue(privateData* pd, void* dataPtr, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
@@ -85,49 +224,396 @@ void LDSC_queue_enqueue(LDSC_queue* self, void* dataPtr, LDSC_error* status) {
   }
 
 
-  Node* newNode = Node_init(dataPtr);
+  long long start = LDSC_LATENCY_START(pd, insertLatency);
+  Node* newNode = Node_init(pd, dataPtr);
   if (!newNode) {
     if (status) *status = NODE_MALLOC;
     return;
   }
 
-  if (!self->pd->back) {
-    self->pd->front = newNode;
+  if (!pd->back) {
+    pd->front = newNode;
   } else {
-    self->pd->back->next = newNode;
+    pd->back->next = newNode;
   }
-  self->pd->back = newNode;
-  self->pd->length++;
+  pd->back = newNode;
+  pd->length++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->length);
+  LDSC_LATENCY_STOP(pd, insertLatency, start);
 
   return;
 }
 
-/**
-  * @brief Remove item from fron of the queue.
-  * @param self Queue pointer.
-  * @param status Error pointer.
-  * @return Pointer to data at the front of the queue.
-  */
-void* LDSC_queue_dequeue(LDSC_queue* self, LDSC_error* status) {
+/** remove item from fron of the queue */
+static void* Queue_dequeue(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return NULL;
   }
 
-  if (!self->pd->front)
+  if (!pd->front)
     return NULL;
 
-  Node* oldFront = self->pd->front;
+  long long start = LDSC_LATENCY_START(pd, removeLatency);
+  Node* oldFront = pd->front;
   void* dataFront = oldFront->dataPtr;
-  self->pd->front = oldFront->next;
-  self->pd->length--;
-
-  free(oldFront);
+  pd->front = oldFront->next;
+  if (!pd->front)
+    pd->back = NULL;
+  pd->length--;
+  LDSC_STATS_ADD(pd, removals, 1);
+  if (LDSC_QUEUE_RESIDENCY_ON(pd))
+    Node_recordResidency(pd, oldFront, LDSC_histogram_now());
+
+  Node_free(pd, oldFront);
+  LDSC_LATENCY_STOP(pd, removeLatency, start);
   return dataFront;
 }
 
+/** add items to end of the queue */
+static void Queue_enqueueMany(privateData* pd, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!items[i]) {
+      if (status) *status = NULL_DATAPTR;
+      return;
+    }
+  }
+
+  if (!count)
+    return;
+
+  Node* last = NULL;
+  Node* first = Node_initChain(pd, items, count, &last);
+  if (!first) {
+    if (status) *status = NODE_MALLOC;
+    return;
+  }
+
+  if (!pd->back) {
+    pd->front = first;
+  } else {
+    pd->back->next = first;
+  }
+  pd->back = last;
+  pd->length += count;
+  LDSC_STATS_ADD(pd, inserts, count);
+  LDSC_STATS_LENGTH(pd, pd->length);
+
+  return;
+}
+
+/** remove up to count items from front of the queue */
+static int Queue_dequeueMany(privateData* pd, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  long long now = LDSC_QUEUE_RESIDENCY_ON(pd) ? LDSC_histogram_now() : 0;
+  int total = 0;
+  while (total < count && pd->front) {
+    Node* oldFront = pd->front;
+    items[total++] = oldFront->dataPtr;
+    pd->front = oldFront->next;
+    Node_recordResidency(pd, oldFront, now);
+    Node_free(pd, oldFront);
+  }
+
+  if (!pd->front)
+    pd->back = NULL;
+  pd->length -= total;
+  LDSC_STATS_ADD(pd, removals, total);
+
+  return total;
+}
+
+/** peek item at the front of the queue */
+static void* Queue_peek(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+  
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!pd->front)
+    return NULL;
+
+  LDSC_STATS_ADD(pd, lookups, 1);
+  return pd->front->dataPtr;
+}
+
+/** pre-allocate nodes into the node pool */
+static void Queue_reserve(privateData* pd, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  if (count > pd->poolCap)
+    pd->poolCap = count;
+
+  while (pd->poolSize < count) {
+    Node* newNode = (Node*)pd->allocator.alloc(sizeof(Node), pd->allocator.context);
+    if (!newNode) {
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+    LDSC_STATS_ADD(pd, nodeAllocs, 1);
+
+    newNode->next = pd->pool;
+    pd->pool = newNode;
+    pd->poolSize++;
+  }
+
+  return;
+}
+
+/** set the maximum number of recycled nodes kept in the node pool */
+static void Queue_setPoolCap(privateData* pd, int cap, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (cap < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  pd->poolCap = cap;
+  Node_trimPool(pd, cap);
+  return;
+}
+
+/** copy the operation counters of the queue */
+static void Queue_stats(privateData* pd, LDSC_stats* out, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!out) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  *out = pd->stats;
+#else
+  *out = (LDSC_stats){ 0 };
+#endif
+  return;
+}
+
+/** zero the operation counters of the queue */
+static void Queue_resetStats(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  pd->stats = (LDSC_stats){ .highWater = pd->length };
+#endif
+  return;
+}
+
+/** time every rate-th enqueue and dequeue into latency histograms */
+static void Queue_sampleLatency(privateData* pd, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (rate < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+#ifdef LDSC_TIMING
+  Latency_set(&pd->insertLatency, insertHist, rate);
+  Latency_set(&pd->removeLatency, removeHist, rate);
+#else
+  if (rate && (insertHist || removeHist)) {
+    if (status) *status = ERROR;
+    return;
+  }
+#endif
+  return;
+}
+
+/** stamp enqueued items with their enqueue time */
+static void Queue_trackResidency(privateData* pd, int enable, LDSC_histogram* residencyHist, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+#ifdef LDSC_TIMING
+  pd->residencyOn = enable != 0;
+  pd->residencyHist = enable ? residencyHist : NULL;
+#else
+  (void)residencyHist;
+  if (enable) {
+    if (status) *status = ERROR;
+    return;
+  }
+#endif
+  return;
+}
+
+/** get how long the item at the front of the queue has waited */
+static long long Queue_peekAge(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+#ifdef LDSC_TIMING
+  Node* front = pd->front;
+  if (front && front->enqueuedAt)
+    return LDSC_histogram_now() - front->enqueuedAt;
+#else
+  if (status) *status = ERROR;
+#endif
+  return 0;
+}
+
+/** release every node of the queue, leaving only the block of the structure */
+static void Queue_release(privateData* pd, LDSC_error* status) {
+#ifdef LDSC_TIMING
+  pd->removeLatency.rate = 0;
+  pd->residencyOn = 0;
+#endif
+  while (pd->front) {
+    Queue_dequeue(pd, status);
+  }
+
+  Node_trimPool(pd, 0);
+}
+
+/**************************************************/
+/* LDSC_queue */
+
+/**
+  * @brief Check is queue is empty.
+  * @param self Queue pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_queue_empty(LDSC_queue* self, LDSC_error* status) {
+  return Queue_empty(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Get length of the queue.
+  * @param self Queue pointer.
+  * @param status Error pointer.
+  * @return Length of the stack as integer type.
+  */
+int LDSC_queue_length(LDSC_queue* self, LDSC_error* status) {
+  return Queue_length(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Add item to end of the queue.
+  * @param self Queue pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that enqueue performs a shallow copy of the data.
+  */
+void LDSC_queue_enqueue(LDSC_queue* self, void* dataPtr, LDSC_error* status) {
+  Queue_enqueue(self ? self->pd : NULL, dataPtr, status);
+}
+
+/**
+  * @brief Remove item from fron of the queue.
+  * @param self Queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_queue_dequeue(LDSC_queue* self, LDSC_error* status) {
+  return Queue_dequeue(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Add items to end of the queue.
+  * @param self Queue pointer.
+  * @param items Array of data pointers, items[0] is dequeued first.
+  * @param count Number of items.
+  * @param status Error pointer.
+  * @details
+  * Keep note that enqueueMany performs a shallow copy of the data.
+  */
+void LDSC_queue_enqueueMany(LDSC_queue* self, void** items, int count, LDSC_error* status) {
+  Queue_enqueueMany(self ? self->pd : NULL, items, count, status);
+}
+
+/**
+  * @brief Remove up to count items from front of the queue.
+  * @param self Queue pointer.
+  * @param items Array receiving the data pointers in dequeue order.
+  * @param count Maximum number of items to remove.
+  * @param status Error pointer.
+  * @return Number of items dequeued.
+  */
+int LDSC_queue_dequeueMany(LDSC_queue* self, void** items, int count, LDSC_error* status) {
+  return Queue_dequeueMany(self ? self->pd : NULL, items, count, status);
+}
+
 /**
   * @brief Peek item at the front of the queue.
   * @param self Queue pointer.
@@ -135,17 +621,89 @@ void* LDSC_queue_dequeue(LDSC_queue* self, LDSC_error* status) {
   * @return Pointer to data at the front of the queue.
   */
 void* LDSC_queue_peek(LDSC_queue* self, LDSC_error* status) {
-  if (status) *status = OK;
-  
-  if (!self) {
-    if (status) *status = NULL_SELF;
-    return NULL;
-  }
+  return Queue_peek(self ? self->pd : NULL, status);
+}
 
-  if (!self->pd->front)
-    return NULL;
+/**
+  * @brief Pre-allocate nodes into the node pool.
+  * @param self Queue pointer.
+  * @param count Number of nodes the pool should hold.
+  * @param status Error pointer.
+  * @details
+  * The pool capacity is raised to count if it is smaller.
+  */
+void LDSC_queue_reserve(LDSC_queue* self, int count, LDSC_error* status) {
+  Queue_reserve(self ? self->pd : NULL, count, status);
+}
+
+/**
+  * @brief Set the maximum number of recycled nodes kept in the node pool.
+  * @param self Queue pointer.
+  * @param cap Maximum number of pooled nodes, 0 disables pooling.
+  * @param status Error pointer.
+  */
+void LDSC_queue_setPoolCap(LDSC_queue* self, int cap, LDSC_error* status) {
+  Queue_setPoolCap(self ? self->pd : NULL, cap, status);
+}
+
+/**
+  * @brief Copy the operation counters of the queue.
+  * @param self Queue pointer.
+  * @param out Stats pointer receiving the counters.
+  * @param status Error pointer.
+  */
+void LDSC_queue_stats(LDSC_queue* self, LDSC_stats* out, LDSC_error* status) {
+  Queue_stats(self ? self->pd : NULL, out, status);
+}
+
+/**
+  * @brief Zero the operation counters of the queue.
+  * @param self Queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_queue_resetStats(LDSC_queue* self, LDSC_error* status) {
+  Queue_resetStats(self ? self->pd : NULL, status);
+}
 
-  return self->pd->front->dataPtr;
+/**
+  * @brief Time every rate-th enqueue and dequeue into latency histograms.
+  * @param self Queue pointer.
+  * @param insertHist Histogram receiving enqueue latencies, NULL to not time enqueue.
+  * @param removeHist Histogram receiving dequeue latencies, NULL to not time dequeue.
+  * @param rate Sampling rate, 0 switches sampling off.
+  * @param status Error pointer.
+  * @details
+  * Without LDSC_TIMING the sampler is not compiled in and anything but
+  * switching it off reports ERROR.
+  */
+void LDSC_queue_sampleLatency(LDSC_queue* self, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status) {
+  Queue_sampleLatency(self ? self->pd : NULL, insertHist, removeHist, rate, status);
+}
+
+/**
+  * @brief Stamp enqueued items with their enqueue time.
+  * @param self Queue pointer.
+  * @param enable 1 stamps items from now on, 0 stops stamping.
+  * @param residencyHist Histogram receiving residency times in nanoseconds, may be NULL.
+  * @param status Error pointer.
+  * @details
+  * Without LDSC_TIMING nodes carry no stamp and anything but switching
+  * tracking off reports ERROR.
+  */
+void LDSC_queue_trackResidency(LDSC_queue* self, int enable, LDSC_histogram* residencyHist, LDSC_error* status) {
+  Queue_trackResidency(self ? self->pd : NULL, enable, residencyHist, status);
+}
+
+/**
+  * @brief Get how long the item at the front of the queue has waited.
+  * @param self Queue pointer.
+  * @param status Error pointer.
+  * @return Age of the oldest item in nanoseconds.
+  * @details
+  * Without LDSC_TIMING nodes carry no stamp and this reports ERROR.
+  */
+long long LDSC_queue_peekAge(LDSC_queue* self, LDSC_error* status) {
+  return Queue_peekAge(self ? self->pd : NULL, status);
 }
 
 /**
@@ -161,48 +719,146 @@ void LDSC_queue_delete(LDSC_queue* self, LDSC_error* status) {
     return;
   }
 
-  while (self->pd->front) {
-    self->dequeue(self, status);
-  }
+  Queue_release(self->pd, status);
 
-  free(self->pd);
-  free(self);
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(Instance), allocator.context);
   return;
 }
 
+/** method table copied into every new queue */
+static const LDSC_queue LDSC_queue_methods = {
+  .empty = &LDSC_queue_empty,
+  .length = &LDSC_queue_length,
+  .enqueue = &LDSC_queue_enqueue,
+  .dequeue = &LDSC_queue_dequeue,
+  .peek = &LDSC_queue_peek,
+  .enqueueMany = &LDSC_queue_enqueueMany,
+  .dequeueMany = &LDSC_queue_dequeueMany,
+  .reserve = &LDSC_queue_reserve,
+  .setPoolCap = &LDSC_queue_setPoolCap,
+  .stats = &LDSC_queue_stats,
+  .resetStats = &LDSC_queue_resetStats,
+  .sampleLatency = &LDSC_queue_sampleLatency,
+  .trackResidency = &LDSC_queue_trackResidency,
+  .peekAge = &LDSC_queue_peekAge,
+  .delete = &LDSC_queue_delete
+};
+
 /**
  * @brief Create a new queue
  * @return Pointer to a new queue
  * @param status Error pointer.
  */
 LDSC_queue* LDSC_queue_init(LDSC_error* status) {
+  return LDSC_queue_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new queue using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a new queue.
+ */
+LDSC_queue* LDSC_queue_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
   if (status) *status = OK;
 
-  LDSC_queue* newQueue = malloc(sizeof(LDSC_queue));
-  if (!newQueue) {
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  Instance* instance = allocator->alloc(sizeof(Instance), allocator->context);
+  if (!instance) {
     if (status) *status = STRUCTURE_MALLOC;
     return NULL;
   }
 
+  LDSC_queue* newQueue = &instance->self;
+  *newQueue = LDSC_queue_methods;
+  newQueue->pd = &instance->pd;
+  Queue_setup(newQueue->pd, allocator);
+
+  return newQueue;
+}
+
+/**************************************************/
+/* LDSC_queueRef */
+
+/** methods shared by every LDSC_queueRef */
+static const LDSC_queueOps LDSC_queueRef_ops = {
+  .empty = &Queue_empty,
+  .length = &Queue_length,
+  .enqueue = &Queue_enqueue,
+  .dequeue = &Queue_dequeue,
+  .peek = &Queue_peek,
+  .enqueueMany = &Queue_enqueueMany,
+  .dequeueMany = &Queue_dequeueMany,
+  .reserve = &Queue_reserve,
+  .setPoolCap = &Queue_setPoolCap,
+  .stats = &Queue_stats,
+  .resetStats = &Queue_resetStats,
+  .sampleLatency = &Queue_sampleLatency,
+  .trackResidency = &Queue_trackResidency,
+  .peekAge = &Queue_peekAge
+};
+
+/**
+ * @brief Create a new compact queue handle.
+ * @param status Error pointer.
+ * @return Pointer to a new compact queue handle.
+ */
+LDSC_queueRef* LDSC_queueRef_init(LDSC_error* status) {
+  return LDSC_queueRef_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new compact queue handle using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a new compact queue handle.
+ */
+LDSC_queueRef* LDSC_queueRef_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
 
-  newQueue->pd = malloc(sizeof(privateData));
-  if (!newQueue->pd) {
-    if (status) *status = PRIVATEDATA_MALLOC;
-    free(newQueue);
+  RefInstance* instance = allocator->alloc(sizeof(RefInstance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
     return NULL;
   }
-  
-  newQueue->pd->length = 0;
-  newQueue->pd->front = NULL;
-  newQueue->pd->back = NULL;
 
-  newQueue->empty = &LDSC_queue_empty;
-  newQueue->length = &LDSC_queue_length;
-  newQueue->enqueue = &LDSC_queue_enqueue;
-  newQueue->dequeue = &LDSC_queue_dequeue;
-  newQueue->peek = &LDSC_queue_peek;
-  newQueue->delete = &LDSC_queue_delete;
+  LDSC_queueRef* newRef = &instance->ref;
+  newRef->ops = &LDSC_queueRef_ops;
+  newRef->pd = &instance->pd;
+  Queue_setup(newRef->pd, allocator);
 
-  return newQueue;
+  return newRef;
+}
+
+/**
+ * @brief Delete the queue behind a compact handle.
+ * @param self Compact queue handle.
+ * @param status Error pointer.
+ */
+void LDSC_queueRef_delete(LDSC_queueRef* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  Queue_release(self->pd, status);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(RefInstance), allocator.context);
+  return;
 }
 
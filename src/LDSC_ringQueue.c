@@ -0,0 +1,260 @@
+#include <LDSC_ringQueue.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** largest power of two buffer size a ring queue may use */
+#define RINGQUEUE_MAX_CAPACITY (1 << 30)
+
+/**
+  * @brief Opaque container for private data.
+  */
+struct privateData {
+  int length;
+  void** buffer;
+  int head;
+  int mask;
+  int capacity;
+  int fixed;
+  LDSC_allocator allocator;
+};
+
+/** round capacity up to the next power of two */
+static int RingQueue_roundUp(int capacity) {
+  int size = 1;
+  while (size < capacity)
+    size <<= 1;
+  return size;
+}
+
+/** double the buffer, moving the items to the start of the new buffer */
+static int RingQueue_grow(privateData* pd) {
+  int size = pd->mask + 1;
+  if (size >= RINGQUEUE_MAX_CAPACITY) return 0;
+
+  void** newBuffer = (void**)pd->allocator.alloc(2 * (size_t)size * sizeof(void*), pd->allocator.context);
+  if (!newBuffer) return 0;
+
+  int headCount = size - pd->head;
+  memcpy(newBuffer, pd->buffer + pd->head, (size_t)headCount * sizeof(void*));
+  memcpy(newBuffer + headCount, pd->buffer, (size_t)pd->head * sizeof(void*));
+
+  pd->allocator.free(pd->buffer, (size_t)size * sizeof(void*), pd->allocator.context);
+  pd->buffer = newBuffer;
+  pd->head = 0;
+  pd->mask = 2 * size - 1;
+  pd->capacity = 2 * size;
+  return 1;
+}
+
+/**************************************************/
+/* LDSC_ringQueue */
+
+/**
+  * @brief Check is queue is empty.
+  * @param self Ring queue pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_ringQueue_empty(LDSC_ringQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length == 0;
+}
+
+/**
+  * @brief Get length of the queue.
+  * @param self Ring queue pointer.
+  * @param status Error pointer.
+  * @return Length of the queue as integer type.
+  */
+int LDSC_ringQueue_length(LDSC_ringQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length;
+}
+
+/**
+  * @brief Add item to end of the queue.
+  * @param self Ring queue pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that enqueue performs a shallow copy of the data.
+  * A fixed capacity queue reports STRUCTURE_FULL instead of growing.
+  */
+void LDSC_ringQueue_enqueue(LDSC_ringQueue* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  if (pd->length == pd->capacity) {
+    if (pd->fixed) {
+      if (status) *status = STRUCTURE_FULL;
+      return;
+    }
+
+    if (!RingQueue_grow(pd)) {
+      if (status) *status = BUFFER_MALLOC;
+      return;
+    }
+  }
+
+  pd->buffer[(pd->head + pd->length) & pd->mask] = dataPtr;
+  pd->length++;
+  return;
+}
+
+/**
+  * @brief Remove item from front of the queue.
+  * @param self Ring queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_ringQueue_dequeue(LDSC_ringQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  if (pd->length == 0)
+    return NULL;
+
+  void* dataFront = pd->buffer[pd->head];
+  pd->head = (pd->head + 1) & pd->mask;
+  pd->length--;
+
+  return dataFront;
+}
+
+/**
+  * @brief Peek item at the front of the queue.
+  * @param self Ring queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_ringQueue_peek(LDSC_ringQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (self->pd->length == 0)
+    return NULL;
+
+  return self->pd->buffer[self->pd->head];
+}
+
+/**
+  * @brief Delete the queue.
+  * @param self Ring queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_ringQueue_delete(LDSC_ringQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd->buffer, (size_t)(self->pd->mask + 1) * sizeof(void*), allocator.context);
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_ringQueue), allocator.context);
+  return;
+}
+
+/**
+ * @brief Create a new growable ring queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_ringQueue.
+ */
+LDSC_ringQueue* LDSC_ringQueue_init(LDSC_error* status) {
+  return LDSC_ringQueue_init_with(NULL, 0, 0, status);
+}
+
+/**
+ * @brief Create a new ring queue with explicit capacity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Initial capacity, 0 for LDSC_RINGQUEUE_DEFAULT_CAPACITY.
+ * @param fixed Integer where 1 = fixed capacity and 0 = growable.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_ringQueue.
+ */
+LDSC_ringQueue* LDSC_ringQueue_init_with(const LDSC_allocator* allocator, int capacity, int fixed, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (capacity < 0 || capacity > RINGQUEUE_MAX_CAPACITY || (fixed && capacity == 0)) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_ringQueue* newQueue = allocator->alloc(sizeof(LDSC_ringQueue), allocator->context);
+  if (!newQueue) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newQueue->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newQueue->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newQueue, sizeof(LDSC_ringQueue), allocator->context);
+    return NULL;
+  }
+
+  int size = RingQueue_roundUp(capacity ? capacity : LDSC_RINGQUEUE_DEFAULT_CAPACITY);
+  newQueue->pd->buffer = allocator->alloc((size_t)size * sizeof(void*), allocator->context);
+  if (!newQueue->pd->buffer) {
+    if (status) *status = BUFFER_MALLOC;
+    allocator->free(newQueue->pd, sizeof(privateData), allocator->context);
+    allocator->free(newQueue, sizeof(LDSC_ringQueue), allocator->context);
+    return NULL;
+  }
+
+  newQueue->pd->length = 0;
+  newQueue->pd->head = 0;
+  newQueue->pd->mask = size - 1;
+  newQueue->pd->capacity = fixed ? capacity : size;
+  newQueue->pd->fixed = fixed != 0;
+  newQueue->pd->allocator = *allocator;
+
+  newQueue->empty = &LDSC_ringQueue_empty;
+  newQueue->length = &LDSC_ringQueue_length;
+  newQueue->enqueue = &LDSC_ringQueue_enqueue;
+  newQueue->dequeue = &LDSC_ringQueue_dequeue;
+  newQueue->peek = &LDSC_ringQueue_peek;
+  newQueue->delete = &LDSC_ringQueue_delete;
+
+  return newQueue;
+}
+
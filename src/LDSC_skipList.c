@@ -0,0 +1,614 @@
+#include "LDSC_errors.h"
+#include <LDSC_skipList.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+  * @brief Forward link of a node at one level.
+  * @details
+  * width is the number of positions the link advances. A link to NULL
+  * advances to the virtual position length + 1 so widths stay consistent.
+  */
+typedef struct Link {
+  struct Node* next;
+  int width;
+} Link;
+
+/** node structure, the head sentinel has LDSC_SKIPLIST_MAX_LEVEL links */
+typedef struct Node {
+  void* dataPtr;
+  int level;
+  Link links[];
+} Node;
+
+/* private data structure */
+struct privateData {
+  int length;
+  Node* head;
+  int level;
+  Node* tails[LDSC_SKIPLIST_MAX_LEVEL];
+  uint32_t seed;
+  LDSC_allocator allocator;
+};
+
+/** size of a node of level links in bytes */
+static size_t Node_bytes(int level) {
+  return sizeof(Node) + (size_t)level * sizeof(Link);
+}
+
+/** create and return a new node of the given level */
+static Node* Node_init(privateData* pd, void* dataPtr, int level) {
+  Node* newNode = (Node*)pd->allocator.alloc(Node_bytes(level), pd->allocator.context);
+  if (!newNode) return NULL;
+
+  newNode->dataPtr = dataPtr;
+  newNode->level = level;
+  return newNode;
+}
+
+/** release a node */
+static void Node_free(privateData* pd, Node* node) {
+  pd->allocator.free(node, Node_bytes(node->level), pd->allocator.context);
+}
+
+/** draw a random level, each extra level with probability 1/4 */
+static int SkipList_randomLevel(privateData* pd) {
+  uint32_t x = pd->seed;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  pd->seed = x;
+
+  int level = 1;
+  while (level < LDSC_SKIPLIST_MAX_LEVEL && (x & 3) == 0) {
+    level++;
+    x >>= 2;
+  }
+  return level;
+}
+
+/** empty head links above the current level, so they may be used */
+static void SkipList_raiseLevel(privateData* pd, int level) {
+  for (; pd->level < level; pd->level++) {
+    pd->head->links[pd->level].next = NULL;
+    pd->head->links[pd->level].width = pd->length + 1;
+    pd->tails[pd->level] = pd->head;
+  }
+}
+
+/** drop empty top levels */
+static void SkipList_lowerLevel(privateData* pd) {
+  while (pd->level > 1 && !pd->head->links[pd->level - 1].next)
+    pd->level--;
+}
+
+/**
+  * @brief Find the last node before position index + 1 at every level.
+  * @details
+  * Positions count from 1 with the head at 0, so update[lvl] is the node a
+  * new item at index would follow and pos[lvl] is that node's position.
+  */
+static void SkipList_findUpdate(privateData* pd, int index, Node** update, int* pos) {
+  Node* currNode = pd->head;
+  int currPos = 0;
+
+  for (int lvl = pd->level - 1; lvl >= 0; lvl--) {
+    while (currNode->links[lvl].next && currPos + currNode->links[lvl].width <= index) {
+      currPos += currNode->links[lvl].width;
+      currNode = currNode->links[lvl].next;
+    }
+    update[lvl] = currNode;
+    pos[lvl] = currPos;
+  }
+}
+
+/** node at index */
+static Node* SkipList_getNode(privateData* pd, int index) {
+  Node* currNode = pd->head;
+  int currPos = 0;
+
+  for (int lvl = pd->level - 1; lvl >= 0; lvl--) {
+    while (currNode->links[lvl].next && currPos + currNode->links[lvl].width <= index + 1) {
+      currPos += currNode->links[lvl].width;
+      currNode = currNode->links[lvl].next;
+    }
+    if (currPos == index + 1) break;
+  }
+
+  return currNode;
+}
+
+/** link newNode at index given the update path, levels at or above the path are raised first */
+static void SkipList_link(privateData* pd, Node* newNode, int index, Node** update, int* pos) {
+  for (int lvl = 0; lvl < pd->level; lvl++) {
+    Link* prevLink = &update[lvl]->links[lvl];
+    if (lvl < newNode->level) {
+      newNode->links[lvl].next = prevLink->next;
+      newNode->links[lvl].width = pos[lvl] + prevLink->width - index;
+      prevLink->next = newNode;
+      prevLink->width = index + 1 - pos[lvl];
+      if (!newNode->links[lvl].next)
+        pd->tails[lvl] = newNode;
+    } else {
+      prevLink->width++;
+    }
+  }
+
+  pd->length++;
+}
+
+/** unlink and return the node at index given the update path */
+static Node* SkipList_unlink(privateData* pd, Node** update) {
+  Node* targetNode = update[0]->links[0].next;
+
+  for (int lvl = 0; lvl < pd->level; lvl++) {
+    Link* prevLink = &update[lvl]->links[lvl];
+    if (prevLink->next == targetNode) {
+      prevLink->width += targetNode->links[lvl].width - 1;
+      prevLink->next = targetNode->links[lvl].next;
+      if (pd->tails[lvl] == targetNode)
+        pd->tails[lvl] = update[lvl];
+    } else {
+      prevLink->width--;
+    }
+  }
+
+  pd->length--;
+  SkipList_lowerLevel(pd);
+  return targetNode;
+}
+
+/** insert dataPtr at index, using the tails or head as update path at the ends */
+static int SkipList_insert(privateData* pd, void* dataPtr, int index) {
+  Node* update[LDSC_SKIPLIST_MAX_LEVEL];
+  int pos[LDSC_SKIPLIST_MAX_LEVEL];
+
+  Node* newNode = Node_init(pd, dataPtr, SkipList_randomLevel(pd));
+  if (!newNode) return 0;
+  SkipList_raiseLevel(pd, newNode->level);
+
+  if (index == pd->length) {
+    for (int lvl = 0; lvl < pd->level; lvl++) {
+      update[lvl] = pd->tails[lvl];
+      pos[lvl] = pd->length + 1 - pd->tails[lvl]->links[lvl].width;
+    }
+  } else if (index == 0) {
+    for (int lvl = 0; lvl < pd->level; lvl++) {
+      update[lvl] = pd->head;
+      pos[lvl] = 0;
+    }
+  } else {
+    SkipList_findUpdate(pd, index, update, pos);
+  }
+
+  SkipList_link(pd, newNode, index, update, pos);
+  return 1;
+}
+
+/** remove the node at index and return its data */
+static void* SkipList_remove(privateData* pd, int index) {
+  Node* update[LDSC_SKIPLIST_MAX_LEVEL];
+  int pos[LDSC_SKIPLIST_MAX_LEVEL];
+
+  if (index == 0) {
+    for (int lvl = 0; lvl < pd->level; lvl++)
+      update[lvl] = pd->head;
+  } else {
+    SkipList_findUpdate(pd, index, update, pos);
+  }
+
+  Node* targetNode = SkipList_unlink(pd, update);
+  void* returnData = targetNode->dataPtr;
+  Node_free(pd, targetNode);
+  return returnData;
+}
+
+/**************************************************/
+/* LDSC_skipList */
+
+/**
+  * @brief Get length of the skip list.
+  * @param self LDSC_skipList pointer.
+  * @param status Error pointer.
+  * @return Length of the skip list as integer type.
+  */
+int LDSC_skipList_length(LDSC_skipList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length;
+}
+
+/**
+  * @brief Check if skip list is empty.
+  * @param self LDSC_skipList pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_skipList_empty(LDSC_skipList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length == 0;
+}
+
+/**
+  * @brief Add item at the end of the skip list.
+  * @param self LDSC_skipList pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that append performs a shallow copy of the data.
+  */
+void LDSC_skipList_append(LDSC_skipList* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (!SkipList_insert(self->pd, dataPtr, self->pd->length))
+    if (status) *status = NODE_MALLOC;
+
+  return;
+}
+
+/**
+  * @brief Add item at the front of the skip list.
+  * @param self LDSC_skipList pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that prepend performs a shallow copy of the data.
+  */
+void LDSC_skipList_prepend(LDSC_skipList* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (!SkipList_insert(self->pd, dataPtr, 0))
+    if (status) *status = NODE_MALLOC;
+
+  return;
+}
+
+/**
+  * @brief Add item at index of the skip list.
+  * @param self LDSC_skipList pointer.
+  * @param dataPtr Pointer to data.
+  * @param index Index to add item at.
+  * @param status Error pointer.
+  * @details
+  * Keep note that add performs a shallow copy of the data.
+  */
+void LDSC_skipList_add(LDSC_skipList* self, void* dataPtr, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return;
+  }
+
+  if (index > self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return;
+  }
+
+  if (!SkipList_insert(self->pd, dataPtr, index))
+    if (status) *status = NODE_MALLOC;
+
+  return;
+}
+
+/**
+  * @brief Get item at index.
+  * @param self LDSC_skipList pointer.
+  * @param index Index of item to get.
+  * @param status Error pointer.
+  * @return Data pointer of item at index.
+  */
+void* LDSC_skipList_at(LDSC_skipList* self, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return NULL;
+  }
+
+  if (index >= self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  return SkipList_getNode(self->pd, index)->dataPtr;
+}
+
+/**
+  * @brief Replace item at index.
+  * @param self LDSC_skipList pointer.
+  * @param dataPtr Pointer to data.
+  * @param index Index of item to replace with dataPtr.
+  * @param status Error pointer.
+  * @return Data pointer of item that was replaced.
+  * @details
+  * Keep note that replace performs a shallow copy of the data.
+  */
+void* LDSC_skipList_replace(LDSC_skipList* self, void* dataPtr, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return NULL;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return NULL;
+  }
+
+  if (index >= self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  Node* targetNode = SkipList_getNode(self->pd, index);
+  void* replacedDataPtr = targetNode->dataPtr;
+  targetNode->dataPtr = dataPtr;
+  return replacedDataPtr;
+}
+
+/**
+  * @brief Remove item at the front of the list.
+  * @param self LDSC_skipList pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_skipList_pop(LDSC_skipList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (self->pd->length == 0)
+    return NULL;
+
+  return SkipList_remove(self->pd, 0);
+}
+
+/**
+  * @brief Remove item at the end of the list.
+  * @param self LDSC_skipList pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_skipList_pull(LDSC_skipList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (self->pd->length == 0)
+    return NULL;
+
+  return SkipList_remove(self->pd, self->pd->length - 1);
+}
+
+/**
+  * @brief Remove item at index.
+  * @param self LDSC_skipList pointer.
+  * @param index Index of item to remove.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_skipList_remove(LDSC_skipList* self, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return NULL;
+  }
+
+  if (index >= self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  return SkipList_remove(self->pd, index);
+}
+
+/**
+  * @brief Remove all items in the list.
+  * @param self LDSC_skipList pointer.
+  * @param status Error pointer.
+  */
+void LDSC_skipList_clear(LDSC_skipList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  Node* currNode = pd->head->links[0].next;
+  while (currNode) {
+    Node* nextNode = currNode->links[0].next;
+    Node_free(pd, currNode);
+    currNode = nextNode;
+  }
+
+  pd->length = 0;
+  pd->level = 0;
+  SkipList_raiseLevel(pd, 1);
+  return;
+}
+
+/**
+  * @brief Call a function on every item from head to tail.
+  * @param self LDSC_skipList pointer.
+  * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+  * @param ctx User context passed to callback.
+  * @param status Error pointer.
+  */
+void LDSC_skipList_forEach(LDSC_skipList* self, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!callback) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  for (Node* currNode = self->pd->head->links[0].next; currNode; currNode = currNode->links[0].next)
+    if (callback(currNode->dataPtr, ctx))
+      return;
+
+  return;
+}
+
+/**
+  * @brief Delete the skip list.
+  * @param self LDSC_skipList pointer.
+  * @param status Error pointer.
+  */
+void LDSC_skipList_delete(LDSC_skipList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_skipList_clear(self, status);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  Node_free(self->pd, self->pd->head);
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_skipList), allocator.context);
+  return;
+}
+
+/**************************************************/
+
+/**
+ * @brief Create a new skip list.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_skipList.
+ */
+LDSC_skipList* LDSC_skipList_init(LDSC_error* status) {
+  return LDSC_skipList_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new skip list using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_skipList.
+ */
+LDSC_skipList* LDSC_skipList_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_skipList* newList = allocator->alloc(sizeof(LDSC_skipList), allocator->context);
+  if (!newList) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newList->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newList->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newList, sizeof(LDSC_skipList), allocator->context);
+    return NULL;
+  }
+
+  newList->pd->allocator = *allocator;
+  newList->pd->head = Node_init(newList->pd, NULL, LDSC_SKIPLIST_MAX_LEVEL);
+  if (!newList->pd->head) {
+    if (status) *status = NODE_MALLOC;
+    allocator->free(newList->pd, sizeof(privateData), allocator->context);
+    allocator->free(newList, sizeof(LDSC_skipList), allocator->context);
+    return NULL;
+  }
+
+  newList->pd->length = 0;
+  newList->pd->level = 0;
+  newList->pd->seed = 0x9E3779B9u;
+  SkipList_raiseLevel(newList->pd, 1);
+
+  newList->length = &LDSC_skipList_length;
+  newList->empty = &LDSC_skipList_empty;
+  newList->append = &LDSC_skipList_append;
+  newList->prepend = &LDSC_skipList_prepend;
+  newList->add = &LDSC_skipList_add;
+  newList->at = &LDSC_skipList_at;
+  newList->replace = &LDSC_skipList_replace;
+  newList->pop = &LDSC_skipList_pop;
+  newList->pull = &LDSC_skipList_pull;
+  newList->remove = &LDSC_skipList_remove;
+  newList->clear = &LDSC_skipList_clear;
+  newList->forEach = &LDSC_skipList_forEach;
+  newList->delete = &LDSC_skipList_delete;
+
+  return newList;
+}
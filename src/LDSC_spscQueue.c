@@ -0,0 +1,362 @@
+#include <LDSC_spscQueue.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+/** assumed cache line size used to keep the indices apart */
+#define SPSC_CACHE_LINE 64
+
+/** largest capacity a SPSC queue may hold */
+#define SPSC_MAX_CAPACITY (1 << 30)
+
+/**
+  * @brief Opaque container for private data.
+  * @details
+  * head is owned by the consumer and tail by the producer. Each side keeps a
+  * cached copy of the other index so the shared line is only read when the
+  * cached value says the queue looks full or empty. The padding keeps the two
+  * sides on separate cache lines regardless of allocator alignment.
+  */
+struct privateData {
+  void** buffer;
+  size_t mask;
+  size_t capacity;
+  LDSC_allocator allocator;
+
+  char padHead[SPSC_CACHE_LINE];
+  atomic_size_t head;
+  size_t cachedTail;
+
+  char padTail[SPSC_CACHE_LINE];
+  atomic_size_t tail;
+  size_t cachedHead;
+
+  char padEnd[SPSC_CACHE_LINE];
+};
+
+/** round capacity up to the next power of two */
+static size_t SpscQueue_roundUp(int capacity) {
+  size_t size = 1;
+  while (size < (size_t)capacity)
+    size <<= 1;
+  return size;
+}
+
+/** number of free slots as seen by the producer, reloading head if fewer than wanted look free */
+static size_t SpscQueue_producerSpace(privateData* pd, size_t tail, size_t wanted) {
+  size_t space = pd->capacity - (tail - pd->cachedHead);
+  if (space < wanted) {
+    pd->cachedHead = atomic_load_explicit(&pd->head, memory_order_acquire);
+    space = pd->capacity - (tail - pd->cachedHead);
+  }
+  return space;
+}
+
+/** number of ready items as seen by the consumer, reloading tail if fewer than wanted look ready */
+static size_t SpscQueue_consumerReady(privateData* pd, size_t head, size_t wanted) {
+  size_t ready = pd->cachedTail - head;
+  if (ready < wanted) {
+    pd->cachedTail = atomic_load_explicit(&pd->tail, memory_order_acquire);
+    ready = pd->cachedTail - head;
+  }
+  return ready;
+}
+
+/**************************************************/
+/* LDSC_spscQueue */
+
+/**
+  * @brief Check is queue is empty.
+  * @param self SPSC queue pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_spscQueue_empty(LDSC_spscQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  size_t head = atomic_load_explicit(&self->pd->head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&self->pd->tail, memory_order_acquire);
+  return head == tail;
+}
+
+/**
+  * @brief Get length of the queue.
+  * @param self SPSC queue pointer.
+  * @param status Error pointer.
+  * @return Length of the queue as integer type.
+  */
+int LDSC_spscQueue_length(LDSC_spscQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  size_t head = atomic_load_explicit(&self->pd->head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&self->pd->tail, memory_order_acquire);
+  return (int)(tail - head);
+}
+
+/**
+  * @brief Add item to end of the queue. Producer only.
+  * @param self SPSC queue pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that enqueue performs a shallow copy of the data.
+  */
+void LDSC_spscQueue_enqueue(LDSC_spscQueue* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  size_t tail = atomic_load_explicit(&pd->tail, memory_order_relaxed);
+  if (SpscQueue_producerSpace(pd, tail, 1) == 0) {
+    if (status) *status = STRUCTURE_FULL;
+    return;
+  }
+
+  pd->buffer[tail & pd->mask] = dataPtr;
+  atomic_store_explicit(&pd->tail, tail + 1, memory_order_release);
+  return;
+}
+
+/**
+  * @brief Add several items to end of the queue. Producer only.
+  * @param self SPSC queue pointer.
+  * @param items Array of data pointers.
+  * @param count Number of items in the array.
+  * @param status Error pointer.
+  * @return Number of items enqueued.
+  */
+int LDSC_spscQueue_enqueueMany(LDSC_spscQueue* self, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!items[i]) {
+      if (status) *status = NULL_DATAPTR;
+      return 0;
+    }
+  }
+
+  privateData* pd = self->pd;
+  size_t tail = atomic_load_explicit(&pd->tail, memory_order_relaxed);
+  size_t space = SpscQueue_producerSpace(pd, tail, (size_t)count);
+  size_t total = (size_t)count < space ? (size_t)count : space;
+
+  for (size_t i = 0; i < total; i++)
+    pd->buffer[(tail + i) & pd->mask] = items[i];
+  atomic_store_explicit(&pd->tail, tail + total, memory_order_release);
+
+  if (total < (size_t)count)
+    if (status) *status = STRUCTURE_FULL;
+
+  return (int)total;
+}
+
+/**
+  * @brief Remove item from front of the queue. Consumer only.
+  * @param self SPSC queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_spscQueue_dequeue(LDSC_spscQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  size_t head = atomic_load_explicit(&pd->head, memory_order_relaxed);
+  if (SpscQueue_consumerReady(pd, head, 1) == 0)
+    return NULL;
+
+  void* dataFront = pd->buffer[head & pd->mask];
+  atomic_store_explicit(&pd->head, head + 1, memory_order_release);
+  return dataFront;
+}
+
+/**
+  * @brief Remove several items from front of the queue. Consumer only.
+  * @param self SPSC queue pointer.
+  * @param items Array receiving the data pointers.
+  * @param count Maximum number of items to remove.
+  * @param status Error pointer.
+  * @return Number of items dequeued.
+  */
+int LDSC_spscQueue_dequeueMany(LDSC_spscQueue* self, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  privateData* pd = self->pd;
+  size_t head = atomic_load_explicit(&pd->head, memory_order_relaxed);
+  size_t ready = SpscQueue_consumerReady(pd, head, (size_t)count);
+  size_t total = (size_t)count < ready ? (size_t)count : ready;
+
+  for (size_t i = 0; i < total; i++)
+    items[i] = pd->buffer[(head + i) & pd->mask];
+  atomic_store_explicit(&pd->head, head + total, memory_order_release);
+
+  return (int)total;
+}
+
+/**
+  * @brief Peek item at the front of the queue. Consumer only.
+  * @param self SPSC queue pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the front of the queue.
+  */
+void* LDSC_spscQueue_peek(LDSC_spscQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  size_t head = atomic_load_explicit(&pd->head, memory_order_relaxed);
+  if (SpscQueue_consumerReady(pd, head, 1) == 0)
+    return NULL;
+
+  return pd->buffer[head & pd->mask];
+}
+
+/**
+  * @brief Delete the queue.
+  * @param self SPSC queue pointer.
+  * @param status Error pointer.
+  */
+void LDSC_spscQueue_delete(LDSC_spscQueue* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd->buffer, (self->pd->mask + 1) * sizeof(void*), allocator.context);
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_spscQueue), allocator.context);
+  return;
+}
+
+/**
+ * @brief Create a new SPSC queue.
+ * @param capacity Maximum number of items in the queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_spscQueue.
+ */
+LDSC_spscQueue* LDSC_spscQueue_init(int capacity, LDSC_error* status) {
+  return LDSC_spscQueue_init_with(NULL, capacity, status);
+}
+
+/**
+ * @brief Create a new SPSC queue using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Maximum number of items in the queue.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_spscQueue.
+ */
+LDSC_spscQueue* LDSC_spscQueue_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (capacity <= 0 || capacity > SPSC_MAX_CAPACITY) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_spscQueue* newQueue = allocator->alloc(sizeof(LDSC_spscQueue), allocator->context);
+  if (!newQueue) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newQueue->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newQueue->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newQueue, sizeof(LDSC_spscQueue), allocator->context);
+    return NULL;
+  }
+
+  size_t size = SpscQueue_roundUp(capacity);
+  newQueue->pd->buffer = allocator->alloc(size * sizeof(void*), allocator->context);
+  if (!newQueue->pd->buffer) {
+    if (status) *status = BUFFER_MALLOC;
+    allocator->free(newQueue->pd, sizeof(privateData), allocator->context);
+    allocator->free(newQueue, sizeof(LDSC_spscQueue), allocator->context);
+    return NULL;
+  }
+
+  newQueue->pd->mask = size - 1;
+  newQueue->pd->capacity = (size_t)capacity;
+  newQueue->pd->allocator = *allocator;
+  atomic_init(&newQueue->pd->head, 0);
+  atomic_init(&newQueue->pd->tail, 0);
+  newQueue->pd->cachedTail = 0;
+  newQueue->pd->cachedHead = 0;
+
+  newQueue->empty = &LDSC_spscQueue_empty;
+  newQueue->length = &LDSC_spscQueue_length;
+  newQueue->enqueue = &LDSC_spscQueue_enqueue;
+  newQueue->enqueueMany = &LDSC_spscQueue_enqueueMany;
+  newQueue->dequeue = &LDSC_spscQueue_dequeue;
+  newQueue->dequeueMany = &LDSC_spscQueue_dequeueMany;
+  newQueue->peek = &LDSC_spscQueue_peek;
+  newQueue->delete = &LDSC_spscQueue_delete;
+
+  return newQueue;
+}
+
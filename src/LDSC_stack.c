@@ -1,5 +1,8 @@
 #include "LDSC_errors.h"
 #include <LDSC_stack.h>
+#include <LDSC_stackFast.h>
+#include <LDSC_stackRef.h>
+#include <stddef.h>
 #include <stdlib.h>
 
 /** node structure */
@@ -8,56 +11,144 @@ typedef struct Node {
   struct Node* next;
 } Node;
 
-/** create and return a new stack node */
-static Node* Node_init(void* dataPtr) {
-  Node* newNode = (Node*)malloc(sizeof(Node));
-  if (!newNode) return NULL;
-
-  newNode->dataPtr = dataPtr;
-  newNode->next = NULL;
-  return newNode;
-}
-
 /**
   * @brief Opaque container for private data.
   */
-struct privateData{
+struct privateData {
   int size;
   Node* top;
+  LDSC_allocator allocator;
+  Node* pool;
+  int poolSize;
+  int poolCap;
+#ifdef LDSC_TIMING
+  LDSC_latency insertLatency;
+  LDSC_latency removeLatency;
+#endif
+#ifdef LDSC_STATS
+  LDSC_stats stats;
+#endif
 };
 
+/** structure and private data allocated as one block */
+typedef struct Instance {
+  LDSC_stack self;
+  privateData pd;
+} Instance;
+
+/** compact handle and private data allocated as one block */
+typedef struct RefInstance {
+  LDSC_stackRef ref;
+  privateData pd;
+} RefInstance;
+
+/** layout tag of the settings this file is built with, see LDSC_LAYOUT_TAG */
+const int LDSC_LAYOUT_TAG(LDSC_stack) = 1;
+
+/* the inline fast path in LDSC_stackFast.h relies on these layouts */
+_Static_assert(sizeof(Node) == sizeof(LDSC_stackFastNode), "LDSC_stackFastNode mirrors Node");
+_Static_assert(offsetof(Node, next) == offsetof(LDSC_stackFastNode, next), "LDSC_stackFastNode mirrors Node");
+_Static_assert(sizeof(privateData) == sizeof(LDSC_stackFastData), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, size) == offsetof(LDSC_stackFastData, size), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, top) == offsetof(LDSC_stackFastData, top), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, allocator) == offsetof(LDSC_stackFastData, allocator), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, pool) == offsetof(LDSC_stackFastData, pool), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, poolSize) == offsetof(LDSC_stackFastData, poolSize), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, poolCap) == offsetof(LDSC_stackFastData, poolCap), "LDSC_stackFastData mirrors privateData");
+#ifdef LDSC_TIMING
+_Static_assert(offsetof(privateData, insertLatency) == offsetof(LDSC_stackFastData, insertLatency), "LDSC_stackFastData mirrors privateData");
+_Static_assert(offsetof(privateData, removeLatency) == offsetof(LDSC_stackFastData, removeLatency), "LDSC_stackFastData mirrors privateData");
+#endif
+#ifdef LDSC_STATS
+_Static_assert(offsetof(privateData, stats) == offsetof(LDSC_stackFastData, stats), "LDSC_stackFastData mirrors privateData");
+#endif
+
+/** create and return a new stack node, reusing a pooled node if available */
+static Node* Node_init(privateData* pd, void* dataPtr) {
+  Node* newNode = pd->pool;
+  if (newNode) {
+    pd->pool = newNode->next;
+    pd->poolSize--;
+  } else {
+    newNode = (Node*)pd->allocator.alloc(sizeof(Node), pd->allocator.context);
+    if (!newNode) return NULL;
+    LDSC_STATS_ADD(pd, nodeAllocs, 1);
+  }
+
+  newNode->dataPtr = dataPtr;
+  newNode->next = NULL;
+  return newNode;
+}
+
+/** release a stack node, keeping it in the pool if there is room */
+static void Node_free(privateData* pd, Node* node) {
+  if (pd->poolSize < pd->poolCap) {
+    node->next = pd->pool;
+    pd->pool = node;
+    pd->poolSize++;
+    return;
+  }
+  pd->allocator.free(node, sizeof(Node), pd->allocator.context);
+  LDSC_STATS_ADD(pd, nodeFrees, 1);
+}
+
+/** release pooled nodes until the pool holds at most count nodes */
+static void Node_trimPool(privateData* pd, int count) {
+  while (pd->poolSize > count) {
+    Node* node = pd->pool;
+    pd->pool = node->next;
+    pd->poolSize--;
+    pd->allocator.free(node, sizeof(Node), pd->allocator.context);
+    LDSC_STATS_ADD(pd, nodeFrees, 1);
+  }
+}
+
+#ifdef LDSC_TIMING
+/** set a latency sampler to time every rate-th call into hist, off if hist is NULL or rate is 0 */
+static void Latency_set(LDSC_latency* latency, LDSC_histogram* hist, int rate) {
+  latency->hist = hist;
+  latency->rate = hist ? rate : 0;
+  latency->countdown = latency->rate;
+}
+#endif
+
+/** set up empty private data using allocator */
+static void Stack_setup(privateData* pd, const LDSC_allocator* allocator) {
+  pd->size = 0;
+  pd->top = NULL;
+  pd->allocator = *allocator;
+  pd->pool = NULL;
+  pd->poolSize = 0;
+  pd->poolCap = LDSC_NODE_POOL_DEFAULT_CAP;
+#ifdef LDSC_TIMING
+  Latency_set(&pd->insertLatency, NULL, 0);
+  Latency_set(&pd->removeLatency, NULL, 0);
+#endif
+#ifdef LDSC_STATS
+  pd->stats = (LDSC_stats){ 0 };
+#endif
+}
+
 /**************************************************/
-/* LDSC_stack */
+/* operations on the private data of a stack, a NULL pd reports NULL_SELF */
 
-/**
-  * @brief Get size of the stack.
-  * @param self Stack pointer.
-  * @param status Error pointer.
-  * @return Size of the stack as integer type.
-  */
-int LDSC_stack_size(LDSC_stack* self, LDSC_error* status) {
+/** get size of the stack */
+static int Stack_size(privateData* pd, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return ERROR;
   }
   
-  return self->pd->size;
+  return pd->size;
 }
 
-/**
-  * @brief Push an item to the stack.
-  * @param self Stack pointer.
-  * @param dataPtr Pointer to data.
-  * @param status Error pointer.
-  * @details
-  * Keep note that push performs a shallow copy of the data.
-  */
-void LDSC_stack_push(LDSC_stack* self, void* dataPtr, LDSC_error* status) {
+/** push an item to the stack */
+static void Stack_push(privateData* pd, void* dataPtr, LDSC_error* status) {
   if (status) *status = OK;
 
-  if (!self) {
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
@@ -67,18 +158,317 @@ void LDSC_stack_push(LDSC_stack* self, void* dataPtr, LDSC_error* status) {
     return;
   }
 
-  Node* newNode = Node_init(dataPtr);
+  long long start = LDSC_LATENCY_START(pd, insertLatency);
+  Node* newNode = Node_init(pd, dataPtr);
   if (!newNode) {
+    if (status) *status = NODE_MALLOC;
+    return;
+  }
+
+  newNode->next = pd->top;
+  pd->top = newNode;
+  pd->size++;
+  LDSC_STATS_ADD(pd, inserts, 1);
+  LDSC_STATS_LENGTH(pd, pd->size);
+  LDSC_LATENCY_STOP(pd, insertLatency, start);
+  return;
+}
+
+/** check if stack is empty */
+static int Stack_empty(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return pd->size == 0;
+}
+
+/** peek item at the top of the stack */
+static void* Stack_peek(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!pd->top) 
+    return NULL;
+
+  LDSC_STATS_ADD(pd, lookups, 1);
+  return pd->top->dataPtr;
+}
+
+/** pop an item from the stack */
+static void* Stack_pop(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!pd->top)
+    return NULL;
+
+  long long start = LDSC_LATENCY_START(pd, removeLatency);
+  Node* oldTop = pd->top;
+  void* dataTop = oldTop->dataPtr;
+  pd->top = oldTop->next;
+  pd->size--;
+  LDSC_STATS_ADD(pd, removals, 1);
+
+  Node_free(pd, oldTop);
+  LDSC_LATENCY_STOP(pd, removeLatency, start);
+  return dataTop;
+}
+
+/** push items to the stack */
+static void Stack_pushMany(privateData* pd, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (!items[i]) {
+      if (status) *status = NULL_DATAPTR;
+      return;
+    }
+  }
+
+  if (!count)
+    return;
+
+  Node* first = NULL;
+  Node* last = NULL;
+  for (int i = 0; i < count; i++) {
+    Node* newNode = Node_init(pd, items[i]);
+    if (!newNode) {
+      while (first) {
+        Node* nextNode = first->next;
+        Node_free(pd, first);
+        first = nextNode;
+      }
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+
+    newNode->next = first;
+    first = newNode;
+    if (!last) last = newNode;
+  }
+
+  last->next = pd->top;
+  pd->top = first;
+  pd->size += count;
+  LDSC_STATS_ADD(pd, inserts, count);
+  LDSC_STATS_LENGTH(pd, pd->size);
+  return;
+}
+
+/** pop up to count items from the stack */
+static int Stack_popMany(privateData* pd, void** items, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return 0;
+  }
+
+  if (!items) {
+    if (status) *status = NULL_DATAPTR;
+    return 0;
+  }
+
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return 0;
+  }
+
+  int total = 0;
+  while (total < count && pd->top) {
+    Node* oldTop = pd->top;
+    items[total++] = oldTop->dataPtr;
+    pd->top = oldTop->next;
+    Node_free(pd, oldTop);
+  }
+
+  pd->size -= total;
+  LDSC_STATS_ADD(pd, removals, total);
+  return total;
+}
+
+/** pre-allocate nodes into the node pool */
+static void Stack_reserve(privateData* pd, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
     if (status) *status = NULL_SELF;
     return;
   }
 
-  newNode->next = self->pd->top;
-  self->pd->top = newNode;
-  self->pd->size++;
+  if (count < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  if (count > pd->poolCap)
+    pd->poolCap = count;
+
+  while (pd->poolSize < count) {
+    Node* newNode = (Node*)pd->allocator.alloc(sizeof(Node), pd->allocator.context);
+    if (!newNode) {
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+    LDSC_STATS_ADD(pd, nodeAllocs, 1);
+
+    newNode->next = pd->pool;
+    pd->pool = newNode;
+    pd->poolSize++;
+  }
+
+  return;
+}
+
+/** set the maximum number of recycled nodes kept in the node pool */
+static void Stack_setPoolCap(privateData* pd, int cap, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (cap < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  pd->poolCap = cap;
+  Node_trimPool(pd, cap);
   return;
 }
 
+/** copy the operation counters of the stack */
+static void Stack_stats(privateData* pd, LDSC_stats* out, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!out) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  *out = pd->stats;
+#else
+  *out = (LDSC_stats){ 0 };
+#endif
+  return;
+}
+
+/** zero the operation counters of the stack */
+static void Stack_resetStats(privateData* pd, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+#ifdef LDSC_STATS
+  pd->stats = (LDSC_stats){ .highWater = pd->size };
+#endif
+  return;
+}
+
+/** time every rate-th push and pop into latency histograms */
+static void Stack_sampleLatency(privateData* pd, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!pd) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (rate < 0) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+#ifdef LDSC_TIMING
+  Latency_set(&pd->insertLatency, insertHist, rate);
+  Latency_set(&pd->removeLatency, removeHist, rate);
+#else
+  if (rate && (insertHist || removeHist)) {
+    if (status) *status = ERROR;
+    return;
+  }
+#endif
+  return;
+}
+
+/** release every node of the stack, leaving only the block of the structure */
+static void Stack_release(privateData* pd, LDSC_error* status) {
+#ifdef LDSC_TIMING
+  pd->removeLatency.rate = 0;
+#endif
+  while (pd->top) {
+    Stack_pop(pd, status);
+  }
+
+  if (pd->size != 0)
+    if (status) *status = DELETE_FAIL;
+
+  Node_trimPool(pd, 0);
+}
+
+/**************************************************/
+/* LDSC_stack */
+
+/**
+  * @brief Get size of the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  * @return Size of the stack as integer type.
+  */
+int LDSC_stack_size(LDSC_stack* self, LDSC_error* status) {
+  return Stack_size(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Push an item to the stack.
+  * @param self Stack pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that push performs a shallow copy of the data.
+  */
+void LDSC_stack_push(LDSC_stack* self, void* dataPtr, LDSC_error* status) {
+  Stack_push(self ? self->pd : NULL, dataPtr, status);
+}
+
 /**
   * @brief Check if stack is empty.
   * @param self Stack pointer.
@@ -86,14 +476,7 @@ void LDSC_stack_push(LDSC_stack* self, void* dataPtr, LDSC_error* status) {
   * @return Integer where 1 = empty and 0 = not empty
   */
 int LDSC_stack_empty(LDSC_stack* self, LDSC_error* status) {
-  if (status) *status = OK;
-
-  if (!self) {
-    if (status) *status = NULL_SELF;
-    return ERROR;
-  }
-
-  return self->pd->size == 0;
+  return Stack_empty(self ? self->pd : NULL, status);
 }
 
 /**
@@ -103,17 +486,7 @@ int LDSC_stack_empty(LDSC_stack* self, LDSC_error* status) {
   * @return Pointer to data at the top of the stack.
   */
 void* LDSC_stack_peek(LDSC_stack* self, LDSC_error* status) {
-  if (status) *status = OK;
-
-  if (!self) {
-    if (status) *status = NULL_SELF;
-    return NULL;
-  }
-
-  if (!self->pd->top) 
-    return NULL;
-
-  return self->pd->top->dataPtr;
+  return Stack_peek(self ? self->pd : NULL, status);
 }
 
 /**
@@ -123,23 +496,88 @@ void* LDSC_stack_peek(LDSC_stack* self, LDSC_error* status) {
   * @return Pointer to data at the top of the stack.
   */
 void* LDSC_stack_pop(LDSC_stack* self, LDSC_error* status) {
-  if (status) *status = OK;
+  return Stack_pop(self ? self->pd : NULL, status);
+}
 
-  if (!self) {
-    if (status) *status = NULL_SELF;
-    return NULL;
-  }
+/**
+  * @brief Push items to the stack.
+  * @param self Stack pointer.
+  * @param items Array of data pointers, pushed in order.
+  * @param count Number of items.
+  * @param status Error pointer.
+  * @details
+  * Keep note that pushMany performs a shallow copy of the data.
+  */
+void LDSC_stack_pushMany(LDSC_stack* self, void** items, int count, LDSC_error* status) {
+  Stack_pushMany(self ? self->pd : NULL, items, count, status);
+}
 
-  if (!self->pd->top)
-    return NULL;
+/**
+  * @brief Pop up to count items from the stack.
+  * @param self Stack pointer.
+  * @param items Array receiving the data pointers, items[0] was the top.
+  * @param count Maximum number of items to pop.
+  * @param status Error pointer.
+  * @return Number of items popped.
+  */
+int LDSC_stack_popMany(LDSC_stack* self, void** items, int count, LDSC_error* status) {
+  return Stack_popMany(self ? self->pd : NULL, items, count, status);
+}
 
-  Node* oldTop = self->pd->top;
-  void* dataTop = oldTop->dataPtr;
-  self->pd->top = oldTop->next;
-  self->pd->size--;
+/**
+  * @brief Pre-allocate nodes into the node pool.
+  * @param self Stack pointer.
+  * @param count Number of nodes the pool should hold.
+  * @param status Error pointer.
+  * @details
+  * The pool capacity is raised to count if it is smaller.
+  */
+void LDSC_stack_reserve(LDSC_stack* self, int count, LDSC_error* status) {
+  Stack_reserve(self ? self->pd : NULL, count, status);
+}
 
-  free(oldTop);
-  return dataTop;
+/**
+  * @brief Set the maximum number of recycled nodes kept in the node pool.
+  * @param self Stack pointer.
+  * @param cap Maximum number of pooled nodes, 0 disables pooling.
+  * @param status Error pointer.
+  */
+void LDSC_stack_setPoolCap(LDSC_stack* self, int cap, LDSC_error* status) {
+  Stack_setPoolCap(self ? self->pd : NULL, cap, status);
+}
+
+/**
+  * @brief Copy the operation counters of the stack.
+  * @param self Stack pointer.
+  * @param out Stats pointer receiving the counters.
+  * @param status Error pointer.
+  */
+void LDSC_stack_stats(LDSC_stack* self, LDSC_stats* out, LDSC_error* status) {
+  Stack_stats(self ? self->pd : NULL, out, status);
+}
+
+/**
+  * @brief Zero the operation counters of the stack.
+  * @param self Stack pointer.
+  * @param status Error pointer.
+  */
+void LDSC_stack_resetStats(LDSC_stack* self, LDSC_error* status) {
+  Stack_resetStats(self ? self->pd : NULL, status);
+}
+
+/**
+  * @brief Time every rate-th push and pop into latency histograms.
+  * @param self Stack pointer.
+  * @param insertHist Histogram receiving push latencies, NULL to not time push.
+  * @param removeHist Histogram receiving pop latencies, NULL to not time pop.
+  * @param rate Sampling rate, 0 switches sampling off.
+  * @param status Error pointer.
+  * @details
+  * Without LDSC_TIMING the sampler is not compiled in and anything but
+  * switching it off reports ERROR.
+  */
+void LDSC_stack_sampleLatency(LDSC_stack* self, LDSC_histogram* insertHist, LDSC_histogram* removeHist, int rate, LDSC_error* status) {
+  Stack_sampleLatency(self ? self->pd : NULL, insertHist, removeHist, rate, status);
 }
 
 /**
@@ -155,18 +593,30 @@ void LDSC_stack_delete(LDSC_stack* self, LDSC_error* status) {
     return;
   }
 
-  while (self->pd->top) {
-    self->pop(self, status);
-  }
-
-  if (self->pd->size != 0)
-    if (status) *status = DELETE_FAIL;
+  Stack_release(self->pd, status);
 
-  free(self->pd);
-  free(self);
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(Instance), allocator.context);
   return;
 }
 
+/** method table copied into every new stack */
+static const LDSC_stack LDSC_stack_methods = {
+  .size = &LDSC_stack_size,
+  .push = &LDSC_stack_push,
+  .empty = &LDSC_stack_empty,
+  .peek = &LDSC_stack_peek,
+  .pop = &LDSC_stack_pop,
+  .pushMany = &LDSC_stack_pushMany,
+  .popMany = &LDSC_stack_popMany,
+  .reserve = &LDSC_stack_reserve,
+  .setPoolCap = &LDSC_stack_setPoolCap,
+  .stats = &LDSC_stack_stats,
+  .resetStats = &LDSC_stack_resetStats,
+  .sampleLatency = &LDSC_stack_sampleLatency,
+  .delete = &LDSC_stack_delete
+};
+
 /**
  * @brief Create a new stack.
  * @par Parameters
@@ -174,30 +624,111 @@ void LDSC_stack_delete(LDSC_stack* self, LDSC_error* status) {
  * @return Pointer to an LDSC_stack.
  */
 LDSC_stack* LDSC_stack_init(LDSC_error* status) {
+  return LDSC_stack_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new stack using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_stack.
+ */
+LDSC_stack* LDSC_stack_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
   if (status) *status = OK;
 
-  LDSC_stack* newStack = malloc(sizeof(LDSC_stack));
-  if (!newStack) {
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  Instance* instance = allocator->alloc(sizeof(Instance), allocator->context);
+  if (!instance) {
     if (status) *status = STRUCTURE_MALLOC;
     return NULL;
   }
 
-  newStack->pd = malloc(sizeof(privateData));
-  if (!newStack->pd) {
-    if (status) *status = PRIVATEDATA_MALLOC;
-    free(newStack);
+  LDSC_stack* newStack = &instance->self;
+  *newStack = LDSC_stack_methods;
+  newStack->pd = &instance->pd;
+  Stack_setup(newStack->pd, allocator);
+
+  return newStack;
+}
+
+/**************************************************/
+/* LDSC_stackRef */
+
+/** methods shared by every LDSC_stackRef */
+static const LDSC_stackOps LDSC_stackRef_ops = {
+  .size = &Stack_size,
+  .push = &Stack_push,
+  .empty = &Stack_empty,
+  .peek = &Stack_peek,
+  .pop = &Stack_pop,
+  .pushMany = &Stack_pushMany,
+  .popMany = &Stack_popMany,
+  .reserve = &Stack_reserve,
+  .setPoolCap = &Stack_setPoolCap,
+  .stats = &Stack_stats,
+  .resetStats = &Stack_resetStats,
+  .sampleLatency = &Stack_sampleLatency
+};
+
+/**
+ * @brief Create a new compact stack handle.
+ * @param status Error pointer.
+ * @return Pointer to a new compact stack handle.
+ */
+LDSC_stackRef* LDSC_stackRef_init(LDSC_error* status) {
+  return LDSC_stackRef_init_with(NULL, status);
+}
+
+/**
+ * @brief Create a new compact stack handle using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param status Error pointer.
+ * @return Pointer to a new compact stack handle.
+ */
+LDSC_stackRef* LDSC_stackRef_init_with(const LDSC_allocator* allocator, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  RefInstance* instance = allocator->alloc(sizeof(RefInstance), allocator->context);
+  if (!instance) {
+    if (status) *status = STRUCTURE_MALLOC;
     return NULL;
   }
 
-  newStack->pd->size = 0;
-  newStack->pd->top = NULL;
+  LDSC_stackRef* newRef = &instance->ref;
+  newRef->ops = &LDSC_stackRef_ops;
+  newRef->pd = &instance->pd;
+  Stack_setup(newRef->pd, allocator);
 
-  newStack->size = &LDSC_stack_size;
-  newStack->push = &LDSC_stack_push;
-  newStack->empty = &LDSC_stack_empty;
-  newStack->peek = &LDSC_stack_peek;
-  newStack->pop = &LDSC_stack_pop;
-  newStack->delete = &LDSC_stack_delete;
+  return newRef;
+}
 
-  return newStack;
+/**
+ * @brief Delete the stack behind a compact handle.
+ * @param self Compact stack handle.
+ * @param status Error pointer.
+ */
+void LDSC_stackRef_delete(LDSC_stackRef* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  Stack_release(self->pd, status);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self, sizeof(RefInstance), allocator.context);
+  return;
 }
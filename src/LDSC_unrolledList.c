@@ -0,0 +1,569 @@
+#include "LDSC_errors.h"
+#include <LDSC_unrolledList.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** block of up to blockItems data pointers */
+typedef struct Block {
+  struct Block* next;
+  struct Block* prev;
+  int count;
+  void* items[];
+} Block;
+
+/* private data structure */
+struct privateData {
+  int length;
+  Block* head;
+  Block* tail;
+  int blockItems;
+  LDSC_allocator allocator;
+};
+
+/** size of a block in bytes */
+static size_t Block_bytes(privateData* pd) {
+  return sizeof(Block) + (size_t)pd->blockItems * sizeof(void*);
+}
+
+/** allocate an empty unlinked block */
+static Block* Block_init(privateData* pd) {
+  Block* newBlock = (Block*)pd->allocator.alloc(Block_bytes(pd), pd->allocator.context);
+  if (!newBlock) return NULL;
+
+  newBlock->next = NULL;
+  newBlock->prev = NULL;
+  newBlock->count = 0;
+  return newBlock;
+}
+
+/** link block after prevBlock, or at the head if prevBlock is NULL */
+static void Block_linkAfter(privateData* pd, Block* block, Block* prevBlock) {
+  Block* nextBlock = prevBlock ? prevBlock->next : pd->head;
+
+  block->prev = prevBlock;
+  block->next = nextBlock;
+
+  if (prevBlock) prevBlock->next = block;
+  else pd->head = block;
+
+  if (nextBlock) nextBlock->prev = block;
+  else pd->tail = block;
+}
+
+/** unlink and free a block */
+static void Block_free(privateData* pd, Block* block) {
+  if (block->prev) block->prev->next = block->next;
+  else pd->head = block->next;
+
+  if (block->next) block->next->prev = block->prev;
+  else pd->tail = block->prev;
+
+  pd->allocator.free(block, Block_bytes(pd), pd->allocator.context);
+}
+
+/** find the block holding index, starting from the nearer end */
+static Block* Block_find(privateData* pd, int index, int* offset) {
+  Block* currBlock;
+
+  if (index < pd->length / 2) {
+    currBlock = pd->head;
+    while (index >= currBlock->count) {
+      index -= currBlock->count;
+      currBlock = currBlock->next;
+    }
+    *offset = index;
+  } else {
+    int remaining = pd->length - index;
+    currBlock = pd->tail;
+    while (remaining > currBlock->count) {
+      remaining -= currBlock->count;
+      currBlock = currBlock->prev;
+    }
+    *offset = currBlock->count - remaining;
+  }
+
+  return currBlock;
+}
+
+/** insert dataPtr at offset of block, splitting the block first if it is full */
+static int Block_insert(privateData* pd, Block* block, int offset, void* dataPtr) {
+  if (block->count == pd->blockItems) {
+    Block* newBlock = Block_init(pd);
+    if (!newBlock) return 0;
+
+    int half = block->count / 2;
+    newBlock->count = block->count - half;
+    memcpy(newBlock->items, block->items + half, (size_t)newBlock->count * sizeof(void*));
+    block->count = half;
+    Block_linkAfter(pd, newBlock, block);
+
+    if (offset > half) {
+      block = newBlock;
+      offset -= half;
+    }
+  }
+
+  memmove(block->items + offset + 1, block->items + offset, (size_t)(block->count - offset) * sizeof(void*));
+  block->items[offset] = dataPtr;
+  block->count++;
+  pd->length++;
+  return 1;
+}
+
+/** remove and return the item at offset of block, merging underfull blocks */
+static void* Block_remove(privateData* pd, Block* block, int offset) {
+  void* returnData = block->items[offset];
+  memmove(block->items + offset, block->items + offset + 1, (size_t)(block->count - offset - 1) * sizeof(void*));
+  block->count--;
+  pd->length--;
+
+  if (block->count == 0) {
+    Block_free(pd, block);
+    return returnData;
+  }
+
+  if (block->count >= pd->blockItems / 2)
+    return returnData;
+
+  Block* nextBlock = block->next;
+  Block* prevBlock = block->prev;
+  if (nextBlock && block->count + nextBlock->count <= pd->blockItems) {
+    memcpy(block->items + block->count, nextBlock->items, (size_t)nextBlock->count * sizeof(void*));
+    block->count += nextBlock->count;
+    Block_free(pd, nextBlock);
+  } else if (prevBlock && prevBlock->count + block->count <= pd->blockItems) {
+    memcpy(prevBlock->items + prevBlock->count, block->items, (size_t)block->count * sizeof(void*));
+    prevBlock->count += block->count;
+    Block_free(pd, block);
+  }
+
+  return returnData;
+}
+
+/**************************************************/
+/* LDSC_unrolledList */
+
+/**
+  * @brief Get length of the unrolled list.
+  * @param self LDSC_unrolledList pointer.
+  * @param status Error pointer.
+  * @return Length of the unrolled list as integer type.
+  */
+int LDSC_unrolledList_length(LDSC_unrolledList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length;
+}
+
+/**
+  * @brief Check if unrolled list is empty.
+  * @param self LDSC_unrolledList pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_unrolledList_empty(LDSC_unrolledList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->length == 0;
+}
+
+/**
+  * @brief Add item at the end of the unrolled list.
+  * @param self LDSC_unrolledList pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * A new tail block is started when the tail block is full.
+  */
+void LDSC_unrolledList_append(LDSC_unrolledList* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  Block* tailBlock = pd->tail;
+  if (!tailBlock || tailBlock->count == pd->blockItems) {
+    tailBlock = Block_init(pd);
+    if (!tailBlock) {
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+    Block_linkAfter(pd, tailBlock, pd->tail);
+  }
+
+  tailBlock->items[tailBlock->count++] = dataPtr;
+  pd->length++;
+  return;
+}
+
+/**
+  * @brief Add item at the front of the unrolled list.
+  * @param self LDSC_unrolledList pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * A new head block is started when the head block is full.
+  */
+void LDSC_unrolledList_prepend(LDSC_unrolledList* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  Block* headBlock = pd->head;
+  if (!headBlock || headBlock->count == pd->blockItems) {
+    headBlock = Block_init(pd);
+    if (!headBlock) {
+      if (status) *status = NODE_MALLOC;
+      return;
+    }
+    Block_linkAfter(pd, headBlock, NULL);
+  }
+
+  Block_insert(pd, headBlock, 0, dataPtr);
+  return;
+}
+
+/**
+  * @brief Add item at index of the unrolled list.
+  * @param self LDSC_unrolledList pointer.
+  * @param dataPtr Pointer to data.
+  * @param index Index to add item at.
+  * @param status Error pointer.
+  * @details
+  * Keep note that add performs a shallow copy of the data.
+  */
+void LDSC_unrolledList_add(LDSC_unrolledList* self, void* dataPtr, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return;
+  }
+
+  if (index > self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return;
+  }
+
+  if (index == 0) return LDSC_unrolledList_prepend(self, dataPtr, status);
+  if (index == self->pd->length) return LDSC_unrolledList_append(self, dataPtr, status);
+
+  int offset;
+  Block* targetBlock = Block_find(self->pd, index, &offset);
+  if (!Block_insert(self->pd, targetBlock, offset, dataPtr))
+    if (status) *status = NODE_MALLOC;
+
+  return;
+}
+
+/**
+  * @brief Get item at index.
+  * @param self LDSC_unrolledList pointer.
+  * @param index Index of item to get.
+  * @param status Error pointer.
+  * @return Data pointer of item at index.
+  */
+void* LDSC_unrolledList_at(LDSC_unrolledList* self, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return NULL;
+  }
+
+  if (index >= self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  int offset;
+  Block* targetBlock = Block_find(self->pd, index, &offset);
+  return targetBlock->items[offset];
+}
+
+/**
+  * @brief Replace item at index.
+  * @param self LDSC_unrolledList pointer.
+  * @param dataPtr Pointer to data.
+  * @param index Index of item to replace with dataPtr.
+  * @param status Error pointer.
+  * @return Data pointer of item that was replaced.
+  */
+void* LDSC_unrolledList_replace(LDSC_unrolledList* self, void* dataPtr, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return NULL;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return NULL;
+  }
+
+  if (index >= self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  int offset;
+  Block* targetBlock = Block_find(self->pd, index, &offset);
+  void* replacedDataPtr = targetBlock->items[offset];
+  targetBlock->items[offset] = dataPtr;
+  return replacedDataPtr;
+}
+
+/**
+  * @brief Remove item at the front of the list.
+  * @param self LDSC_unrolledList pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_unrolledList_pop(LDSC_unrolledList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!self->pd->head)
+    return NULL;
+
+  return Block_remove(self->pd, self->pd->head, 0);
+}
+
+/**
+  * @brief Remove item at the end of the list.
+  * @param self LDSC_unrolledList pointer.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_unrolledList_pull(LDSC_unrolledList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (!self->pd->tail)
+    return NULL;
+
+  return Block_remove(self->pd, self->pd->tail, self->pd->tail->count - 1);
+}
+
+/**
+  * @brief Remove item at index.
+  * @param self LDSC_unrolledList pointer.
+  * @param index Index of item to remove.
+  * @param status Error pointer.
+  * @return Data pointer of item that was removed.
+  */
+void* LDSC_unrolledList_remove(LDSC_unrolledList* self, int index, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (index < 0) {
+    if (status) *status = LESS_THAN_INDEX;
+    return NULL;
+  }
+
+  if (index >= self->pd->length) {
+    if (status) *status = GREATER_THAN_INDEX;
+    return NULL;
+  }
+
+  int offset;
+  Block* targetBlock = Block_find(self->pd, index, &offset);
+  return Block_remove(self->pd, targetBlock, offset);
+}
+
+/**
+  * @brief Remove all items in the list.
+  * @param self LDSC_unrolledList pointer.
+  * @param status Error pointer.
+  */
+void LDSC_unrolledList_clear(LDSC_unrolledList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  while (self->pd->head)
+    Block_free(self->pd, self->pd->head);
+
+  self->pd->length = 0;
+  return;
+}
+
+/**
+  * @brief Call a function on every item from head to tail.
+  * @param self LDSC_unrolledList pointer.
+  * @param callback Function receiving each data pointer and ctx, nonzero return stops the walk.
+  * @param ctx User context passed to callback.
+  * @param status Error pointer.
+  */
+void LDSC_unrolledList_forEach(LDSC_unrolledList* self, int (*callback)(void* dataPtr, void* ctx), void* ctx, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!callback) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  for (Block* currBlock = self->pd->head; currBlock; currBlock = currBlock->next)
+    for (int i = 0; i < currBlock->count; i++)
+      if (callback(currBlock->items[i], ctx))
+        return;
+
+  return;
+}
+
+/**
+  * @brief Delete the unrolled list.
+  * @param self LDSC_unrolledList pointer.
+  * @param status Error pointer.
+  */
+void LDSC_unrolledList_delete(LDSC_unrolledList* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_unrolledList_clear(self, status);
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_unrolledList), allocator.context);
+  return;
+}
+
+/**************************************************/
+
+/**
+ * @brief Create a new unrolled list.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_unrolledList.
+ */
+LDSC_unrolledList* LDSC_unrolledList_init(LDSC_error* status) {
+  return LDSC_unrolledList_init_with(NULL, 0, status);
+}
+
+/**
+ * @brief Create a new unrolled list with explicit block size and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param blockItems Items per block (K), 0 for LDSC_UNROLLEDLIST_DEFAULT_BLOCK_ITEMS.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_unrolledList.
+ */
+LDSC_unrolledList* LDSC_unrolledList_init_with(const LDSC_allocator* allocator, int blockItems, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (blockItems < 0 || blockItems == 1) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_unrolledList* newList = allocator->alloc(sizeof(LDSC_unrolledList), allocator->context);
+  if (!newList) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newList->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newList->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newList, sizeof(LDSC_unrolledList), allocator->context);
+    return NULL;
+  }
+
+  newList->pd->length = 0;
+  newList->pd->head = NULL;
+  newList->pd->tail = NULL;
+  newList->pd->blockItems = blockItems ? blockItems : LDSC_UNROLLEDLIST_DEFAULT_BLOCK_ITEMS;
+  newList->pd->allocator = *allocator;
+
+  newList->length = &LDSC_unrolledList_length;
+  newList->empty = &LDSC_unrolledList_empty;
+  newList->append = &LDSC_unrolledList_append;
+  newList->prepend = &LDSC_unrolledList_prepend;
+  newList->add = &LDSC_unrolledList_add;
+  newList->at = &LDSC_unrolledList_at;
+  newList->replace = &LDSC_unrolledList_replace;
+  newList->pop = &LDSC_unrolledList_pop;
+  newList->pull = &LDSC_unrolledList_pull;
+  newList->remove = &LDSC_unrolledList_remove;
+  newList->clear = &LDSC_unrolledList_clear;
+  newList->forEach = &LDSC_unrolledList_forEach;
+  newList->delete = &LDSC_unrolledList_delete;
+
+  return newList;
+}
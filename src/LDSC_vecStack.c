@@ -0,0 +1,329 @@
+#include <LDSC_vecStack.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** largest capacity a vector stack may grow to */
+#define VECSTACK_MAX_CAPACITY (1 << 30)
+
+/**
+  * @brief Opaque container for private data.
+  */
+struct privateData {
+  int size;
+  void** buffer;
+  int capacity;
+  int minCapacity;
+  int autoShrink;
+  LDSC_allocator allocator;
+};
+
+/** move the items into a new buffer of the given capacity */
+static int VecStack_resize(privateData* pd, int capacity) {
+  void** newBuffer = (void**)pd->allocator.alloc((size_t)capacity * sizeof(void*), pd->allocator.context);
+  if (!newBuffer) return 0;
+
+  memcpy(newBuffer, pd->buffer, (size_t)pd->size * sizeof(void*));
+  pd->allocator.free(pd->buffer, (size_t)pd->capacity * sizeof(void*), pd->allocator.context);
+  pd->buffer = newBuffer;
+  pd->capacity = capacity;
+  return 1;
+}
+
+/**************************************************/
+/* LDSC_vecStack */
+
+/**
+  * @brief Get size of the stack.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  * @return Size of the stack as integer type.
+  */
+int LDSC_vecStack_size(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->size;
+}
+
+/**
+  * @brief Push an item to the stack.
+  * @param self Vector stack pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that push performs a shallow copy of the data.
+  */
+void LDSC_vecStack_push(LDSC_vecStack* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  if (pd->size == pd->capacity) {
+    if (pd->capacity >= VECSTACK_MAX_CAPACITY || !VecStack_resize(pd, 2 * pd->capacity)) {
+      if (status) *status = BUFFER_MALLOC;
+      return;
+    }
+  }
+
+  pd->buffer[pd->size++] = dataPtr;
+  return;
+}
+
+/**
+  * @brief Check if stack is empty.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty
+  */
+int LDSC_vecStack_empty(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->size == 0;
+}
+
+/**
+  * @brief Peek item at the top of the stack.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the top of the stack.
+  */
+void* LDSC_vecStack_peek(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  if (self->pd->size == 0)
+    return NULL;
+
+  return self->pd->buffer[self->pd->size - 1];
+}
+
+/**
+  * @brief Pop an item from the stack.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  * @return Pointer to data at the top of the stack.
+  */
+void* LDSC_vecStack_pop(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  if (pd->size == 0)
+    return NULL;
+
+  void* dataTop = pd->buffer[--pd->size];
+
+  if (pd->autoShrink && pd->capacity > pd->minCapacity && pd->size <= pd->capacity / 4) {
+    int newCapacity = pd->capacity / 2;
+    if (newCapacity < pd->minCapacity)
+      newCapacity = pd->minCapacity;
+    VecStack_resize(pd, newCapacity);
+  }
+
+  return dataTop;
+}
+
+/**
+  * @brief Get capacity of the stack.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  * @return Number of items the stack holds before growing.
+  */
+int LDSC_vecStack_capacity(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return self->pd->capacity;
+}
+
+/**
+  * @brief Grow the buffer to hold at least count items.
+  * @param self Vector stack pointer.
+  * @param count Number of items to reserve space for.
+  * @param status Error pointer.
+  */
+void LDSC_vecStack_reserve(LDSC_vecStack* self, int count, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (count < 0 || count > VECSTACK_MAX_CAPACITY) {
+    if (status) *status = INVALID_CAPACITY;
+    return;
+  }
+
+  if (count <= self->pd->capacity)
+    return;
+
+  if (!VecStack_resize(self->pd, count))
+    if (status) *status = BUFFER_MALLOC;
+
+  return;
+}
+
+/**
+  * @brief Shrink the buffer to the current size of the stack.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  */
+void LDSC_vecStack_shrinkToFit(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  int newCapacity = self->pd->size ? self->pd->size : 1;
+  if (newCapacity == self->pd->capacity)
+    return;
+
+  if (!VecStack_resize(self->pd, newCapacity))
+    if (status) *status = BUFFER_MALLOC;
+
+  return;
+}
+
+/**
+  * @brief Enable or disable shrinking the buffer on pop.
+  * @param self Vector stack pointer.
+  * @param enabled Integer where 1 = enabled and 0 = disabled.
+  * @param status Error pointer.
+  */
+void LDSC_vecStack_setAutoShrink(LDSC_vecStack* self, int enabled, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  self->pd->autoShrink = enabled != 0;
+  return;
+}
+
+/**
+  * @brief Delete the stack.
+  * @param self Vector stack pointer.
+  * @param status Error pointer.
+  */
+void LDSC_vecStack_delete(LDSC_vecStack* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  allocator.free(self->pd->buffer, (size_t)self->pd->capacity * sizeof(void*), allocator.context);
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_vecStack), allocator.context);
+  return;
+}
+
+/**
+ * @brief Create a new vector stack.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_vecStack.
+ */
+LDSC_vecStack* LDSC_vecStack_init(LDSC_error* status) {
+  return LDSC_vecStack_init_with(NULL, 0, status);
+}
+
+/**
+ * @brief Create a new vector stack with explicit capacity and allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Initial capacity, 0 for LDSC_VECSTACK_DEFAULT_CAPACITY.
+ * @param status Error pointer.
+ * @return Pointer to an LDSC_vecStack.
+ */
+LDSC_vecStack* LDSC_vecStack_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (capacity < 0 || capacity > VECSTACK_MAX_CAPACITY) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_vecStack* newStack = allocator->alloc(sizeof(LDSC_vecStack), allocator->context);
+  if (!newStack) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newStack->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newStack->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newStack, sizeof(LDSC_vecStack), allocator->context);
+    return NULL;
+  }
+
+  if (!capacity) capacity = LDSC_VECSTACK_DEFAULT_CAPACITY;
+  newStack->pd->buffer = allocator->alloc((size_t)capacity * sizeof(void*), allocator->context);
+  if (!newStack->pd->buffer) {
+    if (status) *status = BUFFER_MALLOC;
+    allocator->free(newStack->pd, sizeof(privateData), allocator->context);
+    allocator->free(newStack, sizeof(LDSC_vecStack), allocator->context);
+    return NULL;
+  }
+
+  newStack->pd->size = 0;
+  newStack->pd->capacity = capacity;
+  newStack->pd->minCapacity = capacity;
+  newStack->pd->autoShrink = 0;
+  newStack->pd->allocator = *allocator;
+
+  newStack->size = &LDSC_vecStack_size;
+  newStack->push = &LDSC_vecStack_push;
+  newStack->empty = &LDSC_vecStack_empty;
+  newStack->peek = &LDSC_vecStack_peek;
+  newStack->pop = &LDSC_vecStack_pop;
+  newStack->capacity = &LDSC_vecStack_capacity;
+  newStack->reserve = &LDSC_vecStack_reserve;
+  newStack->shrinkToFit = &LDSC_vecStack_shrinkToFit;
+  newStack->setAutoShrink = &LDSC_vecStack_setAutoShrink;
+  newStack->delete = &LDSC_vecStack_delete;
+
+  return newStack;
+}
+
@@ -0,0 +1,323 @@
+#include <LDSC_workDeque.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/** assumed cache line size used to keep top and bottom apart */
+#define WORKDEQUE_CACHE_LINE 64
+
+/** largest capacity a work deque may hold */
+#define WORKDEQUE_MAX_CAPACITY (1 << 30)
+
+/**
+  * @brief Circular buffer of a work deque.
+  * @details
+  * Slots are atomic because a thief may read a slot the owner is about to
+  * overwrite; such a read is discarded when the thief's CAS on top fails.
+  * prev links replaced buffers so delete can release them.
+  */
+typedef struct Buffer {
+  struct Buffer* prev;
+  int64_t mask;
+  _Atomic(void*) slots[];
+} Buffer;
+
+/**
+  * @brief Opaque container for private data.
+  * @details
+  * top is advanced by thieves (and by the owner taking the last item) with a
+  * CAS; bottom is only written by the owner. Both grow without wrapping and
+  * are reduced modulo the buffer size on access.
+  */
+struct privateData {
+  _Atomic(Buffer*) buffer;
+  LDSC_allocator allocator;
+
+  char padTop[WORKDEQUE_CACHE_LINE];
+  _Atomic int64_t top;
+
+  char padBottom[WORKDEQUE_CACHE_LINE];
+  _Atomic int64_t bottom;
+
+  char padEnd[WORKDEQUE_CACHE_LINE];
+};
+
+/** round capacity up to the next power of two */
+static int64_t WorkDeque_roundUp(int capacity) {
+  int64_t size = 1;
+  while (size < capacity)
+    size <<= 1;
+  return size;
+}
+
+/** allocate a buffer of size slots */
+static Buffer* Buffer_init(privateData* pd, int64_t size) {
+  Buffer* buffer = pd->allocator.alloc(sizeof(Buffer) + size * sizeof(void*), pd->allocator.context);
+  if (!buffer) return NULL;
+
+  buffer->prev = NULL;
+  buffer->mask = size - 1;
+  return buffer;
+}
+
+/** replace the buffer by one twice as large holding the items in [top, bottom) */
+static Buffer* WorkDeque_grow(privateData* pd, Buffer* old, int64_t top, int64_t bottom) {
+  if (old->mask + 1 >= WORKDEQUE_MAX_CAPACITY) return NULL;
+
+  Buffer* buffer = Buffer_init(pd, 2 * (old->mask + 1));
+  if (!buffer) return NULL;
+
+  for (int64_t i = top; i < bottom; i++) {
+    void* dataPtr = atomic_load_explicit(&old->slots[i & old->mask], memory_order_relaxed);
+    atomic_store_explicit(&buffer->slots[i & buffer->mask], dataPtr, memory_order_relaxed);
+  }
+
+  buffer->prev = old;
+  atomic_store_explicit(&pd->buffer, buffer, memory_order_release);
+  return buffer;
+}
+
+/**************************************************/
+/* LDSC_workDeque */
+
+/**
+  * @brief Get length of the deque.
+  * @param self Work deque pointer.
+  * @param status Error pointer.
+  * @return Length of the deque as integer type.
+  */
+int LDSC_workDeque_length(LDSC_workDeque* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  int64_t bottom = atomic_load_explicit(&self->pd->bottom, memory_order_acquire);
+  int64_t top = atomic_load_explicit(&self->pd->top, memory_order_acquire);
+  return bottom > top ? (int)(bottom - top) : 0;
+}
+
+/**
+  * @brief Check if deque is empty.
+  * @param self Work deque pointer.
+  * @param status Error pointer.
+  * @return Integer where 1 = empty and 0 = not empty.
+  */
+int LDSC_workDeque_empty(LDSC_workDeque* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return ERROR;
+  }
+
+  return LDSC_workDeque_length(self, NULL) == 0;
+}
+
+/**
+  * @brief Push item to the bottom of the deque. Owner only.
+  * @param self Work deque pointer.
+  * @param dataPtr Pointer to data.
+  * @param status Error pointer.
+  * @details
+  * Keep note that push performs a shallow copy of the data.
+  */
+void LDSC_workDeque_push(LDSC_workDeque* self, void* dataPtr, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  if (!dataPtr) {
+    if (status) *status = NULL_DATAPTR;
+    return;
+  }
+
+  privateData* pd = self->pd;
+  int64_t bottom = atomic_load_explicit(&pd->bottom, memory_order_relaxed);
+  int64_t top = atomic_load_explicit(&pd->top, memory_order_acquire);
+  Buffer* buffer = atomic_load_explicit(&pd->buffer, memory_order_relaxed);
+
+  if (bottom - top > buffer->mask) {
+    buffer = WorkDeque_grow(pd, buffer, top, bottom);
+    if (!buffer) {
+      if (status) *status = BUFFER_MALLOC;
+      return;
+    }
+  }
+
+  atomic_store_explicit(&buffer->slots[bottom & buffer->mask], dataPtr, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&pd->bottom, bottom + 1, memory_order_relaxed);
+  return;
+}
+
+/**
+  * @brief Pop item from the bottom of the deque. Owner only.
+  * @param self Work deque pointer.
+  * @param status Error pointer.
+  * @return Pointer to the most recently pushed data.
+  */
+void* LDSC_workDeque_pop(LDSC_workDeque* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  int64_t bottom = atomic_load_explicit(&pd->bottom, memory_order_relaxed) - 1;
+  Buffer* buffer = atomic_load_explicit(&pd->buffer, memory_order_relaxed);
+  atomic_store_explicit(&pd->bottom, bottom, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  int64_t top = atomic_load_explicit(&pd->top, memory_order_relaxed);
+
+  if (top > bottom) {
+    atomic_store_explicit(&pd->bottom, bottom + 1, memory_order_relaxed);
+    if (status) *status = STRUCTURE_EMPTY;
+    return NULL;
+  }
+
+  void* dataPtr = atomic_load_explicit(&buffer->slots[bottom & buffer->mask], memory_order_relaxed);
+  if (top == bottom) {
+    /* last item: race the thieves for it */
+    if (!atomic_compare_exchange_strong_explicit(&pd->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+      dataPtr = NULL;
+      if (status) *status = STRUCTURE_EMPTY;
+    }
+    atomic_store_explicit(&pd->bottom, bottom + 1, memory_order_relaxed);
+  }
+
+  return dataPtr;
+}
+
+/**
+  * @brief Steal item from the top of the deque. Any thread.
+  * @param self Work deque pointer.
+  * @param status Error pointer.
+  * @return Pointer to the oldest data.
+  */
+void* LDSC_workDeque_steal(LDSC_workDeque* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return NULL;
+  }
+
+  privateData* pd = self->pd;
+  for (;;) {
+    int64_t top = atomic_load_explicit(&pd->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&pd->bottom, memory_order_acquire);
+
+    if (top >= bottom) {
+      if (status) *status = STRUCTURE_EMPTY;
+      return NULL;
+    }
+
+    Buffer* buffer = atomic_load_explicit(&pd->buffer, memory_order_acquire);
+    void* dataPtr = atomic_load_explicit(&buffer->slots[top & buffer->mask], memory_order_relaxed);
+    if (atomic_compare_exchange_strong_explicit(&pd->top, &top, top + 1,
+                                                memory_order_seq_cst, memory_order_relaxed))
+      return dataPtr;
+  }
+}
+
+/**
+  * @brief Delete the deque.
+  * @param self Work deque pointer.
+  * @param status Error pointer.
+  */
+void LDSC_workDeque_delete(LDSC_workDeque* self, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (!self) {
+    if (status) *status = NULL_SELF;
+    return;
+  }
+
+  LDSC_allocator allocator = self->pd->allocator;
+  Buffer* buffer = atomic_load_explicit(&self->pd->buffer, memory_order_relaxed);
+  while (buffer) {
+    Buffer* prev = buffer->prev;
+    allocator.free(buffer, sizeof(Buffer) + (buffer->mask + 1) * sizeof(void*), allocator.context);
+    buffer = prev;
+  }
+
+  allocator.free(self->pd, sizeof(privateData), allocator.context);
+  allocator.free(self, sizeof(LDSC_workDeque), allocator.context);
+  return;
+}
+
+/**
+ * @brief Create a new work-stealing deque.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_workDeque.
+ */
+LDSC_workDeque* LDSC_workDeque_init(LDSC_error* status) {
+  return LDSC_workDeque_init_with(NULL, 0, status);
+}
+
+/**
+ * @brief Create a new work-stealing deque using a custom allocator.
+ * @param allocator Allocator pointer, NULL for the default allocator.
+ * @param capacity Initial capacity, 0 for LDSC_WORKDEQUE_DEFAULT_CAPACITY.
+ * @param status Error pointer.
+ * @return Pointer to a LDSC_workDeque.
+ */
+LDSC_workDeque* LDSC_workDeque_init_with(const LDSC_allocator* allocator, int capacity, LDSC_error* status) {
+  if (status) *status = OK;
+
+  if (capacity < 0 || capacity > WORKDEQUE_MAX_CAPACITY) {
+    if (status) *status = INVALID_CAPACITY;
+    return NULL;
+  }
+
+  if (!allocator) allocator = LDSC_allocator_default();
+  if (!allocator->alloc || !allocator->free) {
+    if (status) *status = INVALID_ALLOCATOR;
+    return NULL;
+  }
+
+  LDSC_workDeque* newDeque = allocator->alloc(sizeof(LDSC_workDeque), allocator->context);
+  if (!newDeque) {
+    if (status) *status = STRUCTURE_MALLOC;
+    return NULL;
+  }
+
+  newDeque->pd = allocator->alloc(sizeof(privateData), allocator->context);
+  if (!newDeque->pd) {
+    if (status) *status = PRIVATEDATA_MALLOC;
+    allocator->free(newDeque, sizeof(LDSC_workDeque), allocator->context);
+    return NULL;
+  }
+
+  newDeque->pd->allocator = *allocator;
+  Buffer* buffer = Buffer_init(newDeque->pd, WorkDeque_roundUp(capacity ? capacity : LDSC_WORKDEQUE_DEFAULT_CAPACITY));
+  if (!buffer) {
+    if (status) *status = BUFFER_MALLOC;
+    allocator->free(newDeque->pd, sizeof(privateData), allocator->context);
+    allocator->free(newDeque, sizeof(LDSC_workDeque), allocator->context);
+    return NULL;
+  }
+
+  atomic_init(&newDeque->pd->buffer, buffer);
+  atomic_init(&newDeque->pd->top, 0);
+  atomic_init(&newDeque->pd->bottom, 0);
+
+  newDeque->empty = &LDSC_workDeque_empty;
+  newDeque->length = &LDSC_workDeque_length;
+  newDeque->push = &LDSC_workDeque_push;
+  newDeque->pop = &LDSC_workDeque_pop;
+  newDeque->steal = &LDSC_workDeque_steal;
+  newDeque->delete = &LDSC_workDeque_delete;
+
+  return newDeque;
+}
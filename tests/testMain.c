@@ -7,7 +7,18 @@
 #include "LDSC_stack.h"
 #include "test_linkedLists.h"
 #include "test_stack.h"
+#include "test_vecStack.h"
 #include "test_queue.h"
+#include "test_ringQueue.h"
+#include "test_spscQueue.h"
+#include "test_mpmcQueue.h"
+#include "test_blockingQueue.h"
+#include "test_workDeque.h"
+#include "test_unrolledList.h"
+#include "test_skipList.h"
+#include "test_generic.h"
+#include "test_histogram.h"
+#include "test_priorityQueue.h"
 
 
 START_TEST(check) {} END_TEST
@@ -30,7 +41,18 @@ int main() {
 
   srunner_add_suite(sr, LDSC_linkedList_suite());
   srunner_add_suite(sr, LDSC_stack_suite());
+  srunner_add_suite(sr, LDSC_vecStack_suite());
   srunner_add_suite(sr, LDSC_queue_suite());
+  srunner_add_suite(sr, LDSC_ringQueue_suite());
+  srunner_add_suite(sr, LDSC_spscQueue_suite());
+  srunner_add_suite(sr, LDSC_mpmcQueue_suite());
+  srunner_add_suite(sr, LDSC_blockingQueue_suite());
+  srunner_add_suite(sr, LDSC_workDeque_suite());
+  srunner_add_suite(sr, LDSC_unrolledList_suite());
+  srunner_add_suite(sr, LDSC_skipList_suite());
+  srunner_add_suite(sr, LDSC_generic_suite());
+  srunner_add_suite(sr, LDSC_histogram_suite());
+  srunner_add_suite(sr, LDSC_priorityQueue_suite());
 
   srunner_run_all(sr, CK_VERBOSE);
 
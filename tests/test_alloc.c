@@ -0,0 +1,30 @@
+#include <stdlib.h>
+
+#include "test_alloc.h"
+
+void* counting_alloc(size_t size, void* context) {
+  AllocCounter* counter = (AllocCounter*)context;
+  counter->allocs++;
+  counter->bytes += size;
+  return malloc(size);
+}
+
+void counting_free(void* ptr, size_t size, void* context) {
+  AllocCounter* counter = (AllocCounter*)context;
+  counter->frees++;
+  counter->bytes -= size;
+  free(ptr);
+}
+
+void* limited_alloc(size_t size, void* context) {
+  int* remaining = (int*)context;
+  if (*remaining == 0) return NULL;
+  (*remaining)--;
+  return malloc(size);
+}
+
+void limited_free(void* ptr, size_t size, void* context) {
+  (void)size;
+  (void)context;
+  free(ptr);
+}
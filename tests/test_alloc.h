@@ -0,0 +1,30 @@
+#ifndef TEST_ALLOC_H
+#define TEST_ALLOC_H
+
+#include <stddef.h>
+
+/**
+ * Allocators shared by the test suites for the *_init_with constructors.
+ * The benchmarks count allocator calls per operation with counting_alloc.
+ */
+
+/* tally of the calls and live bytes seen by counting_alloc and counting_free */
+typedef struct AllocCounter {
+  long allocs;
+  long frees;
+  long bytes;
+} AllocCounter;
+
+/* malloc counting into the AllocCounter passed as context */
+void* counting_alloc(size_t size, void* context);
+
+/* free counting into the AllocCounter passed as context */
+void counting_free(void* ptr, size_t size, void* context);
+
+/* malloc failing once the int budget passed as context is spent */
+void* limited_alloc(size_t size, void* context);
+
+/* free matching limited_alloc */
+void limited_free(void* ptr, size_t size, void* context);
+
+#endif
@@ -0,0 +1,314 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "LDSC_errors.h"
+#include "LDSC_blockingQueue.h"
+#include "test_blockingQueue.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_blockingQueue data structure.
+ * Only the 'initialization' test will check for possible malloc errors.
+ * All following tests will assume successful mallocs.
+ * All tests will test for successful LDSC_blockingQueue delete.
+ * All status checks will occur before value checks, if applicable.
+ * Beyond that, status checks will only occur the methods that the test targets
+ */
+
+/**************************************************/
+
+enum Test_constants {
+  QUEUE_CAPACITY = 4,
+  TRANSFER_COUNT = 10000
+};
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(initialization) {
+  LDSC_error status = OK;
+
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myQueue);
+  ck_assert_ptr_nonnull(myQueue->pd);
+
+  int empty = myQueue->empty(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(empty, 1);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init_with(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myQueue);
+
+  myQueue = LDSC_blockingQueue_init_with(&allocator, 0, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myQueue);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE ENQUEUE START */
+
+START_TEST(enqueue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  int testData = 17;
+
+  myQueue->enqueue(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->enqueue(myQueue, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  int length = myQueue->length(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(length, ERROR);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(enqueue) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  int testData[] = {17, 9, 19};
+
+  for (int i = 0; i < 3; i++) {
+    myQueue->enqueue(myQueue, &testData[i], &status);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(myQueue->length(myQueue, &status), 3);
+
+  for (int i = 0; i < 3; i++)
+    ck_assert_int_eq(*(int*)myQueue->dequeue(myQueue, &status), testData[i]);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE ENQUEUE END */
+
+/**************************************************/
+
+/* TEST CASE DEQUEUE START */
+
+START_TEST(dequeue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  void* items[2];
+
+  void* dataPtr = myQueue->dequeue(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  dataPtr = myQueue->dequeueTimed(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  int count = myQueue->dequeueMany(myQueue, NULL, 2, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(count, 0);
+
+  count = myQueue->dequeueMany(myQueue, items, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_int_eq(count, 0);
+
+  count = myQueue->dequeueMany(myQueue, items, 0, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, 0);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(dequeueTimed) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  int testData = 17;
+
+  void* dataPtr = myQueue->dequeueTimed(myQueue, 10, &status);
+  ck_assert_int_eq(status, TIMED_OUT);
+  ck_assert_ptr_null(dataPtr);
+
+  myQueue->enqueue(myQueue, &testData, &status);
+  dataPtr = myQueue->dequeueTimed(myQueue, 10, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(dequeueMany) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  int testData[] = {17, 9, 19};
+  void* items[4];
+
+  for (int i = 0; i < 3; i++)
+    myQueue->enqueue(myQueue, &testData[i], &status);
+
+  int count = myQueue->dequeueMany(myQueue, items, 2, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, 2);
+  ck_assert_int_eq(*(int*)items[0], testData[0]);
+  ck_assert_int_eq(*(int*)items[1], testData[1]);
+
+  count = myQueue->dequeueMany(myQueue, items, 4, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, 1);
+  ck_assert_int_eq(*(int*)items[0], testData[2]);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE DEQUEUE END */
+
+/**************************************************/
+
+/* TEST CASE CLOSE START */
+
+static void* blockedConsumer(void* arg) {
+  LDSC_blockingQueue* myQueue = (LDSC_blockingQueue*)arg;
+  LDSC_error* status = malloc(sizeof(LDSC_error));
+  myQueue->dequeue(myQueue, status);
+  return status;
+}
+
+START_TEST(close_blocked) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  int testData = 17;
+  pthread_t thread;
+
+  pthread_create(&thread, NULL, &blockedConsumer, myQueue);
+
+  myQueue->close(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+
+  void* threadStatus = NULL;
+  pthread_join(thread, &threadStatus);
+  ck_assert_int_eq(*(LDSC_error*)threadStatus, STRUCTURE_CLOSED);
+  free(threadStatus);
+
+  myQueue->enqueue(myQueue, &testData, &status);
+  ck_assert_int_eq(status, STRUCTURE_CLOSED);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(close_drains) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init(&status);
+  int testData = 17;
+
+  myQueue->enqueue(myQueue, &testData, &status);
+  myQueue->close(myQueue, &status);
+
+  void* dataPtr = myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData);
+
+  dataPtr = myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(status, STRUCTURE_CLOSED);
+  ck_assert_ptr_null(dataPtr);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CLOSE END */
+
+/**************************************************/
+
+/* TEST CASE CONCURRENT START */
+
+static int transferData[TRANSFER_COUNT];
+
+static void* producer(void* arg) {
+  LDSC_blockingQueue* myQueue = (LDSC_blockingQueue*)arg;
+  for (int i = 0; i < TRANSFER_COUNT; i++)
+    myQueue->enqueue(myQueue, &transferData[i], NULL);
+  myQueue->close(myQueue, NULL);
+  return NULL;
+}
+
+START_TEST(bounded) {
+  LDSC_error status = OK;
+  LDSC_blockingQueue* myQueue = LDSC_blockingQueue_init_with(NULL, QUEUE_CAPACITY, &status);
+  pthread_t thread;
+  void* items[QUEUE_CAPACITY];
+
+  for (int i = 0; i < TRANSFER_COUNT; i++)
+    transferData[i] = i;
+
+  pthread_create(&thread, NULL, &producer, myQueue);
+
+  int expected = 0;
+  for (;;) {
+    int count = myQueue->dequeueMany(myQueue, items, QUEUE_CAPACITY, &status);
+    if (status == STRUCTURE_CLOSED)
+      break;
+    ck_assert_int_le(myQueue->length(myQueue, NULL), QUEUE_CAPACITY);
+    for (int i = 0; i < count; i++, expected++)
+      ck_assert_int_eq(*(int*)items[i], expected);
+  }
+
+  pthread_join(thread, NULL);
+  ck_assert_int_eq(expected, TRANSFER_COUNT);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CONCURRENT END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_blockingQueue_suite() {
+  Suite *s;
+  s = suite_create("LDSC_blockingQueue");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, initialization);
+  tcase_add_test(tc_core, init_with_invalid_params);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_enqueue = tcase_create("enqueue");
+  tcase_add_test(tc_enqueue, enqueue_invalid_params);
+  tcase_add_test(tc_enqueue, enqueue);
+  suite_add_tcase(s, tc_enqueue);
+
+  TCase* tc_dequeue = tcase_create("dequeue");
+  tcase_add_test(tc_dequeue, dequeue_invalid_params);
+  tcase_add_test(tc_dequeue, dequeueTimed);
+  tcase_add_test(tc_dequeue, dequeueMany);
+  suite_add_tcase(s, tc_dequeue);
+
+  TCase* tc_close = tcase_create("close");
+  tcase_add_test(tc_close, close_blocked);
+  tcase_add_test(tc_close, close_drains);
+  suite_add_tcase(s, tc_close);
+
+  TCase* tc_concurrent = tcase_create("concurrent");
+  tcase_add_test(tc_concurrent, bounded);
+  suite_add_tcase(s, tc_concurrent);
+
+  return s;
+}
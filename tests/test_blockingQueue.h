@@ -0,0 +1,8 @@
+#ifndef TEST_BLOCKINGQUEUE_H
+#define TEST_BLOCKINGQUEUE_H
+
+#include <check.h>
+
+Suite* LDSC_blockingQueue_suite(void);
+
+#endif
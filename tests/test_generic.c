@@ -0,0 +1,335 @@
+#include <stdlib.h>
+
+#include "LDSC_generic.h"
+#include "test_alloc.h"
+#include "test_generic.h"
+#include <check.h>
+
+/**
+ * Test suite for the LDSC_DEFINE_* macro generated containers.
+ * Each container is instantiated once for int and once for a small struct,
+ * the latter checking that values are copied in and out whole.
+ * All tests will test for successful delete.
+ * All status checks will occur before value checks, if applicable.
+ */
+
+typedef struct Point {
+  int x;
+  int y;
+} Point;
+
+LDSC_DEFINE_STACK(intStack, int)
+LDSC_DEFINE_QUEUE(intQueue, int)
+LDSC_DEFINE_QUEUE(pointQueue, Point)
+LDSC_DEFINE_LIST(intList, int)
+LDSC_DEFINE_LIST(pointList, Point)
+
+enum Generic_constants { GENERIC_ITEMS = 1000 };
+
+/**************************************************/
+
+/* TEST CASE STACK START */
+
+START_TEST(stack_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  intStack* myStack = intStack_init_with(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myStack);
+
+  myStack = intStack_init_with(&allocator, 8, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myStack);
+
+  myStack = intStack_init(&status);
+  ck_assert_int_eq(status, OK);
+
+  myStack->push(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(myStack->size(NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(myStack->pop(NULL, &status), 0);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  ck_assert_int_eq(myStack->pop(myStack, &status), 0);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  ck_assert_int_eq(myStack->peek(myStack, &status), 0);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(stack) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  intStack* myStack = intStack_init_with(&allocator, 1, &status);
+  ck_assert_int_eq(status, OK);
+
+  for (int i = 0; i < GENERIC_ITEMS; i++) {
+    myStack->push(myStack, i, &status);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(myStack->size(myStack, &status), GENERIC_ITEMS);
+  ck_assert_int_eq(myStack->peek(myStack, &status), GENERIC_ITEMS - 1);
+
+  for (int i = GENERIC_ITEMS - 1; i >= 0; i--) {
+    ck_assert_int_eq(myStack->pop(myStack, &status), i);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(myStack->empty(myStack, &status), 1);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE STACK END */
+
+/**************************************************/
+
+/* TEST CASE QUEUE START */
+
+START_TEST(queue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  intQueue* myQueue = intQueue_init_with(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myQueue);
+
+  myQueue = intQueue_init_with(&allocator, 8, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myQueue);
+
+  myQueue = intQueue_init(&status);
+  ck_assert_int_eq(status, OK);
+
+  myQueue->enqueue(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(myQueue->length(NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  ck_assert_int_eq(myQueue->dequeue(myQueue, &status), 0);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  ck_assert_int_eq(myQueue->peek(myQueue, &status), 0);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(queue_wraparound) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  intQueue* myQueue = intQueue_init_with(&allocator, 4, &status);
+  ck_assert_int_eq(status, OK);
+
+  /* keep the ring partly consumed while it grows so the items wrap */
+  int next = 0;
+  for (int i = 0; i < GENERIC_ITEMS; i++) {
+    myQueue->enqueue(myQueue, i, &status);
+    ck_assert_int_eq(status, OK);
+    if (i % 3 == 0) {
+      ck_assert_int_eq(myQueue->dequeue(myQueue, &status), next++);
+      ck_assert_int_eq(status, OK);
+    }
+  }
+  ck_assert_int_eq(myQueue->length(myQueue, &status), GENERIC_ITEMS - next);
+  ck_assert_int_eq(myQueue->peek(myQueue, &status), next);
+
+  while (!myQueue->empty(myQueue, &status)) {
+    ck_assert_int_eq(myQueue->dequeue(myQueue, &status), next++);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(next, GENERIC_ITEMS);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+START_TEST(queue_struct_values) {
+  LDSC_error status = OK;
+  pointQueue* myQueue = pointQueue_init(&status);
+  ck_assert_int_eq(status, OK);
+
+  for (int i = 0; i < GENERIC_ITEMS; i++) {
+    myQueue->enqueue(myQueue, (Point){ i, -i }, &status);
+    ck_assert_int_eq(status, OK);
+  }
+
+  for (int i = 0; i < GENERIC_ITEMS; i++) {
+    Point point = myQueue->dequeue(myQueue, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(point.x, i);
+    ck_assert_int_eq(point.y, -i);
+  }
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE QUEUE END */
+
+/**************************************************/
+
+/* TEST CASE LIST START */
+
+START_TEST(list_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  intList* myLL = intList_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myLL);
+
+  myLL = intList_init(&status);
+  ck_assert_int_eq(status, OK);
+
+  myLL->append(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(myLL->at(myLL, 0, &status), 0);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_int_eq(myLL->at(myLL, -1, &status), 0);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  ck_assert_int_eq(myLL->pop(myLL, &status), 0);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  ck_assert_int_eq(myLL->pull(myLL, &status), 0);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  myLL->add(myLL, 1, -1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  myLL->add(myLL, 1, 1, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_int_eq(myLL->remove(myLL, -1, &status), 0);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  ck_assert_int_eq(myLL->remove(myLL, 0, &status), 0);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+
+  int remaining = 1;
+  LDSC_allocator limited = { &limited_alloc, &limited_free, &remaining };
+  myLL = intList_init_with(&limited, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->append(myLL, 1, &status);
+  ck_assert_int_eq(status, NODE_MALLOC);
+  ck_assert_int_eq(myLL->length(myLL, &status), 0);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(list) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  intList* myLL = intList_init_with(&allocator, &status);
+  ck_assert_int_eq(status, OK);
+
+  for (int i = 0; i < GENERIC_ITEMS; i++) {
+    myLL->append(myLL, i, &status);
+    ck_assert_int_eq(status, OK);
+  }
+  myLL->prepend(myLL, -1, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), GENERIC_ITEMS + 1);
+  ck_assert_int_eq(counter.allocs, GENERIC_ITEMS + 2);
+
+  for (int i = 0; i < GENERIC_ITEMS; i++)
+    ck_assert_int_eq(myLL->at(myLL, i + 1, &status), i);
+
+  ck_assert_int_eq(myLL->replace(myLL, 42, GENERIC_ITEMS / 2, &status), GENERIC_ITEMS / 2 - 1);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->at(myLL, GENERIC_ITEMS / 2, &status), 42);
+
+  ck_assert_int_eq(myLL->pop(myLL, &status), -1);
+  ck_assert_int_eq(myLL->pull(myLL, &status), GENERIC_ITEMS - 1);
+  ck_assert_int_eq(myLL->length(myLL, &status), GENERIC_ITEMS - 1);
+
+  myLL->add(myLL, 7, 0, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->add(myLL, 8, 3, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->add(myLL, 9, GENERIC_ITEMS + 1, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), GENERIC_ITEMS + 2);
+  ck_assert_int_eq(myLL->at(myLL, 0, &status), 7);
+  ck_assert_int_eq(myLL->at(myLL, 1, &status), 0);
+  ck_assert_int_eq(myLL->at(myLL, 3, &status), 8);
+  ck_assert_int_eq(myLL->at(myLL, 4, &status), 2);
+
+  ck_assert_int_eq(myLL->remove(myLL, 3, &status), 8);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->remove(myLL, GENERIC_ITEMS, &status), 9);
+  ck_assert_int_eq(myLL->remove(myLL, 0, &status), 7);
+  ck_assert_int_eq(myLL->length(myLL, &status), GENERIC_ITEMS - 1);
+  ck_assert_int_eq(myLL->at(myLL, 2, &status), 2);
+  ck_assert_int_eq(myLL->pull(myLL, &status), GENERIC_ITEMS - 2);
+
+  myLL->clear(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->empty(myLL, &status), 1);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+START_TEST(list_struct_values) {
+  LDSC_error status = OK;
+  pointList* myLL = pointList_init(&status);
+  ck_assert_int_eq(status, OK);
+
+  for (int i = 0; i < GENERIC_ITEMS; i++)
+    myLL->prepend(myLL, (Point){ i, 2 * i }, &status);
+
+  Point point = myLL->at(myLL, GENERIC_ITEMS - 1, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(point.x, 0);
+  ck_assert_int_eq(point.y, 0);
+
+  point = myLL->pop(myLL, &status);
+  ck_assert_int_eq(point.x, GENERIC_ITEMS - 1);
+  ck_assert_int_eq(point.y, 2 * (GENERIC_ITEMS - 1));
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE LIST END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_generic_suite() {
+  Suite *s;
+  s = suite_create("LDSC_generic");
+
+  TCase* tc_stack = tcase_create("stack");
+  tcase_add_test(tc_stack, stack_invalid_params);
+  tcase_add_test(tc_stack, stack);
+  suite_add_tcase(s, tc_stack);
+
+  TCase* tc_queue = tcase_create("queue");
+  tcase_add_test(tc_queue, queue_invalid_params);
+  tcase_add_test(tc_queue, queue_wraparound);
+  tcase_add_test(tc_queue, queue_struct_values);
+  suite_add_tcase(s, tc_queue);
+
+  TCase* tc_list = tcase_create("list");
+  tcase_add_test(tc_list, list_invalid_params);
+  tcase_add_test(tc_list, list);
+  tcase_add_test(tc_list, list_struct_values);
+  suite_add_tcase(s, tc_list);
+
+  return s;
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_GENERIC_H
+#define TEST_GENERIC_H
+
+#include <check.h>
+
+Suite* LDSC_generic_suite(void);
+
+#endif
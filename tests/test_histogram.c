@@ -0,0 +1,190 @@
+#include <stdlib.h>
+
+#include "LDSC_histogram.h"
+#include "test_histogram.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_histogram.
+ * Percentiles are checked against the bucket bounds: a reported value is
+ * never below the exact one and at most 1/LDSC_HISTOGRAM_SUB_BUCKETS above.
+ * All tests will test for successful delete.
+ * All status checks will occur before value checks, if applicable.
+ */
+
+enum Histogram_constants { HISTOGRAM_VALUES = 10000 };
+
+/** check that reported lies within the bucket precision of exact */
+static void assert_within_precision(long long reported, long long exact) {
+  ck_assert_int_ge(reported, exact);
+  ck_assert_int_le(reported, exact + exact / LDSC_HISTOGRAM_SUB_BUCKETS);
+}
+
+/**************************************************/
+
+/* TEST CASE RECORD START */
+
+START_TEST(record_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_histogram* myHist = LDSC_histogram_init(&status);
+  ck_assert_int_eq(status, OK);
+
+  myHist->record(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myHist->record(myHist, -1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  ck_assert_int_eq(myHist->count(myHist, &status), 0);
+
+  myHist->min(myHist, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  myHist->max(myHist, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  myHist->mean(myHist, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  myHist->percentile(myHist, 50, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+
+  myHist->record(myHist, 1, &status);
+  myHist->percentile(myHist, -0.1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  myHist->percentile(myHist, 100.1, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  myHist->count(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  myHist->percentile(NULL, 50, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  myHist->reset(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  myHist->delete(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myHist->delete(myHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(record) {
+  LDSC_error status = OK;
+  LDSC_histogram* myHist = LDSC_histogram_init(&status);
+
+  for (int i = 1; i <= HISTOGRAM_VALUES; i++) {
+    myHist->record(myHist, i, &status);
+    ck_assert_int_eq(status, OK);
+  }
+
+  ck_assert_int_eq(myHist->count(myHist, &status), HISTOGRAM_VALUES);
+  ck_assert_int_eq(myHist->min(myHist, &status), 1);
+  ck_assert_int_eq(myHist->max(myHist, &status), HISTOGRAM_VALUES);
+  ck_assert(myHist->mean(myHist, &status) == (HISTOGRAM_VALUES + 1) / 2.0);
+
+  ck_assert_int_eq(myHist->percentile(myHist, 0, &status), 1);
+  ck_assert_int_eq(status, OK);
+  assert_within_precision(myHist->percentile(myHist, 50, &status), HISTOGRAM_VALUES / 2);
+  assert_within_precision(myHist->percentile(myHist, 99, &status), HISTOGRAM_VALUES * 99 / 100);
+  assert_within_precision(myHist->percentile(myHist, 99.9, &status), HISTOGRAM_VALUES * 999 / 1000);
+  ck_assert_int_eq(myHist->percentile(myHist, 100, &status), HISTOGRAM_VALUES);
+
+  myHist->reset(myHist, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myHist->count(myHist, &status), 0);
+
+  myHist->delete(myHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(record_exact_small_values) {
+  LDSC_error status = OK;
+  LDSC_histogram* myHist = LDSC_histogram_init(&status);
+
+  for (int i = 0; i < 2 * LDSC_HISTOGRAM_SUB_BUCKETS; i++)
+    myHist->record(myHist, i, &status);
+
+  for (int i = 1; i < 2 * LDSC_HISTOGRAM_SUB_BUCKETS; i++)
+    ck_assert_int_eq(myHist->percentile(myHist, 100.0 * (i + 1) / (2 * LDSC_HISTOGRAM_SUB_BUCKETS), &status), i);
+
+  myHist->record(myHist, LDSC_HISTOGRAM_MAX_VALUE * 4, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myHist->percentile(myHist, 100, &status), LDSC_HISTOGRAM_MAX_VALUE * 4);
+
+  myHist->delete(myHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE RECORD END */
+
+/**************************************************/
+
+/* TEST CASE MERGE START */
+
+START_TEST(merge_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_histogram* myHist = LDSC_histogram_init(&status);
+
+  myHist->merge(NULL, myHist, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myHist->merge(myHist, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myHist->delete(myHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(merge) {
+  LDSC_error status = OK;
+  LDSC_histogram* whole = LDSC_histogram_init(&status);
+  LDSC_histogram* low = LDSC_histogram_init(&status);
+  LDSC_histogram* high = LDSC_histogram_init(&status);
+  LDSC_histogram* merged = LDSC_histogram_init(&status);
+
+  for (int i = 0; i < HISTOGRAM_VALUES; i++) {
+    long long value = rand() % 1000000;
+    whole->record(whole, value, &status);
+    if (value < 500000) low->record(low, value, &status);
+    else high->record(high, value, &status);
+  }
+
+  merged->merge(merged, high, &status);
+  ck_assert_int_eq(status, OK);
+  merged->merge(merged, low, &status);
+  ck_assert_int_eq(status, OK);
+
+  ck_assert_int_eq(merged->count(merged, &status), HISTOGRAM_VALUES);
+  ck_assert_int_eq(merged->min(merged, &status), whole->min(whole, &status));
+  ck_assert_int_eq(merged->max(merged, &status), whole->max(whole, &status));
+  ck_assert(merged->mean(merged, &status) == whole->mean(whole, &status));
+  ck_assert_int_eq(merged->percentile(merged, 50, &status), whole->percentile(whole, 50, &status));
+  ck_assert_int_eq(merged->percentile(merged, 99.9, &status), whole->percentile(whole, 99.9, &status));
+  ck_assert_int_eq(high->count(high, &status) + low->count(low, &status), HISTOGRAM_VALUES);
+
+  whole->delete(whole, &status);
+  low->delete(low, &status);
+  high->delete(high, &status);
+  merged->delete(merged, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE MERGE END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_histogram_suite() {
+  Suite *s;
+  s = suite_create("LDSC_histogram");
+
+  TCase* tc_record = tcase_create("record");
+  tcase_add_test(tc_record, record_invalid_params);
+  tcase_add_test(tc_record, record);
+  tcase_add_test(tc_record, record_exact_small_values);
+  suite_add_tcase(s, tc_record);
+
+  TCase* tc_merge = tcase_create("merge");
+  tcase_add_test(tc_merge, merge_invalid_params);
+  tcase_add_test(tc_merge, merge);
+  suite_add_tcase(s, tc_merge);
+
+  return s;
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_HISTOGRAM_H
+#define TEST_HISTOGRAM_H
+
+#include <check.h>
+
+Suite* LDSC_histogram_suite(void);
+
+#endif
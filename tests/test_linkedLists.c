@@ -2,6 +2,8 @@
 #include <time.h>
 
 #include "LDSC_linkedList.h"
+#include "LDSC_linkedListRef.h"
+#include "test_alloc.h"
 #include "test_linkedLists.h"
 #include <LDSC_errors.h>
 #include <check.h>
@@ -55,6 +57,52 @@ START_TEST(initialization) {
 
 /**************************************************/
 
+/* TEST CASE INIT WITH START */
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myLL);
+
+  myLL = LDSC_linkedList_init_with(NULL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myLL);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[] = {17, 9, 19};
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init_with(&allocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myLL);
+  ck_assert_int_eq(counter.allocs, 1);
+
+  for (int i = 0; i < 3; i++)
+    myLL->append(myLL, &testData[i], &status);
+  ck_assert_int_eq(counter.allocs, 4);
+
+  myLL->pop(myLL, &status);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE INIT WITH END */
+
+/**************************************************/
+
 /* TEST CASE LENGTH START */
 
 START_TEST(length_invalid_params) {
@@ -605,6 +653,920 @@ START_TEST(clear) {
 
 /**************************************************/
 
+/* TEST CASE POOL START */
+
+START_TEST(pool_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+
+  myLL->reserve(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->reserve(myLL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myLL->setPoolCap(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->setPoolCap(myLL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(pool) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData = 17;
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init_with(&allocator, &status);
+
+  myLL->reserve(myLL, 100, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, 101);
+
+  for (int i = 0; i < 100; i++)
+    myLL->append(myLL, &testData, &status);
+  ck_assert_int_eq(counter.allocs, 101);
+
+  for (int i = 0; i < 100; i++)
+    myLL->pop(myLL, &status);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myLL->setPoolCap(myLL, 0, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.frees, 100);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE POOL END */
+
+/**************************************************/
+
+/* TEST CASE FINGER START */
+
+START_TEST(finger) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+  int* shadow[MAX_DATA_SET_SIZE];
+  int length = 0;
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++)
+    testData[i] = i;
+
+  for (int round = 0; round < MAX_DATA_SET_SIZE * 20; round++) {
+    int index = rand() % (length + 1);
+    int op = rand() % 6;
+
+    if (op == 0 && length < MAX_DATA_SET_SIZE) {
+      int* dataPtr = &testData[rand() % MAX_DATA_SET_SIZE];
+      myLL->add(myLL, dataPtr, index, &status);
+      ck_assert_int_eq(status, OK);
+      for (int i = length; i > index; i--)
+        shadow[i] = shadow[i - 1];
+      shadow[index] = dataPtr;
+      length++;
+    } else if (op == 1 && index < length) {
+      ck_assert_ptr_eq(myLL->remove(myLL, index, &status), shadow[index]);
+      for (int i = index; i < length - 1; i++)
+        shadow[i] = shadow[i + 1];
+      length--;
+    } else if (op == 2 && index < length) {
+      int* dataPtr = &testData[rand() % MAX_DATA_SET_SIZE];
+      ck_assert_ptr_eq(myLL->replace(myLL, dataPtr, index, &status), shadow[index]);
+      shadow[index] = dataPtr;
+    } else if (op == 3 && length > 0) {
+      ck_assert_ptr_eq(myLL->pop(myLL, &status), shadow[0]);
+      for (int i = 0; i < length - 1; i++)
+        shadow[i] = shadow[i + 1];
+      length--;
+    } else if (op == 4 && length > 0) {
+      ck_assert_ptr_eq(myLL->pull(myLL, &status), shadow[length - 1]);
+      length--;
+    } else if (index < length) {
+      ck_assert_ptr_eq(myLL->at(myLL, index, &status), shadow[index]);
+    }
+
+    ck_assert_int_eq(myLL->length(myLL, &status), length);
+  }
+
+  for (int i = 0; i < length; i++)
+    ck_assert_ptr_eq(myLL->at(myLL, i, &status), shadow[i]);
+  for (int i = length - 1; i >= 0; i--)
+    ck_assert_ptr_eq(myLL->at(myLL, i, &status), shadow[i]);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE FINGER END */
+
+/**************************************************/
+
+/* TEST CASE ARENA START */
+
+START_TEST(arena_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init_arena(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myLL);
+
+  myLL = LDSC_linkedList_init_arena(&allocator, 0, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myLL);
+} END_TEST
+
+START_TEST(arena) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[MAX_DATA_SET_SIZE * 10];
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init_arena(&allocator, 64, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myLL);
+
+  int i = 0;
+  for (i = 0; i < MAX_DATA_SET_SIZE * 10; i++) {
+    testData[i] = rand() % MAX_INT_VALUE;
+    myLL->append(myLL, &testData[i], &status);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(counter.allocs, 1 + (MAX_DATA_SET_SIZE * 10 + 63) / 64);
+
+  for (i = 0; i < MAX_DATA_SET_SIZE * 10; i++)
+    ck_assert_int_eq(*(int*)myLL->at(myLL, i, &status), testData[i]);
+
+  int allocs = counter.allocs;
+  for (i = 0; i < MAX_DATA_SET_SIZE; i++)
+    myLL->pull(myLL, &status);
+  for (i = 0; i < MAX_DATA_SET_SIZE; i++)
+    myLL->prepend(myLL, &testData[i], &status);
+  ck_assert_int_eq(counter.allocs, allocs);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myLL->clear(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), 0);
+  ck_assert_int_eq(counter.frees, allocs - 1);
+
+  myLL->append(myLL, &testData[0], &status);
+  ck_assert_int_eq(*(int*)myLL->at(myLL, 0, &status), testData[0]);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE ARENA END */
+
+/**************************************************/
+
+/* TEST CASE CURSOR START */
+
+START_TEST(cursor_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  LDSC_linkedList* arenaLL = LDSC_linkedList_init_arena(NULL, 0, &status);
+  int testData = 17;
+
+  LDSC_listCursor cursor = myLL->begin(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  cursor = myLL->end(myLL, &status);
+  ck_assert_int_eq(status, OK);
+
+  myLL->next(myLL, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  int moved = myLL->next(myLL, &cursor, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_int_eq(moved, 0);
+
+  moved = myLL->prev(myLL, &cursor, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  ck_assert_int_eq(moved, 0);
+
+  void* dataPtr = myLL->get(myLL, &cursor, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_ptr_null(dataPtr);
+
+  myLL->insertAt(myLL, &cursor, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  dataPtr = myLL->removeAt(myLL, &cursor, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_ptr_null(dataPtr);
+
+  myLL->spliceAt(myLL, &cursor, myLL, &status);
+  ck_assert_int_eq(status, ERROR);
+
+  arenaLL->append(arenaLL, &testData, &status);
+  myLL->spliceAt(myLL, &cursor, arenaLL, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_int_eq(arenaLL->length(arenaLL, &status), 1);
+
+  myLL->forEach(myLL, NULL, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  arenaLL->delete(arenaLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(cursor) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++) {
+    testData[i] = rand() % MAX_INT_VALUE;
+    myLL->append(myLL, &testData[i], &status);
+  }
+
+  int i = 0;
+  LDSC_listCursor cursor = myLL->begin(myLL, &status);
+  for (void* dataPtr; (dataPtr = myLL->get(myLL, &cursor, &status)); myLL->next(myLL, &cursor, &status))
+    ck_assert_int_eq(*(int*)dataPtr, testData[i++]);
+  ck_assert_int_eq(i, MAX_DATA_SET_SIZE);
+
+  cursor = myLL->end(myLL, &status);
+  while (myLL->prev(myLL, &cursor, &status))
+    ck_assert_int_eq(*(int*)myLL->get(myLL, &cursor, &status), testData[--i]);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  ck_assert_int_eq(i, 0);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(cursor_edit) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[] = {0, 1, 2, 3, 4, 5};
+
+  LDSC_listCursor cursor = myLL->begin(myLL, &status);
+  myLL->insertAt(myLL, &cursor, &testData[5], &status);
+  ck_assert_int_eq(status, OK);
+
+  cursor = myLL->begin(myLL, &status);
+  myLL->insertAt(myLL, &cursor, &testData[0], &status);
+  myLL->insertAt(myLL, &cursor, &testData[1], &status);
+  ck_assert_int_eq(*(int*)myLL->get(myLL, &cursor, &status), 5);
+  ck_assert_int_eq(myLL->length(myLL, &status), 3);
+
+  cursor = myLL->begin(myLL, &status);
+  void* dataPtr = myLL->removeAt(myLL, &cursor, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, 0);
+  ck_assert_int_eq(*(int*)myLL->get(myLL, &cursor, &status), 1);
+
+  LDSC_linkedList* otherLL = LDSC_linkedList_init(&status);
+  for (int i = 2; i < 5; i++)
+    otherLL->append(otherLL, &testData[i], &status);
+
+  myLL->next(myLL, &cursor, &status);
+  myLL->spliceAt(myLL, &cursor, otherLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), 5);
+  ck_assert_int_eq(otherLL->empty(otherLL, &status), 1);
+
+  for (int i = 0; i < 5; i++)
+    ck_assert_int_eq(*(int*)myLL->at(myLL, i, &status), testData[i + 1]);
+  ck_assert_int_eq(*(int*)myLL->pull(myLL, &status), 5);
+
+  cursor = myLL->end(myLL, &status);
+  myLL->prev(myLL, &cursor, &status);
+  dataPtr = myLL->removeAt(myLL, &cursor, &status);
+  ck_assert_int_eq(*(int*)dataPtr, 4);
+  ck_assert_ptr_null(myLL->get(myLL, &cursor, &status));
+  ck_assert_int_eq(*(int*)myLL->pull(myLL, &status), 3);
+
+  otherLL->delete(otherLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* forEach callback summing items until it reaches a negative one */
+static int sumUntilNegative(void* dataPtr, void* ctx) {
+  if (*(int*)dataPtr < 0) return 1;
+  *(int*)ctx += *(int*)dataPtr;
+  return 0;
+}
+
+START_TEST(forEach) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[] = {17, 9, -1, 19};
+
+  for (int i = 0; i < 4; i++)
+    myLL->append(myLL, &testData[i], &status);
+
+  int sum = 0;
+  myLL->forEach(myLL, &sumUntilNegative, &sum, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(sum, 26);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CURSOR END */
+
+/**************************************************/
+
+/* TEST CASE SORT START */
+
+/* compare two int data pointers */
+static int compareInts(const void* a, const void* b) {
+  return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+}
+
+START_TEST(sort_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData = 17;
+
+  myLL->sort(NULL, &compareInts, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->sort(myLL, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->insertSorted(NULL, &testData, &compareInts, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->insertSorted(myLL, NULL, &compareInts, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->insertSorted(myLL, &testData, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(myLL->length(myLL, &status), 0);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(sort) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+
+  myLL->sort(myLL, &compareInts, &status);
+  ck_assert_int_eq(status, OK);
+
+  for (int size = 1; size <= MAX_DATA_SET_SIZE; size += 33) {
+    for (int i = 0; i < size; i++) {
+      testData[i] = rand() % 10;
+      myLL->append(myLL, &testData[i], &status);
+    }
+
+    myLL->sort(myLL, &compareInts, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(myLL->length(myLL, &status), size);
+
+    /* equal items keep their order, which here is ascending address */
+    int* prevPtr = myLL->at(myLL, 0, &status);
+    for (int i = 1; i < size; i++) {
+      int* dataPtr = myLL->at(myLL, i, &status);
+      ck_assert_int_le(*prevPtr, *dataPtr);
+      if (*prevPtr == *dataPtr)
+        ck_assert(prevPtr < dataPtr);
+      prevPtr = dataPtr;
+    }
+
+    LDSC_listCursor cursor = myLL->end(myLL, &status);
+    for (int i = size - 1; myLL->prev(myLL, &cursor, &status); i--)
+      ck_assert_ptr_eq(myLL->get(myLL, &cursor, &status), myLL->at(myLL, i, &status));
+    ck_assert_ptr_eq(myLL->pull(myLL, &status), prevPtr);
+
+    myLL->clear(myLL, &status);
+  }
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(insertSorted) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++) {
+    testData[i] = rand() % 10;
+    myLL->insertSorted(myLL, &testData[i], &compareInts, &status);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(myLL->length(myLL, &status), MAX_DATA_SET_SIZE);
+
+  int* prevPtr = myLL->pop(myLL, &status);
+  for (int i = 1; i < MAX_DATA_SET_SIZE; i++) {
+    int* dataPtr = myLL->pop(myLL, &status);
+    ck_assert_int_le(*prevPtr, *dataPtr);
+    if (*prevPtr == *dataPtr)
+      ck_assert(prevPtr < dataPtr);
+    prevPtr = dataPtr;
+  }
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE SORT END */
+
+/**************************************************/
+
+/* TEST CASE SPLICE START */
+
+START_TEST(splice_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  LDSC_linkedList* otherLL = LDSC_linkedList_init(&status);
+  LDSC_linkedList* arenaLL = LDSC_linkedList_init_arena(NULL, 0, &status);
+  int testData = 17;
+
+  otherLL->append(otherLL, &testData, &status);
+  arenaLL->append(arenaLL, &testData, &status);
+
+  myLL->concat(NULL, otherLL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->concat(myLL, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->concat(myLL, myLL, &status);
+  ck_assert_int_eq(status, ERROR);
+
+  myLL->concat(myLL, arenaLL, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+
+  myLL->splice(NULL, 0, otherLL, 0, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->splice(myLL, 0, NULL, 0, 1, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->splice(myLL, 0, myLL, 0, 0, &status);
+  ck_assert_int_eq(status, ERROR);
+
+  myLL->splice(myLL, 0, arenaLL, 0, 1, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+
+  myLL->splice(myLL, -1, otherLL, 0, 1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+
+  myLL->splice(myLL, 0, otherLL, -1, 1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+
+  myLL->splice(myLL, 0, otherLL, 1, 0, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+
+  myLL->splice(myLL, 1, otherLL, 0, 1, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  myLL->splice(myLL, 0, otherLL, 0, 2, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_int_eq(otherLL->length(otherLL, &status), 1);
+
+  LDSC_linkedList* splitLL = myLL->splitAt(NULL, 0, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(splitLL);
+
+  splitLL = arenaLL->splitAt(arenaLL, 0, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(splitLL);
+
+  splitLL = otherLL->splitAt(otherLL, -1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+  ck_assert_ptr_null(splitLL);
+
+  splitLL = otherLL->splitAt(otherLL, 2, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+  ck_assert_ptr_null(splitLL);
+
+  arenaLL->delete(arenaLL, &status);
+  ck_assert_int_eq(status, OK);
+  otherLL->delete(otherLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(concat) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  LDSC_linkedList* otherLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++) {
+    testData[i] = rand() % MAX_INT_VALUE;
+    if (i < MAX_DATA_SET_SIZE / 2) myLL->append(myLL, &testData[i], &status);
+    else otherLL->append(otherLL, &testData[i], &status);
+  }
+
+  myLL->concat(myLL, otherLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), MAX_DATA_SET_SIZE);
+  ck_assert_int_eq(otherLL->empty(otherLL, &status), 1);
+
+  myLL->concat(myLL, otherLL, &status);
+  ck_assert_int_eq(status, OK);
+
+  otherLL->concat(otherLL, myLL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->empty(myLL, &status), 1);
+
+  for (int i = MAX_DATA_SET_SIZE - 1; i >= 0; i--)
+    ck_assert_ptr_eq(otherLL->pull(otherLL, &status), &testData[i]);
+  ck_assert_int_eq(otherLL->empty(otherLL, &status), 1);
+
+  otherLL->delete(otherLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(splice) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  LDSC_linkedList* otherLL = LDSC_linkedList_init(&status);
+  int testData[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  myLL->append(myLL, &testData[0], &status);
+  myLL->append(myLL, &testData[1], &status);
+  for (int i = 2; i < 10; i++)
+    otherLL->append(otherLL, &testData[i], &status);
+
+  /* 0 1 | 2 3 4 5 6 7 8 9 -> 0 5 6 1 | 2 3 4 7 8 9 */
+  myLL->splice(myLL, 1, otherLL, 3, 5, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), 4);
+  ck_assert_int_eq(otherLL->length(otherLL, &status), 6);
+
+  /* -> 0 5 6 1 2 3 | 4 7 8 9 */
+  myLL->splice(myLL, 4, otherLL, 0, 2, &status);
+  ck_assert_int_eq(status, OK);
+
+  /* -> 0 5 6 1 2 3 8 9 | 4 7 */
+  myLL->splice(myLL, 6, otherLL, 2, 4, &status);
+  ck_assert_int_eq(status, OK);
+
+  /* -> 4 0 5 6 1 2 3 8 9 | 7 */
+  myLL->splice(myLL, 0, otherLL, 0, 1, &status);
+  ck_assert_int_eq(status, OK);
+
+  myLL->splice(myLL, 0, otherLL, 1, 1, &status);
+  ck_assert_int_eq(status, OK);
+
+  int expected[] = {4, 0, 5, 6, 1, 2, 3, 8, 9};
+  ck_assert_int_eq(myLL->length(myLL, &status), 9);
+  for (int i = 0; i < 9; i++)
+    ck_assert_int_eq(*(int*)myLL->at(myLL, i, &status), expected[i]);
+
+  LDSC_listCursor cursor = myLL->end(myLL, &status);
+  for (int i = 8; myLL->prev(myLL, &cursor, &status); i--)
+    ck_assert_int_eq(*(int*)myLL->get(myLL, &cursor, &status), expected[i]);
+
+  ck_assert_int_eq(otherLL->length(otherLL, &status), 1);
+  ck_assert_int_eq(*(int*)otherLL->pop(otherLL, &status), 7);
+  ck_assert_int_eq(otherLL->empty(otherLL, &status), 1);
+
+  otherLL->delete(otherLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(splitAt) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++) {
+    testData[i] = rand() % MAX_INT_VALUE;
+    myLL->append(myLL, &testData[i], &status);
+  }
+
+  int index = rand() % MAX_DATA_SET_SIZE;
+  LDSC_linkedList* splitLL = myLL->splitAt(myLL, index, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), index);
+  ck_assert_int_eq(splitLL->length(splitLL, &status), MAX_DATA_SET_SIZE - index);
+
+  for (int i = 0; i < index; i++)
+    ck_assert_ptr_eq(myLL->at(myLL, i, &status), &testData[i]);
+  for (int i = index; i < MAX_DATA_SET_SIZE; i++)
+    ck_assert_ptr_eq(splitLL->at(splitLL, i - index, &status), &testData[i]);
+
+  LDSC_linkedList* emptyLL = myLL->splitAt(myLL, index, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(emptyLL->empty(emptyLL, &status), 1);
+  emptyLL->delete(emptyLL, &status);
+
+  LDSC_linkedList* wholeLL = splitLL->splitAt(splitLL, 0, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(splitLL->empty(splitLL, &status), 1);
+  ck_assert_int_eq(wholeLL->length(wholeLL, &status), MAX_DATA_SET_SIZE - index);
+
+  myLL->concat(myLL, wholeLL, &status);
+  for (int i = MAX_DATA_SET_SIZE - 1; i >= 0; i--)
+    ck_assert_ptr_eq(myLL->pull(myLL, &status), &testData[i]);
+
+  wholeLL->delete(wholeLL, &status);
+  ck_assert_int_eq(status, OK);
+  splitLL->delete(splitLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE SPLICE END */
+
+/**************************************************/
+
+/* TEST CASE BULK START */
+
+START_TEST(bulk_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData = 17;
+  void* items[] = {&testData, NULL, &testData};
+
+  myLL->appendMany(NULL, items, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->appendMany(myLL, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->appendMany(myLL, items, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myLL->appendMany(myLL, items, 3, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(myLL->length(myLL, &status), 0);
+
+  myLL->popMany(NULL, items, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->popMany(myLL, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->popMany(myLL, items, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(bulk) {
+  LDSC_error status = OK;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  int testData[MAX_DATA_SET_SIZE];
+  void* items[MAX_DATA_SET_SIZE];
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++) {
+    testData[i] = rand() % MAX_INT_VALUE;
+    items[i] = &testData[i];
+  }
+
+  myLL->append(myLL, items[0], &status);
+  myLL->appendMany(myLL, &items[1], MAX_DATA_SET_SIZE / 2 - 1, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->appendMany(myLL, &items[MAX_DATA_SET_SIZE / 2], MAX_DATA_SET_SIZE / 2, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myLL->length(myLL, &status), MAX_DATA_SET_SIZE);
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++)
+    ck_assert_ptr_eq(myLL->at(myLL, i, &status), items[i]);
+  ck_assert_ptr_eq(myLL->pull(myLL, &status), items[MAX_DATA_SET_SIZE - 1]);
+
+  void* out[MAX_DATA_SET_SIZE];
+  int total = myLL->popMany(myLL, out, 10, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(total, 10);
+  ck_assert_ptr_eq(myLL->at(myLL, 0, &status), items[10]);
+
+  total += myLL->popMany(myLL, &out[total], MAX_DATA_SET_SIZE, &status);
+  ck_assert_int_eq(total, MAX_DATA_SET_SIZE - 1);
+  ck_assert_int_eq(myLL->empty(myLL, &status), 1);
+  for (int i = 0; i < total; i++)
+    ck_assert_ptr_eq(out[i], items[i]);
+
+  myLL->appendMany(myLL, items, 2, &status);
+  ck_assert_ptr_eq(myLL->pull(myLL, &status), items[1]);
+  ck_assert_ptr_eq(myLL->pull(myLL, &status), items[0]);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE BULK END */
+
+/**************************************************/
+
+/* TEST CASE STATS START */
+
+START_TEST(stats_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+
+  myLL->stats(NULL, &stats, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->stats(myLL, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myLL->resetStats(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(stats) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  int testData[10];
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init(&status);
+  myLL->setPoolCap(myLL, 0, &status);
+  for (int i = 0; i < 10; i++)
+    myLL->append(myLL, &testData[i], &status);
+  ck_assert_ptr_eq(myLL->at(myLL, 3, &status), &testData[3]);
+  ck_assert_ptr_eq(myLL->at(myLL, 5, &status), &testData[5]);
+  myLL->pop(myLL, &status);
+  myLL->pull(myLL, &status);
+
+  myLL->stats(myLL, &stats, &status);
+  ck_assert_int_eq(status, OK);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.inserts, 10);
+  ck_assert_int_eq(stats.removals, 2);
+  ck_assert_int_eq(stats.lookups, 2);
+  ck_assert_int_eq(stats.nodeAllocs, 10);
+  ck_assert_int_eq(stats.nodeFrees, 2);
+  ck_assert_int_eq(stats.nodesTraversed, 3 + 2);
+  ck_assert_int_eq(stats.highWater, 10);
+#else
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.nodesTraversed, 0);
+  ck_assert_int_eq(stats.highWater, 0);
+#endif
+
+  myLL->resetStats(myLL, &status);
+  ck_assert_int_eq(status, OK);
+  myLL->stats(myLL, &stats, &status);
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.nodesTraversed, 0);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.highWater, 8);
+#endif
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+
+  /* a failed node allocation is not counted */
+  int remaining = 3;
+  LDSC_allocator allocator = { &limited_alloc, &limited_free, &remaining };
+  myLL = LDSC_linkedList_init_with(&allocator, &status);
+  for (int i = 0; i < 3; i++)
+    myLL->append(myLL, &testData[i], &status);
+  ck_assert_int_eq(status, NODE_MALLOC);
+
+  myLL->stats(myLL, &stats, &status);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.nodeAllocs, 2);
+  ck_assert_int_eq(stats.inserts, 2);
+#else
+  ck_assert_int_eq(stats.nodeAllocs, 0);
+#endif
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE STATS END */
+
+/**************************************************/
+
+/* TEST CASE REF START */
+
+START_TEST(ref_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+  int testData = 17;
+
+  LDSC_linkedListRef* myRef = LDSC_linkedListRef_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myRef);
+  myRef = LDSC_linkedListRef_init_arena(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myRef);
+
+  ck_assert_ptr_null(LDSC_linkedListRef_splitAt(NULL, 0, &status));
+  ck_assert_int_eq(status, NULL_SELF);
+  LDSC_linkedListRef_delete(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myRef = LDSC_linkedListRef_init(&status);
+  ck_assert_int_eq(status, OK);
+  myRef->ops->append(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  myRef->ops->append(myRef->pd, &testData, &status);
+  myRef->ops->concat(myRef->pd, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  myRef->ops->concat(myRef->pd, myRef->pd, &status);
+  ck_assert_int_eq(status, ERROR);
+  ck_assert_int_eq(myRef->ops->length(myRef->pd, &status), 1);
+  ck_assert_ptr_null(LDSC_linkedListRef_splitAt(myRef, 2, &status));
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  LDSC_linkedListRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(ref) {
+  LDSC_error status = OK;
+  AllocCounter listCounter = { 0, 0, 0 };
+  AllocCounter refCounter = { 0, 0, 0 };
+  LDSC_allocator listAllocator = { &counting_alloc, &counting_free, &listCounter };
+  LDSC_allocator refAllocator = { &counting_alloc, &counting_free, &refCounter };
+  int testData[] = {17, 9, 19, 4};
+
+  LDSC_linkedList* myLL = LDSC_linkedList_init_with(&listAllocator, &status);
+  LDSC_linkedListRef* myRef = LDSC_linkedListRef_init_with(&refAllocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myRef);
+  ck_assert_int_eq(refCounter.allocs, 1);
+  ck_assert_int_eq(sizeof(LDSC_linkedListRef), 2 * sizeof(void*));
+  ck_assert_int_eq(listCounter.bytes - refCounter.bytes, sizeof(LDSC_linkedList) - sizeof(LDSC_linkedListRef));
+
+  ck_assert_int_eq(myRef->ops->empty(myRef->pd, &status), 1);
+  myRef->ops->append(myRef->pd, &testData[1], &status);
+  myRef->ops->prepend(myRef->pd, &testData[0], &status);
+  myRef->ops->add(myRef->pd, &testData[2], 2, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myRef->ops->length(myRef->pd, &status), 3);
+  for (int i = 0; i < 3; i++)
+    ck_assert_ptr_eq(myRef->ops->at(myRef->pd, i, &status), &testData[i]);
+
+  LDSC_listCursor cursor = myRef->ops->begin(myRef->pd, &status);
+  myRef->ops->next(myRef->pd, &cursor, &status);
+  ck_assert_ptr_eq(myRef->ops->get(myRef->pd, &cursor, &status), &testData[1]);
+
+  LDSC_linkedListRef* tailRef = LDSC_linkedListRef_splitAt(myRef, 1, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(tailRef);
+  ck_assert_int_eq(myRef->ops->length(myRef->pd, &status), 1);
+  ck_assert_int_eq(tailRef->ops->length(tailRef->pd, &status), 2);
+  ck_assert_ptr_eq(tailRef->ops->at(tailRef->pd, 0, &status), &testData[1]);
+
+  tailRef->ops->append(tailRef->pd, &testData[3], &status);
+  myRef->ops->concat(myRef->pd, tailRef->pd, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(tailRef->ops->length(tailRef->pd, &status), 0);
+  ck_assert_int_eq(myRef->ops->length(myRef->pd, &status), 4);
+  ck_assert_ptr_eq(myRef->ops->pull(myRef->pd, &status), &testData[3]);
+  ck_assert_ptr_eq(myRef->ops->pop(myRef->pd, &status), &testData[0]);
+
+  LDSC_linkedListRef_delete(tailRef, &status);
+  ck_assert_int_eq(status, OK);
+  LDSC_linkedListRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(refCounter.allocs, refCounter.frees);
+  ck_assert_int_eq(refCounter.bytes, 0);
+
+  myRef = LDSC_linkedListRef_init_arena(&refAllocator, 4, &status);
+  ck_assert_int_eq(status, OK);
+  for (int i = 0; i < 4; i++)
+    myRef->ops->append(myRef->pd, &testData[i], &status);
+  ck_assert_ptr_null(LDSC_linkedListRef_splitAt(myRef, 1, &status));
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  LDSC_linkedListRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(refCounter.bytes, 0);
+
+  myLL->delete(myLL, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE REF END */
+
+/**************************************************/
+
 /* SUITE DEFINITION */
 
 Suite* LDSC_linkedList_suite() {
@@ -617,6 +1579,11 @@ Suite* LDSC_linkedList_suite() {
   tcase_add_test(tc_core, initialization);
   suite_add_tcase(s, tc_core);
 
+  TCase* tc_init_with = tcase_create("init_with");
+  tcase_add_test(tc_init_with, init_with_invalid_params);
+  tcase_add_test(tc_init_with, init_with);
+  suite_add_tcase(s, tc_init_with);
+
   TCase* tc_length = tcase_create("length");
   tcase_add_test(tc_length, length_invalid_params);
   tcase_add_test(tc_length, length);
@@ -672,6 +1639,55 @@ Suite* LDSC_linkedList_suite() {
   tcase_add_test(tc_clear, clear);
   suite_add_tcase(s, tc_clear );
 
+  TCase* tc_pool = tcase_create("pool");
+  tcase_add_test(tc_pool, pool_invalid_params);
+  tcase_add_test(tc_pool, pool);
+  suite_add_tcase(s, tc_pool);
+
+  TCase* tc_finger = tcase_create("finger");
+  tcase_add_test(tc_finger, finger);
+  suite_add_tcase(s, tc_finger);
+
+  TCase* tc_arena = tcase_create("arena");
+  tcase_add_test(tc_arena, arena_invalid_params);
+  tcase_add_test(tc_arena, arena);
+  suite_add_tcase(s, tc_arena);
+
+  TCase* tc_cursor = tcase_create("cursor");
+  tcase_add_test(tc_cursor, cursor_invalid_params);
+  tcase_add_test(tc_cursor, cursor);
+  tcase_add_test(tc_cursor, cursor_edit);
+  tcase_add_test(tc_cursor, forEach);
+  suite_add_tcase(s, tc_cursor);
+
+  TCase* tc_sort = tcase_create("sort");
+  tcase_add_test(tc_sort, sort_invalid_params);
+  tcase_add_test(tc_sort, sort);
+  tcase_add_test(tc_sort, insertSorted);
+  suite_add_tcase(s, tc_sort);
+
+  TCase* tc_splice = tcase_create("splice");
+  tcase_add_test(tc_splice, splice_invalid_params);
+  tcase_add_test(tc_splice, concat);
+  tcase_add_test(tc_splice, splice);
+  tcase_add_test(tc_splice, splitAt);
+  suite_add_tcase(s, tc_splice);
+
+  TCase* tc_bulk = tcase_create("bulk");
+  tcase_add_test(tc_bulk, bulk_invalid_params);
+  tcase_add_test(tc_bulk, bulk);
+  suite_add_tcase(s, tc_bulk);
+
+  TCase* tc_stats = tcase_create("stats");
+  tcase_add_test(tc_stats, stats_invalid_params);
+  tcase_add_test(tc_stats, stats);
+  suite_add_tcase(s, tc_stats);
+
+  TCase* tc_ref = tcase_create("ref");
+  tcase_add_test(tc_ref, ref_invalid_params);
+  tcase_add_test(tc_ref, ref);
+  suite_add_tcase(s, tc_ref);
+
   return s;
 }
 
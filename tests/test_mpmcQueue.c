@@ -0,0 +1,263 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "LDSC_errors.h"
+#include "LDSC_mpmcQueue.h"
+#include "test_mpmcQueue.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_mpmcQueue data structure.
+ * Only the 'initialization' test will check for possible malloc errors.
+ * All following tests will assume successful mallocs.
+ * All tests will test for successful LDSC_mpmcQueue delete.
+ * All status checks will occur before value checks, if applicable.
+ * Beyond that, status checks will only occur the methods that the test targets
+ */
+
+/**************************************************/
+
+enum Test_constants {
+  QUEUE_CAPACITY = 8,
+  THREAD_COUNT = 4,
+  ITEMS_PER_PRODUCER = 20000
+};
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(initialization) {
+  LDSC_error status = OK;
+
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myQueue);
+  ck_assert_ptr_nonnull(myQueue->pd);
+
+  int empty = myQueue->empty(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(empty, 1);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(-1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myQueue);
+
+  myQueue = LDSC_mpmcQueue_init_with(&allocator, QUEUE_CAPACITY, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myQueue);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE ENQUEUE START */
+
+START_TEST(tryEnqueue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, &status);
+  int testData = 17;
+
+  myQueue->tryEnqueue(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->tryEnqueue(myQueue, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  int length = myQueue->length(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(length, ERROR);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(tryEnqueue) {
+  LDSC_error status = OK;
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, &status);
+  int testData[QUEUE_CAPACITY];
+
+  for (int i = 0; i < QUEUE_CAPACITY; i++) {
+    testData[i] = i;
+    myQueue->tryEnqueue(myQueue, &testData[i], &status);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(myQueue->length(myQueue, &status), QUEUE_CAPACITY);
+
+  myQueue->tryEnqueue(myQueue, &testData[0], &status);
+  ck_assert_int_eq(status, STRUCTURE_FULL);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE ENQUEUE END */
+
+/**************************************************/
+
+/* TEST CASE DEQUEUE START */
+
+START_TEST(tryDequeue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, &status);
+
+  void* dataPtr = myQueue->tryDequeue(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(tryDequeue) {
+  LDSC_error status = OK;
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, &status);
+  int testData[QUEUE_CAPACITY];
+
+  void* dataPtr = myQueue->tryDequeue(myQueue, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  ck_assert_ptr_null(dataPtr);
+
+  /* wrap around the buffer several times */
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < QUEUE_CAPACITY; i++) {
+      testData[i] = round * QUEUE_CAPACITY + i;
+      myQueue->tryEnqueue(myQueue, &testData[i], &status);
+    }
+
+    for (int i = 0; i < QUEUE_CAPACITY; i++) {
+      dataPtr = myQueue->tryDequeue(myQueue, &status);
+      ck_assert_int_eq(status, OK);
+      ck_assert_int_eq(*(int*)dataPtr, testData[i]);
+    }
+  }
+
+  dataPtr = myQueue->tryDequeue(myQueue, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE DEQUEUE END */
+
+/**************************************************/
+
+/* TEST CASE CONCURRENT START */
+
+typedef struct ProducerArgs {
+  LDSC_mpmcQueue* queue;
+  int offset;
+} ProducerArgs;
+
+static int transferData[THREAD_COUNT * ITEMS_PER_PRODUCER];
+static atomic_long consumedSum;
+static atomic_int consumedCount;
+
+static void* producer(void* arg) {
+  ProducerArgs* args = (ProducerArgs*)arg;
+  LDSC_mpmcQueue* myQueue = args->queue;
+  LDSC_error status = OK;
+
+  int i = 0;
+  while (i < ITEMS_PER_PRODUCER) {
+    myQueue->tryEnqueue(myQueue, &transferData[args->offset + i], &status);
+    if (status == OK) i++;
+    else sched_yield();
+  }
+  return NULL;
+}
+
+static void* consumer(void* arg) {
+  LDSC_mpmcQueue* myQueue = (LDSC_mpmcQueue*)arg;
+  LDSC_error status = OK;
+
+  while (atomic_load(&consumedCount) < THREAD_COUNT * ITEMS_PER_PRODUCER) {
+    void* dataPtr = myQueue->tryDequeue(myQueue, &status);
+    if (status != OK) {
+      sched_yield();
+      continue;
+    }
+    atomic_fetch_add(&consumedSum, *(int*)dataPtr);
+    atomic_fetch_add(&consumedCount, 1);
+  }
+  return NULL;
+}
+
+START_TEST(concurrent) {
+  LDSC_error status = OK;
+  LDSC_mpmcQueue* myQueue = LDSC_mpmcQueue_init(QUEUE_CAPACITY, &status);
+  pthread_t producers[THREAD_COUNT];
+  pthread_t consumers[THREAD_COUNT];
+  ProducerArgs producerArgs[THREAD_COUNT];
+
+  long expectedSum = 0;
+  for (int i = 0; i < THREAD_COUNT * ITEMS_PER_PRODUCER; i++) {
+    transferData[i] = i;
+    expectedSum += i;
+  }
+  atomic_store(&consumedSum, 0);
+  atomic_store(&consumedCount, 0);
+
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    producerArgs[i].queue = myQueue;
+    producerArgs[i].offset = i * ITEMS_PER_PRODUCER;
+    pthread_create(&producers[i], NULL, &producer, &producerArgs[i]);
+    pthread_create(&consumers[i], NULL, &consumer, myQueue);
+  }
+
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    pthread_join(producers[i], NULL);
+    pthread_join(consumers[i], NULL);
+  }
+
+  ck_assert_int_eq(atomic_load(&consumedCount), THREAD_COUNT * ITEMS_PER_PRODUCER);
+  ck_assert_int_eq(atomic_load(&consumedSum), expectedSum);
+  ck_assert_int_eq(myQueue->empty(myQueue, &status), 1);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CONCURRENT END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_mpmcQueue_suite() {
+  Suite *s;
+  s = suite_create("LDSC_mpmcQueue");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, initialization);
+  tcase_add_test(tc_core, init_with_invalid_params);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_enqueue = tcase_create("tryEnqueue");
+  tcase_add_test(tc_enqueue, tryEnqueue_invalid_params);
+  tcase_add_test(tc_enqueue, tryEnqueue);
+  suite_add_tcase(s, tc_enqueue);
+
+  TCase* tc_dequeue = tcase_create("tryDequeue");
+  tcase_add_test(tc_dequeue, tryDequeue_invalid_params);
+  tcase_add_test(tc_dequeue, tryDequeue);
+  suite_add_tcase(s, tc_dequeue);
+
+  TCase* tc_concurrent = tcase_create("concurrent");
+  tcase_add_test(tc_concurrent, concurrent);
+  suite_add_tcase(s, tc_concurrent);
+
+  return s;
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_MPMCQUEUE_H
+#define TEST_MPMCQUEUE_H
+
+#include <check.h>
+
+Suite* LDSC_mpmcQueue_suite(void);
+
+#endif
@@ -0,0 +1,315 @@
+#include <stdlib.h>
+
+#include "LDSC_priorityQueue.h"
+#include "test_priorityQueue.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_priorityQueue data structure.
+ * Ordering tests run for the binary heap and for wider arities, since the
+ * child index arithmetic differs.
+ * All tests will test for successful LDSC_priorityQueue delete.
+ * All status checks will occur before value checks, if applicable.
+ */
+
+enum PriorityQueue_constants {
+  PQ_ITEMS = 1000,
+  PQ_MAX_VALUE = 500
+};
+
+static const int arities[] = { 2, 3, 4, 8, LDSC_PRIORITYQUEUE_MAX_ARITY };
+
+static int int_cmp(const void* a, const void* b) {
+  int x = *(const int*)a;
+  int y = *(const int*)b;
+  return (x > y) - (x < y);
+}
+
+/** pop every item and check that they leave in non-decreasing order */
+static void assert_pops_sorted(LDSC_priorityQueue* myPQ, int expected) {
+  LDSC_error status = OK;
+  int previous = -1;
+  for (int i = 0; i < expected; i++) {
+    int* item = myPQ->pop(myPQ, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_ptr_nonnull(item);
+    ck_assert_int_ge(*item, previous);
+    previous = *item;
+  }
+  ck_assert_int_eq(myPQ->empty(myPQ, &status), 1);
+  ck_assert_ptr_null(myPQ->pop(myPQ, &status));
+  ck_assert_int_eq(status, OK);
+}
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init(NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_ptr_null(myPQ);
+
+  myPQ = LDSC_priorityQueue_init_with(NULL, 1, &int_cmp, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myPQ);
+
+  myPQ = LDSC_priorityQueue_init_with(NULL, LDSC_PRIORITYQUEUE_MAX_ARITY + 1, &int_cmp, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myPQ);
+
+  myPQ = LDSC_priorityQueue_init_with(&allocator, 0, &int_cmp, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myPQ);
+} END_TEST
+
+START_TEST(invalid_params) {
+  LDSC_error status = OK;
+  LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init(&int_cmp, &status);
+  ck_assert_int_eq(status, OK);
+  int testData = 17;
+
+  ck_assert_int_eq(myPQ->length(NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(myPQ->empty(NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  ck_assert_int_eq(myPQ->push(NULL, &testData, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(myPQ->push(myPQ, NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myPQ->pop(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  myPQ->peek(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  myPQ->delete(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  ck_assert_ptr_null(myPQ->peek(myPQ, &status));
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myPQ->length(myPQ, &status), 0);
+
+  myPQ->delete(myPQ, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE PUSH POP START */
+
+START_TEST(push_pop) {
+  LDSC_error status = OK;
+  int testData[PQ_ITEMS];
+
+  for (int a = 0; a < (int)(sizeof(arities) / sizeof(arities[0])); a++) {
+    LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init_with(NULL, arities[a], &int_cmp, &status);
+    ck_assert_int_eq(status, OK);
+
+    int smallest = PQ_MAX_VALUE;
+    for (int i = 0; i < PQ_ITEMS; i++) {
+      testData[i] = rand() % PQ_MAX_VALUE;
+      if (testData[i] < smallest) smallest = testData[i];
+      myPQ->push(myPQ, &testData[i], &status);
+      ck_assert_int_eq(status, OK);
+    }
+
+    ck_assert_int_eq(myPQ->length(myPQ, &status), PQ_ITEMS);
+    ck_assert_int_eq(*(int*)myPQ->peek(myPQ, &status), smallest);
+    assert_pops_sorted(myPQ, PQ_ITEMS);
+
+    myPQ->delete(myPQ, &status);
+    ck_assert_int_eq(status, OK);
+  }
+} END_TEST
+
+START_TEST(push_pop_interleaved) {
+  LDSC_error status = OK;
+  LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init(&int_cmp, &status);
+  int testData[PQ_ITEMS];
+
+  int length = 0;
+  int previous = -1;
+  for (int i = 0; i < PQ_ITEMS; i++) {
+    testData[i] = previous + 1 + rand() % PQ_MAX_VALUE;
+    myPQ->push(myPQ, &testData[i], &status);
+    length++;
+    if (i % 3 == 2) {
+      int* item = myPQ->pop(myPQ, &status);
+      ck_assert_int_ge(*item, previous);
+      previous = *item;
+      length--;
+    }
+  }
+
+  ck_assert_int_eq(myPQ->length(myPQ, &status), length);
+  assert_pops_sorted(myPQ, length);
+
+  myPQ->delete(myPQ, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE PUSH POP END */
+
+/**************************************************/
+
+/* TEST CASE HEAPIFY START */
+
+START_TEST(heapify_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init(&int_cmp, &status);
+  int testData = 17;
+  void* items[2] = { &testData, NULL };
+
+  myPQ->heapify(NULL, items, 1, NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myPQ->heapify(myPQ, NULL, 1, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myPQ->heapify(myPQ, items, -1, NULL, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myPQ->heapify(myPQ, items, 2, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(myPQ->length(myPQ, &status), 0);
+
+  myPQ->delete(myPQ, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(heapify) {
+  LDSC_error status = OK;
+  int testData[PQ_ITEMS];
+  void* items[PQ_ITEMS];
+  int handles[PQ_ITEMS];
+
+  for (int a = 0; a < (int)(sizeof(arities) / sizeof(arities[0])); a++) {
+    LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init_with(NULL, arities[a], &int_cmp, &status);
+    for (int i = 0; i < PQ_ITEMS; i++) {
+      testData[i] = rand() % PQ_MAX_VALUE;
+      items[i] = &testData[i];
+    }
+
+    myPQ->push(myPQ, &testData[0], &status);
+    myPQ->heapify(myPQ, &items[1], PQ_ITEMS - 1, handles, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(myPQ->length(myPQ, &status), PQ_ITEMS);
+
+    for (int i = 0; i < PQ_ITEMS - 1; i++)
+      for (int j = 0; j < i; j++)
+        ck_assert_int_ne(handles[i], handles[j]);
+
+    assert_pops_sorted(myPQ, PQ_ITEMS);
+
+    myPQ->heapify(myPQ, items, 1, NULL, &status);
+    ck_assert_ptr_eq(myPQ->pop(myPQ, &status), items[0]);
+    myPQ->heapify(myPQ, items, 0, NULL, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(myPQ->empty(myPQ, &status), 1);
+
+    myPQ->delete(myPQ, &status);
+    ck_assert_int_eq(status, OK);
+  }
+} END_TEST
+
+/* TEST CASE HEAPIFY END */
+
+/**************************************************/
+
+/* TEST CASE DECREASE KEY START */
+
+START_TEST(decreaseKey_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init(&int_cmp, &status);
+  int testData = 17;
+
+  int handle = myPQ->push(myPQ, &testData, &status);
+
+  myPQ->decreaseKey(NULL, handle, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myPQ->decreaseKey(myPQ, handle, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myPQ->decreaseKey(myPQ, -1, &testData, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+
+  myPQ->decreaseKey(myPQ, 1 << 20, &testData, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  myPQ->pop(myPQ, &status);
+  myPQ->decreaseKey(myPQ, handle, &testData, &status);
+  ck_assert_int_eq(status, ERROR);
+
+  myPQ->delete(myPQ, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(decreaseKey) {
+  LDSC_error status = OK;
+  int testData[PQ_ITEMS];
+  int handles[PQ_ITEMS];
+
+  for (int a = 0; a < (int)(sizeof(arities) / sizeof(arities[0])); a++) {
+    LDSC_priorityQueue* myPQ = LDSC_priorityQueue_init_with(NULL, arities[a], &int_cmp, &status);
+    for (int i = 0; i < PQ_ITEMS; i++) {
+      testData[i] = PQ_MAX_VALUE + rand() % PQ_MAX_VALUE;
+      handles[i] = myPQ->push(myPQ, &testData[i], &status);
+    }
+
+    testData[PQ_ITEMS / 2] = 0;
+    myPQ->decreaseKey(myPQ, handles[PQ_ITEMS / 2], &testData[PQ_ITEMS / 2], &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_ptr_eq(myPQ->peek(myPQ, &status), &testData[PQ_ITEMS / 2]);
+
+    for (int i = 0; i < PQ_ITEMS; i += 7) {
+      testData[i] = rand() % (2 * PQ_MAX_VALUE);
+      myPQ->decreaseKey(myPQ, handles[i], &testData[i], &status);
+      ck_assert_int_eq(status, OK);
+    }
+
+    assert_pops_sorted(myPQ, PQ_ITEMS);
+
+    myPQ->delete(myPQ, &status);
+    ck_assert_int_eq(status, OK);
+  }
+} END_TEST
+
+/* TEST CASE DECREASE KEY END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_priorityQueue_suite() {
+  Suite *s;
+  s = suite_create("LDSC_priorityQueue");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, init_with_invalid_params);
+  tcase_add_test(tc_core, invalid_params);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_push_pop = tcase_create("push_pop");
+  tcase_add_test(tc_push_pop, push_pop);
+  tcase_add_test(tc_push_pop, push_pop_interleaved);
+  suite_add_tcase(s, tc_push_pop);
+
+  TCase* tc_heapify = tcase_create("heapify");
+  tcase_add_test(tc_heapify, heapify_invalid_params);
+  tcase_add_test(tc_heapify, heapify);
+  suite_add_tcase(s, tc_heapify);
+
+  TCase* tc_decreaseKey = tcase_create("decreaseKey");
+  tcase_add_test(tc_decreaseKey, decreaseKey_invalid_params);
+  tcase_add_test(tc_decreaseKey, decreaseKey);
+  suite_add_tcase(s, tc_decreaseKey);
+
+  return s;
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_PRIORITYQUEUE_H
+#define TEST_PRIORITYQUEUE_H
+
+#include <check.h>
+
+Suite* LDSC_priorityQueue_suite(void);
+
+#endif
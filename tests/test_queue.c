@@ -2,6 +2,9 @@
 
 #include "LDSC_errors.h"
 #include "LDSC_queue.h"
+#include "LDSC_queueFast.h"
+#include "LDSC_queueRef.h"
+#include "test_alloc.h"
 #include "test_queue.h"
 #include <check.h>
 
@@ -43,6 +46,52 @@ START_TEST(initialization) {
 
 /**************************************************/
 
+/* TEST CASE INIT WITH START */
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myQueue);
+
+  myQueue = LDSC_queue_init_with(NULL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myQueue);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[] = {17, 9, 19};
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&allocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myQueue);
+  ck_assert_int_eq(counter.allocs, 1);
+
+  for (int i = 0; i < 3; i++)
+    myQueue->enqueue(myQueue, &testData[i], &status);
+  ck_assert_int_eq(counter.allocs, 4);
+
+  myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE INIT WITH END */
+
+/**************************************************/
+
 /* TEST CASE EMPTY START */
 
 START_TEST(empty_invalid_params) {
@@ -230,6 +279,513 @@ START_TEST(peek) {
 
 /**************************************************/
 
+/* TEST CASE POOL START */
+
+START_TEST(pool_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+
+  myQueue->reserve(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->reserve(myQueue, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myQueue->setPoolCap(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->setPoolCap(myQueue, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(pool) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData = 17;
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&allocator, &status);
+
+  myQueue->reserve(myQueue, 100, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, 101);
+
+  for (int i = 0; i < 100; i++)
+    myQueue->enqueue(myQueue, &testData, &status);
+  ck_assert_int_eq(counter.allocs, 101);
+
+  for (int i = 0; i < 100; i++)
+    myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myQueue->setPoolCap(myQueue, 0, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.frees, 100);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE POOL END */
+
+/**************************************************/
+
+/* TEST CASE BULK START */
+
+START_TEST(bulk_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+  int testData = 17;
+  void* items[] = {&testData, NULL, &testData};
+
+  myQueue->enqueueMany(NULL, items, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->enqueueMany(myQueue, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myQueue->enqueueMany(myQueue, items, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myQueue->enqueueMany(myQueue, items, 3, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), 0);
+
+  myQueue->dequeueMany(NULL, items, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->dequeueMany(myQueue, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myQueue->dequeueMany(myQueue, items, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(bulk) {
+  LDSC_error status = OK;
+  int remaining = 2 + 5;
+  LDSC_allocator allocator = { &limited_alloc, &limited_free, &remaining };
+  int testData[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  void* items[10];
+  for (int i = 0; i < 10; i++)
+    items[i] = &testData[i];
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&allocator, &status);
+  myQueue->setPoolCap(myQueue, 0, &status);
+
+  myQueue->enqueueMany(myQueue, items, 10, &status);
+  ck_assert_int_eq(status, NODE_MALLOC);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), 0);
+  ck_assert_ptr_null(myQueue->peek(myQueue, &status));
+
+  remaining = 12;
+  myQueue->enqueueMany(myQueue, items, 0, &status);
+  ck_assert_int_eq(status, OK);
+  myQueue->enqueueMany(myQueue, items, 3, &status);
+  ck_assert_int_eq(status, OK);
+  myQueue->enqueue(myQueue, items[3], &status);
+  myQueue->enqueueMany(myQueue, &items[4], 6, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), 10);
+
+  void* out[10];
+  int total = myQueue->dequeueMany(myQueue, out, 4, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(total, 4);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), 6);
+
+  total += myQueue->dequeueMany(myQueue, &out[4], 10, &status);
+  ck_assert_int_eq(total, 10);
+  ck_assert_int_eq(myQueue->empty(myQueue, &status), 1);
+  for (int i = 0; i < 10; i++)
+    ck_assert_ptr_eq(out[i], items[i]);
+
+  ck_assert_int_eq(myQueue->dequeueMany(myQueue, out, 10, &status), 0);
+  ck_assert_int_eq(status, OK);
+
+  myQueue->enqueueMany(myQueue, items, 2, &status);
+  ck_assert_ptr_eq(myQueue->dequeue(myQueue, &status), items[0]);
+  ck_assert_ptr_eq(myQueue->dequeue(myQueue, &status), items[1]);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE BULK END */
+
+/**************************************************/
+
+/* TEST CASE FAST START */
+
+enum Fast_constants {
+  FAST_ITEMS = 100
+};
+
+START_TEST(fast) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[FAST_ITEMS];
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&allocator, &status);
+  myQueue->setPoolCap(myQueue, FAST_ITEMS / 2, &status);
+  ck_assert_int_eq(LDSC_queue_empty_fast(myQueue), 1);
+  ck_assert_ptr_null(LDSC_queue_dequeue_fast(myQueue));
+  ck_assert_ptr_null(LDSC_queue_peek_fast(myQueue));
+
+  for (int i = 0; i < FAST_ITEMS; i++) {
+    testData[i] = i;
+    if (i % 2) myQueue->enqueue(myQueue, &testData[i], &status);
+    else ck_assert_int_eq(LDSC_queue_enqueue_fast(myQueue, &testData[i]), OK);
+  }
+  ck_assert_int_eq(LDSC_queue_length_fast(myQueue), FAST_ITEMS);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), FAST_ITEMS);
+  ck_assert_ptr_eq(LDSC_queue_peek_fast(myQueue), &testData[0]);
+
+  for (int i = 0; i < FAST_ITEMS; i++) {
+    void* dataPtr = i % 3 ? LDSC_queue_dequeue_fast(myQueue) : myQueue->dequeue(myQueue, &status);
+    ck_assert_ptr_eq(dataPtr, &testData[i]);
+  }
+  ck_assert_int_eq(LDSC_queue_empty_fast(myQueue), 1);
+  ck_assert_int_eq(counter.frees, FAST_ITEMS / 2);
+
+  int allocs = counter.allocs;
+  for (int i = 0; i < FAST_ITEMS / 2; i++)
+    LDSC_queue_enqueue_fast(myQueue, &testData[i]);
+  ck_assert_int_eq(counter.allocs, allocs);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE FAST END */
+
+/**************************************************/
+
+/* TEST CASE STATS START */
+
+enum Stats_constants {
+  STATS_ITEMS = 10
+};
+
+START_TEST(stats_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+
+  myQueue->stats(NULL, &stats, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->stats(myQueue, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myQueue->resetStats(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(stats) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  int testData[STATS_ITEMS];
+  void* items[2] = { &testData[0], &testData[1] };
+
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+  myQueue->setPoolCap(myQueue, 0, &status);
+  for (int i = 0; i < STATS_ITEMS; i++)
+    myQueue->enqueue(myQueue, &testData[i], &status);
+  myQueue->peek(myQueue, &status);
+  LDSC_queue_peek_fast(myQueue);
+  myQueue->dequeue(myQueue, &status);
+  myQueue->dequeue(myQueue, &status);
+  LDSC_queue_dequeue_fast(myQueue);
+  LDSC_queue_dequeue_fast(myQueue);
+  myQueue->enqueueMany(myQueue, items, 2, &status);
+
+  myQueue->stats(myQueue, &stats, &status);
+  ck_assert_int_eq(status, OK);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.inserts, STATS_ITEMS + 2);
+  ck_assert_int_eq(stats.removals, 4);
+  ck_assert_int_eq(stats.lookups, 2);
+  ck_assert_int_eq(stats.nodeAllocs, STATS_ITEMS + 2);
+  ck_assert_int_eq(stats.nodeFrees, 4);
+  ck_assert_int_eq(stats.highWater, STATS_ITEMS);
+#else
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.nodeAllocs, 0);
+  ck_assert_int_eq(stats.highWater, 0);
+#endif
+  ck_assert_int_eq(stats.nodesTraversed, 0);
+
+  myQueue->resetStats(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  myQueue->stats(myQueue, &stats, &status);
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.removals, 0);
+  ck_assert_int_eq(stats.nodeAllocs, 0);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.highWater, STATS_ITEMS - 2);
+#endif
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE STATS END */
+
+/**************************************************/
+
+/* TEST CASE LATENCY START */
+
+enum Latency_constants {
+  LATENCY_ITEMS = 10,
+  LATENCY_RATE = 2
+};
+
+START_TEST(latency_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+
+  myQueue->sampleLatency(NULL, NULL, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->sampleLatency(myQueue, NULL, NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(latency) {
+  LDSC_error status = OK;
+  int testData[LATENCY_ITEMS];
+  LDSC_histogram* insertHist = LDSC_histogram_init(&status);
+  LDSC_histogram* removeHist = LDSC_histogram_init(&status);
+
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+  myQueue->sampleLatency(myQueue, insertHist, removeHist, LATENCY_RATE, &status);
+#ifdef LDSC_TIMING
+  ck_assert_int_eq(status, OK);
+  for (int i = 0; i < LATENCY_ITEMS / 2; i++) {
+    myQueue->enqueue(myQueue, &testData[i], &status);
+    LDSC_queue_enqueue_fast(myQueue, &testData[LATENCY_ITEMS / 2 + i]);
+  }
+  for (int i = 0; i < LATENCY_ITEMS / 2; i++) {
+    myQueue->dequeue(myQueue, &status);
+    LDSC_queue_dequeue_fast(myQueue);
+  }
+  ck_assert_ptr_null(myQueue->dequeue(myQueue, &status));
+
+  ck_assert_int_eq(insertHist->count(insertHist, &status), LATENCY_ITEMS / LATENCY_RATE);
+  ck_assert_int_eq(removeHist->count(removeHist, &status), LATENCY_ITEMS / LATENCY_RATE);
+  ck_assert_int_ge(removeHist->percentile(removeHist, 99.9, &status), removeHist->min(removeHist, &status));
+
+  myQueue->sampleLatency(myQueue, NULL, NULL, 0, &status);
+  ck_assert_int_eq(status, OK);
+  insertHist->reset(insertHist, &status);
+  for (int i = 0; i < LATENCY_ITEMS; i++)
+    myQueue->enqueue(myQueue, &testData[i], &status);
+  ck_assert_int_eq(insertHist->count(insertHist, &status), 0);
+#else
+  ck_assert_int_eq(status, ERROR);
+  myQueue->sampleLatency(myQueue, NULL, NULL, LATENCY_RATE, &status);
+  ck_assert_int_eq(status, OK);
+  myQueue->sampleLatency(myQueue, insertHist, removeHist, 0, &status);
+  ck_assert_int_eq(status, OK);
+  myQueue->enqueue(myQueue, &testData[0], &status);
+  myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(insertHist->count(insertHist, &status), 0);
+  ck_assert_int_eq(removeHist->count(removeHist, &status), 0);
+#endif
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  insertHist->delete(insertHist, &status);
+  removeHist->delete(removeHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE LATENCY END */
+
+/**************************************************/
+
+/* TEST CASE RESIDENCY START */
+
+enum Residency_constants {
+  RESIDENCY_ITEMS = 8
+};
+
+START_TEST(residency_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_queue* myQueue = LDSC_queue_init(&status);
+
+  myQueue->trackResidency(NULL, 1, NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->peekAge(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  ck_assert_int_eq(myQueue->peekAge(myQueue, &status), 0);
+#ifdef LDSC_TIMING
+  ck_assert_int_eq(status, OK);
+#else
+  ck_assert_int_eq(status, ERROR);
+#endif
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(residency) {
+  LDSC_error status = OK;
+  int testData[RESIDENCY_ITEMS];
+  LDSC_histogram* residencyHist = LDSC_histogram_init(&status);
+
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&allocator, &status);
+  long bytes = counter.bytes;
+  myQueue->enqueue(myQueue, &testData[0], &status);
+  myQueue->trackResidency(myQueue, 1, residencyHist, &status);
+#ifdef LDSC_TIMING
+  ck_assert_int_eq(counter.bytes - bytes, 2 * sizeof(void*) + sizeof(long long));
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myQueue->peekAge(myQueue, &status), 0);
+
+  void* items[RESIDENCY_ITEMS];
+  myQueue->enqueue(myQueue, &testData[1], &status);
+  LDSC_queue_enqueue_fast(myQueue, &testData[2]);
+  for (int i = 3; i < RESIDENCY_ITEMS; i++)
+    items[i - 3] = &testData[i];
+  myQueue->enqueueMany(myQueue, items, RESIDENCY_ITEMS - 3, &status);
+
+  long long begin = LDSC_histogram_now();
+  while (LDSC_histogram_now() == begin);
+
+  myQueue->dequeue(myQueue, &status);
+  ck_assert_int_gt(myQueue->peekAge(myQueue, &status), 0);
+  ck_assert_int_eq(status, OK);
+
+  ck_assert_ptr_eq(myQueue->dequeue(myQueue, &status), &testData[1]);
+  ck_assert_ptr_eq(LDSC_queue_dequeue_fast(myQueue), &testData[2]);
+  ck_assert_int_eq(myQueue->dequeueMany(myQueue, items, RESIDENCY_ITEMS, &status), RESIDENCY_ITEMS - 3);
+  ck_assert_int_eq(myQueue->peekAge(myQueue, &status), 0);
+
+  ck_assert_int_eq(residencyHist->count(residencyHist, &status), RESIDENCY_ITEMS - 1);
+  ck_assert_int_gt(residencyHist->min(residencyHist, &status), 0);
+
+  myQueue->trackResidency(myQueue, 0, NULL, &status);
+  ck_assert_int_eq(status, OK);
+  residencyHist->reset(residencyHist, &status);
+  myQueue->enqueue(myQueue, &testData[0], &status);
+  ck_assert_int_eq(myQueue->peekAge(myQueue, &status), 0);
+  myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(residencyHist->count(residencyHist, &status), 0);
+#else
+  ck_assert_int_eq(counter.bytes - bytes, 2 * sizeof(void*));
+  ck_assert_int_eq(status, ERROR);
+  myQueue->peekAge(myQueue, &status);
+  ck_assert_int_eq(status, ERROR);
+  myQueue->trackResidency(myQueue, 0, residencyHist, &status);
+  ck_assert_int_eq(status, OK);
+  myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(residencyHist->count(residencyHist, &status), 0);
+#endif
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  residencyHist->delete(residencyHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE RESIDENCY END */
+
+/**************************************************/
+
+/* TEST CASE REF START */
+
+START_TEST(ref_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+  int testData = 17;
+
+  LDSC_queueRef* myRef = LDSC_queueRef_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myRef);
+
+  LDSC_queueRef_delete(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myRef = LDSC_queueRef_init(&status);
+  ck_assert_int_eq(status, OK);
+  myRef->ops->enqueue(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(myRef->ops->dequeue(NULL, &status));
+  ck_assert_int_eq(status, NULL_SELF);
+  myRef->ops->enqueue(myRef->pd, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  LDSC_queueRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(ref) {
+  LDSC_error status = OK;
+  AllocCounter queueCounter = { 0, 0, 0 };
+  AllocCounter refCounter = { 0, 0, 0 };
+  LDSC_allocator queueAllocator = { &counting_alloc, &counting_free, &queueCounter };
+  LDSC_allocator refAllocator = { &counting_alloc, &counting_free, &refCounter };
+  int testData[] = {17, 9, 19};
+  void* items[3];
+
+  LDSC_queue* myQueue = LDSC_queue_init_with(&queueAllocator, &status);
+  LDSC_queueRef* myRef = LDSC_queueRef_init_with(&refAllocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myRef);
+  ck_assert_int_eq(refCounter.allocs, 1);
+  ck_assert_int_eq(sizeof(LDSC_queueRef), 2 * sizeof(void*));
+  ck_assert_int_eq(queueCounter.bytes - refCounter.bytes, sizeof(LDSC_queue) - sizeof(LDSC_queueRef));
+
+  ck_assert_int_eq(myRef->ops->empty(myRef->pd, &status), 1);
+  for (int i = 0; i < 3; i++)
+    myRef->ops->enqueue(myRef->pd, &testData[i], &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myRef->ops->length(myRef->pd, &status), 3);
+  ck_assert_ptr_eq(myRef->ops->peek(myRef->pd, &status), &testData[0]);
+  ck_assert_ptr_eq(myRef->ops->dequeue(myRef->pd, &status), &testData[0]);
+  ck_assert_int_eq(myRef->ops->dequeueMany(myRef->pd, items, 3, &status), 2);
+  ck_assert_ptr_eq(items[0], &testData[1]);
+  ck_assert_ptr_eq(items[1], &testData[2]);
+
+  myRef->ops->enqueueMany(myRef->pd, items, 2, &status);
+  ck_assert_int_eq(status, OK);
+  LDSC_queueRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(refCounter.allocs, refCounter.frees);
+  ck_assert_int_eq(refCounter.bytes, 0);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE REF END */
+
+/**************************************************/
+
 /* SUITE DEFINITION */
 
 Suite* LDSC_queue_suite() {
@@ -240,6 +796,11 @@ Suite* LDSC_queue_suite() {
   tcase_add_test(tc_core, initialization);
   suite_add_tcase(s, tc_core);
 
+  TCase* tc_init_with = tcase_create("init_with");
+  tcase_add_test(tc_init_with, init_with_invalid_params);
+  tcase_add_test(tc_init_with, init_with);
+  suite_add_tcase(s, tc_init_with);
+
   TCase* tc_empty = tcase_create("empty");
   tcase_add_test(tc_empty, empty_invalid_params);
   tcase_add_test(tc_empty, empty);
@@ -265,5 +826,39 @@ Suite* LDSC_queue_suite() {
   tcase_add_test(tc_peek, peek);
   suite_add_tcase(s, tc_peek);
 
+  TCase* tc_pool = tcase_create("pool");
+  tcase_add_test(tc_pool, pool_invalid_params);
+  tcase_add_test(tc_pool, pool);
+  suite_add_tcase(s, tc_pool);
+
+  TCase* tc_bulk = tcase_create("bulk");
+  tcase_add_test(tc_bulk, bulk_invalid_params);
+  tcase_add_test(tc_bulk, bulk);
+  suite_add_tcase(s, tc_bulk);
+
+  TCase* tc_fast = tcase_create("fast");
+  tcase_add_test(tc_fast, fast);
+  suite_add_tcase(s, tc_fast);
+
+  TCase* tc_stats = tcase_create("stats");
+  tcase_add_test(tc_stats, stats_invalid_params);
+  tcase_add_test(tc_stats, stats);
+  suite_add_tcase(s, tc_stats);
+
+  TCase* tc_latency = tcase_create("latency");
+  tcase_add_test(tc_latency, latency_invalid_params);
+  tcase_add_test(tc_latency, latency);
+  suite_add_tcase(s, tc_latency);
+
+  TCase* tc_residency = tcase_create("residency");
+  tcase_add_test(tc_residency, residency_invalid_params);
+  tcase_add_test(tc_residency, residency);
+  suite_add_tcase(s, tc_residency);
+
+  TCase* tc_ref = tcase_create("ref");
+  tcase_add_test(tc_ref, ref_invalid_params);
+  tcase_add_test(tc_ref, ref);
+  suite_add_tcase(s, tc_ref);
+
   return s;
 }
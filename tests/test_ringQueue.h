@@ -0,0 +1,8 @@
+#ifndef TEST_RINGQUEUE_H
+#define TEST_RINGQUEUE_H
+
+#include <check.h>
+
+Suite* LDSC_ringQueue_suite(void); 
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef TEST_SKIPLIST_H
+#define TEST_SKIPLIST_H
+
+#include <check.h>
+
+Suite* LDSC_skipList_suite(void);
+
+#endif
@@ -0,0 +1,338 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#include "LDSC_errors.h"
+#include "LDSC_spscQueue.h"
+#include "test_spscQueue.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_spscQueue data structure.
+ * Only the 'initialization' test will check for possible malloc errors.
+ * All following tests will assume successful mallocs.
+ * All tests will test for successful LDSC_spscQueue delete.
+ * All status checks will occur before value checks, if applicable.
+ * Beyond that, status checks will only occur the methods that the test targets
+ */
+
+/**************************************************/
+
+enum Test_constants {
+  QUEUE_CAPACITY = 8,
+  TRANSFER_COUNT = 200000
+};
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(initialization) {
+  LDSC_error status = OK;
+
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myQueue);
+  ck_assert_ptr_nonnull(myQueue->pd);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), 0);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(0, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myQueue);
+
+  myQueue = LDSC_spscQueue_init_with(&allocator, QUEUE_CAPACITY, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myQueue);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE EMPTY START */
+
+START_TEST(empty_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+
+  int empty = myQueue->empty(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(empty, ERROR);
+
+  int length = myQueue->length(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(length, ERROR);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(empty) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  int testData = 17;
+
+  int empty = myQueue->empty(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(empty, 1);
+
+  myQueue->enqueue(myQueue, &testData, &status);
+  empty = myQueue->empty(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(empty, 0);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE EMPTY END */
+
+/**************************************************/
+
+/* TEST CASE ENQUEUE START */
+
+START_TEST(enqueue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  int testData = 17;
+
+  myQueue->enqueue(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myQueue->enqueue(myQueue, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(enqueue) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  int testData[QUEUE_CAPACITY + 1];
+
+  for (int i = 0; i < QUEUE_CAPACITY; i++) {
+    testData[i] = i;
+    myQueue->enqueue(myQueue, &testData[i], &status);
+    ck_assert_int_eq(status, OK);
+  }
+
+  myQueue->enqueue(myQueue, &testData[0], &status);
+  ck_assert_int_eq(status, STRUCTURE_FULL);
+  ck_assert_int_eq(myQueue->length(myQueue, &status), QUEUE_CAPACITY);
+
+  for (int i = 0; i < QUEUE_CAPACITY; i++)
+    ck_assert_int_eq(*(int*)myQueue->dequeue(myQueue, &status), testData[i]);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(enqueueMany) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  int testData[QUEUE_CAPACITY + 4];
+  void* items[QUEUE_CAPACITY + 4];
+
+  for (int i = 0; i < QUEUE_CAPACITY + 4; i++) {
+    testData[i] = i;
+    items[i] = &testData[i];
+  }
+
+  int count = myQueue->enqueueMany(myQueue, items, 4, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, 4);
+
+  count = myQueue->enqueueMany(myQueue, items + 4, QUEUE_CAPACITY, &status);
+  ck_assert_int_eq(status, STRUCTURE_FULL);
+  ck_assert_int_eq(count, QUEUE_CAPACITY - 4);
+
+  void* out[QUEUE_CAPACITY];
+  count = myQueue->dequeueMany(myQueue, out, QUEUE_CAPACITY, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, QUEUE_CAPACITY);
+  for (int i = 0; i < QUEUE_CAPACITY; i++)
+    ck_assert_int_eq(*(int*)out[i], testData[i]);
+
+  items[1] = NULL;
+  count = myQueue->enqueueMany(myQueue, items, 2, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(count, 0);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE ENQUEUE END */
+
+/**************************************************/
+
+/* TEST CASE DEQUEUE START */
+
+START_TEST(dequeue_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+
+  void* dataPtr = myQueue->dequeue(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  int count = myQueue->dequeueMany(myQueue, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+  ck_assert_int_eq(count, 0);
+
+  dataPtr = myQueue->peek(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(dequeue) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  int testData = 17;
+
+  void* dataPtr = myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_null(dataPtr);
+
+  myQueue->enqueue(myQueue, &testData, &status);
+
+  dataPtr = myQueue->peek(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData);
+
+  dataPtr = myQueue->dequeue(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData);
+  ck_assert_int_eq(myQueue->empty(myQueue, &status), 1);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(batch_stale_cache) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(8, &status);
+  int testData[12];
+  void* items[12];
+  void* out[12];
+
+  for (int i = 0; i < 12; i++) {
+    testData[i] = i;
+    items[i] = &testData[i];
+  }
+
+  for (int i = 0; i < 6; i++)
+    myQueue->enqueue(myQueue, items[i], &status);
+  for (int i = 0; i < 5; i++)
+    myQueue->dequeue(myQueue, &status);
+
+  int count = myQueue->enqueueMany(myQueue, items + 6, 5, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, 5);
+
+  count = myQueue->dequeueMany(myQueue, out, 12, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(count, 6);
+  for (int i = 0; i < 6; i++)
+    ck_assert_ptr_eq(out[i], items[5 + i]);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE DEQUEUE END */
+
+/**************************************************/
+
+/* TEST CASE CONCURRENT START */
+
+static int transferData[TRANSFER_COUNT];
+
+static void* producer(void* arg) {
+  LDSC_spscQueue* myQueue = (LDSC_spscQueue*)arg;
+  LDSC_error status = OK;
+  int i = 0;
+  while (i < TRANSFER_COUNT) {
+    myQueue->enqueue(myQueue, &transferData[i], &status);
+    if (status == OK) i++;
+    else sched_yield();
+  }
+  return NULL;
+}
+
+START_TEST(concurrent) {
+  LDSC_error status = OK;
+  LDSC_spscQueue* myQueue = LDSC_spscQueue_init(QUEUE_CAPACITY, &status);
+  pthread_t thread;
+
+  for (int i = 0; i < TRANSFER_COUNT; i++)
+    transferData[i] = i;
+
+  pthread_create(&thread, NULL, &producer, myQueue);
+
+  int expected = 0;
+  void* out[QUEUE_CAPACITY];
+  while (expected < TRANSFER_COUNT) {
+    int count = myQueue->dequeueMany(myQueue, out, QUEUE_CAPACITY, &status);
+    if (count == 0) sched_yield();
+    for (int i = 0; i < count; i++, expected++)
+      ck_assert_int_eq(*(int*)out[i], expected);
+  }
+
+  pthread_join(thread, NULL);
+  ck_assert_int_eq(myQueue->empty(myQueue, &status), 1);
+
+  myQueue->delete(myQueue, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CONCURRENT END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_spscQueue_suite() {
+  Suite *s;
+  s = suite_create("LDSC_spscQueue");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, initialization);
+  tcase_add_test(tc_core, init_with_invalid_params);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_empty = tcase_create("empty");
+  tcase_add_test(tc_empty, empty_invalid_params);
+  tcase_add_test(tc_empty, empty);
+  suite_add_tcase(s, tc_empty);
+
+  TCase* tc_enqueue = tcase_create("enqueue");
+  tcase_add_test(tc_enqueue, enqueue_invalid_params);
+  tcase_add_test(tc_enqueue, enqueue);
+  tcase_add_test(tc_enqueue, enqueueMany);
+  suite_add_tcase(s, tc_enqueue);
+
+  TCase* tc_dequeue = tcase_create("dequeue");
+  tcase_add_test(tc_dequeue, dequeue_invalid_params);
+  tcase_add_test(tc_dequeue, dequeue);
+  tcase_add_test(tc_dequeue, batch_stale_cache);
+  suite_add_tcase(s, tc_dequeue);
+
+  TCase* tc_concurrent = tcase_create("concurrent");
+  tcase_add_test(tc_concurrent, concurrent);
+  suite_add_tcase(s, tc_concurrent);
+
+  return s;
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_SPSCQUEUE_H
+#define TEST_SPSCQUEUE_H
+
+#include <check.h>
+
+Suite* LDSC_spscQueue_suite(void);
+
+#endif
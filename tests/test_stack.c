@@ -1,6 +1,11 @@
+#include <pthread.h>
+#include <sched.h>
 #include <stdlib.h>
 
 #include "LDSC_stack.h"
+#include "LDSC_stackFast.h"
+#include "LDSC_stackRef.h"
+#include "test_alloc.h"
 #include "test_stack.h"
 #include <check.h>
 
@@ -41,6 +46,52 @@ START_TEST(initialization) {
 
 /**************************************************/
 
+/* TEST CASE INIT WITH START */
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_stack* myStack = LDSC_stack_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myStack);
+
+  myStack = LDSC_stack_init_with(NULL, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myStack);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[] = {17, 9, 19};
+
+  LDSC_stack* myStack = LDSC_stack_init_with(&allocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myStack);
+  ck_assert_int_eq(counter.allocs, 1);
+
+  for (int i = 0; i < 3; i++)
+    myStack->push(myStack, &testData[i], &status);
+  ck_assert_int_eq(counter.allocs, 4);
+
+  myStack->pop(myStack, &status);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE INIT WITH END */
+
+/**************************************************/
+
 /* TEST CASE SIZE START */
 
 START_TEST(size_invalid_params) {
@@ -234,6 +285,638 @@ START_TEST(pop) {
 
 /**************************************************/
 
+/* TEST CASE POOL START */
+
+START_TEST(pool_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_stack* myStack = LDSC_stack_init(&status);
+
+  myStack->reserve(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->reserve(myStack, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myStack->setPoolCap(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->setPoolCap(myStack, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(pool) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData = 17;
+
+  LDSC_stack* myStack = LDSC_stack_init_with(&allocator, &status);
+
+  myStack->reserve(myStack, 100, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, 101);
+
+  for (int i = 0; i < 100; i++)
+    myStack->push(myStack, &testData, &status);
+  ck_assert_int_eq(counter.allocs, 101);
+
+  for (int i = 0; i < 100; i++)
+    myStack->pop(myStack, &status);
+  ck_assert_int_eq(counter.frees, 0);
+
+  myStack->setPoolCap(myStack, 0, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.frees, 100);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE POOL END */
+
+/**************************************************/
+
+/* TEST CASE LOCKFREE START */
+
+enum Lockfree_constants {
+  LOCKFREE_THREADS = 4,
+  LOCKFREE_ROUNDS = 20000
+};
+
+START_TEST(lockfree) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[] = {17, 9, 19};
+
+  LDSC_stack* myStack = LDSC_stack_init_lockfree(&allocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myStack);
+  ck_assert_int_eq(myStack->empty(myStack, &status), 1);
+  ck_assert_ptr_null(myStack->pop(myStack, &status));
+  ck_assert_int_eq(status, OK);
+
+  myStack->push(myStack, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  for (int i = 0; i < 3; i++)
+    myStack->push(myStack, &testData[i], &status);
+  ck_assert_int_eq(myStack->size(myStack, &status), 3);
+  ck_assert_int_eq(*(int*)myStack->peek(myStack, &status), testData[2]);
+
+  for (int i = 2; i >= 0; i--) {
+    void* dataPtr = myStack->pop(myStack, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(*(int*)dataPtr, testData[i]);
+  }
+  ck_assert_int_eq(myStack->empty(myStack, &status), 1);
+
+  myStack->reserve(myStack, 1000, &status);
+  ck_assert_int_eq(status, OK);
+  int allocs = counter.allocs;
+  for (int i = 0; i < 1000; i++)
+    myStack->push(myStack, &testData[0], &status);
+  ck_assert_int_eq(counter.allocs, allocs);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+static int lockfreeData[LOCKFREE_THREADS];
+
+static void* lockfree_worker(void* arg) {
+  LDSC_stack* myStack = (LDSC_stack*)arg;
+  long popped = 0;
+
+  for (int i = 0; i < LOCKFREE_ROUNDS; i++) {
+    myStack->push(myStack, &lockfreeData[i % LOCKFREE_THREADS], NULL);
+    if (myStack->pop(myStack, NULL))
+      popped++;
+    if (i % 64 == 0)
+      sched_yield();
+  }
+  return (void*)popped;
+}
+
+START_TEST(lockfree_concurrent) {
+  LDSC_error status = OK;
+  LDSC_stack* myStack = LDSC_stack_init_lockfree(NULL, &status);
+  pthread_t threads[LOCKFREE_THREADS];
+
+  for (int i = 0; i < LOCKFREE_THREADS; i++)
+    pthread_create(&threads[i], NULL, &lockfree_worker, myStack);
+
+  long popped = 0;
+  for (int i = 0; i < LOCKFREE_THREADS; i++) {
+    void* result = NULL;
+    pthread_join(threads[i], &result);
+    popped += (long)result;
+  }
+
+  ck_assert_int_eq(popped, LOCKFREE_THREADS * LOCKFREE_ROUNDS);
+  ck_assert_int_eq(myStack->size(myStack, &status), 0);
+  ck_assert_int_eq(myStack->empty(myStack, &status), 1);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE LOCKFREE END */
+
+/**************************************************/
+
+/* TEST CASE BULK START */
+
+START_TEST(bulk_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_stack* myStack = LDSC_stack_init(&status);
+  LDSC_stack* lockfreeStack = LDSC_stack_init_lockfree(NULL, &status);
+  int testData = 17;
+  void* items[] = {&testData, NULL, &testData};
+  LDSC_stack* stacks[] = {myStack, lockfreeStack};
+
+  for (int i = 0; i < 2; i++) {
+    LDSC_stack* currStack = stacks[i];
+
+    currStack->pushMany(NULL, items, 1, &status);
+    ck_assert_int_eq(status, NULL_SELF);
+
+    currStack->pushMany(currStack, NULL, 1, &status);
+    ck_assert_int_eq(status, NULL_DATAPTR);
+
+    currStack->pushMany(currStack, items, -1, &status);
+    ck_assert_int_eq(status, INVALID_CAPACITY);
+
+    currStack->pushMany(currStack, items, 3, &status);
+    ck_assert_int_eq(status, NULL_DATAPTR);
+    ck_assert_int_eq(currStack->size(currStack, &status), 0);
+
+    currStack->popMany(NULL, items, 1, &status);
+    ck_assert_int_eq(status, NULL_SELF);
+
+    currStack->popMany(currStack, NULL, 1, &status);
+    ck_assert_int_eq(status, NULL_DATAPTR);
+
+    currStack->popMany(currStack, items, -1, &status);
+    ck_assert_int_eq(status, INVALID_CAPACITY);
+  }
+
+  lockfreeStack->delete(lockfreeStack, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(bulk) {
+  LDSC_error status = OK;
+  int remaining = 2 + 5;
+  LDSC_allocator allocator = { &limited_alloc, &limited_free, &remaining };
+  int testData[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  void* items[10];
+  for (int i = 0; i < 10; i++)
+    items[i] = &testData[i];
+
+  LDSC_stack* myStack = LDSC_stack_init_with(&allocator, &status);
+  LDSC_stack* lockfreeStack = LDSC_stack_init_lockfree(NULL, &status);
+  LDSC_stack* stacks[] = {myStack, lockfreeStack};
+  myStack->setPoolCap(myStack, 0, &status);
+
+  myStack->pushMany(myStack, items, 10, &status);
+  ck_assert_int_eq(status, NODE_MALLOC);
+  ck_assert_int_eq(myStack->size(myStack, &status), 0);
+  ck_assert_ptr_null(myStack->peek(myStack, &status));
+  remaining = 12;
+
+  for (int i = 0; i < 2; i++) {
+    LDSC_stack* currStack = stacks[i];
+
+    currStack->pushMany(currStack, items, 0, &status);
+    ck_assert_int_eq(status, OK);
+    currStack->pushMany(currStack, items, 3, &status);
+    ck_assert_int_eq(status, OK);
+    currStack->push(currStack, items[3], &status);
+    currStack->pushMany(currStack, &items[4], 6, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(currStack->size(currStack, &status), 10);
+    ck_assert_ptr_eq(currStack->peek(currStack, &status), items[9]);
+
+    void* out[10];
+    int total = currStack->popMany(currStack, out, 4, &status);
+    ck_assert_int_eq(status, OK);
+    ck_assert_int_eq(total, 4);
+    ck_assert_int_eq(currStack->size(currStack, &status), 6);
+
+    total += currStack->popMany(currStack, &out[4], 10, &status);
+    ck_assert_int_eq(total, 10);
+    ck_assert_int_eq(currStack->empty(currStack, &status), 1);
+    for (int j = 0; j < 10; j++)
+      ck_assert_ptr_eq(out[j], items[9 - j]);
+
+    ck_assert_int_eq(currStack->popMany(currStack, out, 10, &status), 0);
+    ck_assert_int_eq(status, OK);
+
+    currStack->pushMany(currStack, items, 2, &status);
+    ck_assert_ptr_eq(currStack->pop(currStack, &status), items[1]);
+    ck_assert_ptr_eq(currStack->pop(currStack, &status), items[0]);
+  }
+
+  lockfreeStack->delete(lockfreeStack, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+enum Bulk_constants {
+  BULK_BATCH = 8
+};
+
+static void* bulk_worker(void* arg) {
+  LDSC_stack* myStack = (LDSC_stack*)arg;
+  void* items[BULK_BATCH];
+  long popped = 0;
+
+  for (int i = 0; i < BULK_BATCH; i++)
+    items[i] = &lockfreeData[i % LOCKFREE_THREADS];
+
+  for (int i = 0; i < LOCKFREE_ROUNDS / BULK_BATCH; i++) {
+    myStack->pushMany(myStack, items, BULK_BATCH, NULL);
+    popped += myStack->popMany(myStack, items, BULK_BATCH, NULL);
+    if (i % 8 == 0)
+      sched_yield();
+  }
+  return (void*)popped;
+}
+
+START_TEST(bulk_lockfree_concurrent) {
+  LDSC_error status = OK;
+  LDSC_stack* myStack = LDSC_stack_init_lockfree(NULL, &status);
+  pthread_t threads[LOCKFREE_THREADS];
+
+  for (int i = 0; i < LOCKFREE_THREADS; i++)
+    pthread_create(&threads[i], NULL, &bulk_worker, myStack);
+
+  long popped = 0;
+  for (int i = 0; i < LOCKFREE_THREADS; i++) {
+    void* result = NULL;
+    pthread_join(threads[i], &result);
+    popped += (long)result;
+  }
+
+  void* items[BULK_BATCH];
+  int rest = 0;
+  for (int n; (n = myStack->popMany(myStack, items, BULK_BATCH, &status)); )
+    rest += n;
+
+  ck_assert_int_eq(popped + rest, LOCKFREE_THREADS * (LOCKFREE_ROUNDS / BULK_BATCH) * BULK_BATCH);
+  ck_assert_int_eq(myStack->size(myStack, &status), 0);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE BULK END */
+
+/**************************************************/
+
+/* TEST CASE FAST START */
+
+enum Fast_constants {
+  FAST_ITEMS = 100
+};
+
+START_TEST(fast) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData[FAST_ITEMS];
+
+  LDSC_stack* myStack = LDSC_stack_init_with(&allocator, &status);
+  myStack->setPoolCap(myStack, FAST_ITEMS / 2, &status);
+  ck_assert_int_eq(LDSC_stack_empty_fast(myStack), 1);
+  ck_assert_ptr_null(LDSC_stack_pop_fast(myStack));
+  ck_assert_ptr_null(LDSC_stack_peek_fast(myStack));
+
+  for (int i = 0; i < FAST_ITEMS; i++) {
+    testData[i] = i;
+    if (i % 2) myStack->push(myStack, &testData[i], &status);
+    else ck_assert_int_eq(LDSC_stack_push_fast(myStack, &testData[i]), OK);
+  }
+  ck_assert_int_eq(LDSC_stack_size_fast(myStack), FAST_ITEMS);
+  ck_assert_int_eq(myStack->size(myStack, &status), FAST_ITEMS);
+  ck_assert_ptr_eq(LDSC_stack_peek_fast(myStack), &testData[FAST_ITEMS - 1]);
+
+  for (int i = 0; i < FAST_ITEMS; i++) {
+    void* dataPtr = i % 3 ? LDSC_stack_pop_fast(myStack) : myStack->pop(myStack, &status);
+    ck_assert_ptr_eq(dataPtr, &testData[FAST_ITEMS - 1 - i]);
+  }
+  ck_assert_int_eq(LDSC_stack_empty_fast(myStack), 1);
+  ck_assert_int_eq(counter.frees, FAST_ITEMS / 2);
+
+  int allocs = counter.allocs;
+  for (int i = 0; i < FAST_ITEMS / 2; i++)
+    LDSC_stack_push_fast(myStack, &testData[i]);
+  ck_assert_int_eq(counter.allocs, allocs);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE FAST END */
+
+/**************************************************/
+
+/* TEST CASE STATS START */
+
+enum Stats_constants {
+  STATS_ITEMS = 10
+};
+
+START_TEST(stats_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  LDSC_stack* myStack = LDSC_stack_init(&status);
+
+  myStack->stats(NULL, &stats, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->stats(myStack, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myStack->resetStats(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(stats) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  int testData[STATS_ITEMS];
+  void* items[2] = { &testData[0], &testData[1] };
+
+  LDSC_stack* myStack = LDSC_stack_init(&status);
+  myStack->setPoolCap(myStack, 0, &status);
+  for (int i = 0; i < STATS_ITEMS; i++)
+    myStack->push(myStack, &testData[i], &status);
+  myStack->peek(myStack, &status);
+  LDSC_stack_peek_fast(myStack);
+  myStack->pop(myStack, &status);
+  myStack->pop(myStack, &status);
+  LDSC_stack_pop_fast(myStack);
+  LDSC_stack_pop_fast(myStack);
+  myStack->pushMany(myStack, items, 2, &status);
+
+  myStack->stats(myStack, &stats, &status);
+  ck_assert_int_eq(status, OK);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.inserts, STATS_ITEMS + 2);
+  ck_assert_int_eq(stats.removals, 4);
+  ck_assert_int_eq(stats.lookups, 2);
+  ck_assert_int_eq(stats.nodeAllocs, STATS_ITEMS + 2);
+  ck_assert_int_eq(stats.nodeFrees, 4);
+  ck_assert_int_eq(stats.highWater, STATS_ITEMS);
+#else
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.nodeAllocs, 0);
+  ck_assert_int_eq(stats.highWater, 0);
+#endif
+  ck_assert_int_eq(stats.nodesTraversed, 0);
+
+  myStack->resetStats(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->stats(myStack, &stats, &status);
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.removals, 0);
+  ck_assert_int_eq(stats.nodeAllocs, 0);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.highWater, STATS_ITEMS - 2);
+#endif
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(stats_lockfree) {
+  LDSC_error status = OK;
+  LDSC_stats stats;
+  int testData[STATS_ITEMS];
+  void* items[2] = { &testData[0], &testData[1] };
+
+  LDSC_stack* myStack = LDSC_stack_init_lockfree(NULL, &status);
+  for (int i = 0; i < STATS_ITEMS; i++)
+    myStack->push(myStack, &testData[i], &status);
+  myStack->peek(myStack, &status);
+  for (int i = 0; i < 4; i++)
+    myStack->pop(myStack, &status);
+  myStack->pushMany(myStack, items, 2, &status);
+
+  myStack->stats(myStack, &stats, &status);
+  ck_assert_int_eq(status, OK);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.inserts, STATS_ITEMS + 2);
+  ck_assert_int_eq(stats.removals, 4);
+  ck_assert_int_eq(stats.lookups, 1);
+  ck_assert_int_ge(stats.nodeAllocs, STATS_ITEMS);
+  ck_assert_int_eq(stats.highWater, STATS_ITEMS);
+#else
+  ck_assert_int_eq(stats.inserts, 0);
+  ck_assert_int_eq(stats.highWater, 0);
+#endif
+  ck_assert_int_eq(stats.nodeFrees, 0);
+
+  myStack->resetStats(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->stats(myStack, &stats, &status);
+  ck_assert_int_eq(stats.inserts, 0);
+#ifdef LDSC_STATS
+  ck_assert_int_eq(stats.highWater, STATS_ITEMS - 2);
+#endif
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE STATS END */
+
+/**************************************************/
+
+/* TEST CASE LATENCY START */
+
+enum Latency_constants {
+  LATENCY_ITEMS = 10,
+  LATENCY_RATE = 2
+};
+
+START_TEST(latency_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_stack* myStack = LDSC_stack_init(&status);
+
+  myStack->sampleLatency(NULL, NULL, NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->sampleLatency(myStack, NULL, NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(latency_lockfree) {
+  LDSC_error status = OK;
+  LDSC_histogram* hist = LDSC_histogram_init(&status);
+  LDSC_stack* myStack = LDSC_stack_init_lockfree(NULL, &status);
+
+  myStack->sampleLatency(myStack, hist, NULL, 1, &status);
+  ck_assert_int_eq(status, ERROR);
+  myStack->sampleLatency(myStack, NULL, hist, 1, &status);
+  ck_assert_int_eq(status, ERROR);
+  myStack->sampleLatency(myStack, NULL, NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myStack->sampleLatency(myStack, hist, hist, 0, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->sampleLatency(myStack, NULL, NULL, 1, &status);
+  ck_assert_int_eq(status, OK);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  hist->delete(hist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(latency) {
+  LDSC_error status = OK;
+  int testData[LATENCY_ITEMS];
+  LDSC_histogram* insertHist = LDSC_histogram_init(&status);
+  LDSC_histogram* removeHist = LDSC_histogram_init(&status);
+
+  LDSC_stack* myStack = LDSC_stack_init(&status);
+  myStack->sampleLatency(myStack, insertHist, removeHist, LATENCY_RATE, &status);
+#ifdef LDSC_TIMING
+  ck_assert_int_eq(status, OK);
+  for (int i = 0; i < LATENCY_ITEMS / 2; i++) {
+    myStack->push(myStack, &testData[i], &status);
+    LDSC_stack_push_fast(myStack, &testData[LATENCY_ITEMS / 2 + i]);
+  }
+  for (int i = 0; i < LATENCY_ITEMS / 2; i++) {
+    myStack->pop(myStack, &status);
+    LDSC_stack_pop_fast(myStack);
+  }
+  ck_assert_ptr_null(myStack->pop(myStack, &status));
+
+  ck_assert_int_eq(insertHist->count(insertHist, &status), LATENCY_ITEMS / LATENCY_RATE);
+  ck_assert_int_eq(removeHist->count(removeHist, &status), LATENCY_ITEMS / LATENCY_RATE);
+  ck_assert_int_ge(removeHist->percentile(removeHist, 99.9, &status), removeHist->min(removeHist, &status));
+
+  myStack->sampleLatency(myStack, NULL, NULL, 0, &status);
+  ck_assert_int_eq(status, OK);
+  insertHist->reset(insertHist, &status);
+  for (int i = 0; i < LATENCY_ITEMS; i++)
+    myStack->push(myStack, &testData[i], &status);
+  ck_assert_int_eq(insertHist->count(insertHist, &status), 0);
+#else
+  ck_assert_int_eq(status, ERROR);
+  myStack->sampleLatency(myStack, NULL, NULL, LATENCY_RATE, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->sampleLatency(myStack, insertHist, removeHist, 0, &status);
+  ck_assert_int_eq(status, OK);
+  myStack->push(myStack, &testData[0], &status);
+  myStack->pop(myStack, &status);
+  ck_assert_int_eq(insertHist->count(insertHist, &status), 0);
+  ck_assert_int_eq(removeHist->count(removeHist, &status), 0);
+#endif
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  insertHist->delete(insertHist, &status);
+  removeHist->delete(removeHist, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE LATENCY END */
+
+/**************************************************/
+
+/* TEST CASE REF START */
+
+START_TEST(ref_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+  int testData = 17;
+
+  LDSC_stackRef* myRef = LDSC_stackRef_init_with(&allocator, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myRef);
+
+  LDSC_stackRef_delete(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myRef = LDSC_stackRef_init(&status);
+  ck_assert_int_eq(status, OK);
+  myRef->ops->push(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(myRef->ops->pop(NULL, &status));
+  ck_assert_int_eq(status, NULL_SELF);
+  myRef->ops->push(myRef->pd, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  LDSC_stackRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(ref) {
+  LDSC_error status = OK;
+  AllocCounter stackCounter = { 0, 0, 0 };
+  AllocCounter refCounter = { 0, 0, 0 };
+  LDSC_allocator stackAllocator = { &counting_alloc, &counting_free, &stackCounter };
+  LDSC_allocator refAllocator = { &counting_alloc, &counting_free, &refCounter };
+  int testData[] = {17, 9, 19};
+  void* items[3];
+
+  LDSC_stack* myStack = LDSC_stack_init_with(&stackAllocator, &status);
+  LDSC_stackRef* myRef = LDSC_stackRef_init_with(&refAllocator, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myRef);
+  ck_assert_int_eq(refCounter.allocs, 1);
+  ck_assert_int_eq(sizeof(LDSC_stackRef), 2 * sizeof(void*));
+  ck_assert_int_eq(stackCounter.bytes - refCounter.bytes, sizeof(LDSC_stack) - sizeof(LDSC_stackRef));
+
+  ck_assert_int_eq(myRef->ops->empty(myRef->pd, &status), 1);
+  for (int i = 0; i < 3; i++)
+    myRef->ops->push(myRef->pd, &testData[i], &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myRef->ops->size(myRef->pd, &status), 3);
+  ck_assert_ptr_eq(myRef->ops->peek(myRef->pd, &status), &testData[2]);
+  ck_assert_ptr_eq(myRef->ops->pop(myRef->pd, &status), &testData[2]);
+  ck_assert_int_eq(myRef->ops->popMany(myRef->pd, items, 3, &status), 2);
+  ck_assert_ptr_eq(items[0], &testData[1]);
+  ck_assert_ptr_eq(items[1], &testData[0]);
+
+  myRef->ops->pushMany(myRef->pd, items, 2, &status);
+  ck_assert_int_eq(status, OK);
+  LDSC_stackRef_delete(myRef, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(refCounter.allocs, refCounter.frees);
+  ck_assert_int_eq(refCounter.bytes, 0);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE REF END */
+
+/**************************************************/
+
 /* SUITE DEFINITION */
 
 Suite* LDSC_stack_suite(void) {
@@ -244,6 +927,11 @@ Suite* LDSC_stack_suite(void) {
   tcase_add_test(tc_core, initialization);
   suite_add_tcase(s, tc_core);
 
+  TCase* tc_init_with = tcase_create("init_with");
+  tcase_add_test(tc_init_with, init_with_invalid_params);
+  tcase_add_test(tc_init_with, init_with);
+  suite_add_tcase(s, tc_init_with);
+
   TCase* tc_size = tcase_create("sizej");
   tcase_add_test(tc_size, size_invalid_params);
   tcase_add_test(tc_size, size_empty_stack);
@@ -269,5 +957,42 @@ Suite* LDSC_stack_suite(void) {
   tcase_add_test(tc_pop, pop);
   suite_add_tcase(s, tc_pop);
 
+  TCase* tc_pool = tcase_create("pool");
+  tcase_add_test(tc_pool, pool_invalid_params);
+  tcase_add_test(tc_pool, pool);
+  suite_add_tcase(s, tc_pool);
+
+  TCase* tc_lockfree = tcase_create("lockfree");
+  tcase_add_test(tc_lockfree, lockfree);
+  tcase_add_test(tc_lockfree, lockfree_concurrent);
+  suite_add_tcase(s, tc_lockfree);
+
+  TCase* tc_bulk = tcase_create("bulk");
+  tcase_add_test(tc_bulk, bulk_invalid_params);
+  tcase_add_test(tc_bulk, bulk);
+  tcase_add_test(tc_bulk, bulk_lockfree_concurrent);
+  suite_add_tcase(s, tc_bulk);
+
+  TCase* tc_fast = tcase_create("fast");
+  tcase_add_test(tc_fast, fast);
+  suite_add_tcase(s, tc_fast);
+
+  TCase* tc_stats = tcase_create("stats");
+  tcase_add_test(tc_stats, stats_invalid_params);
+  tcase_add_test(tc_stats, stats);
+  tcase_add_test(tc_stats, stats_lockfree);
+  suite_add_tcase(s, tc_stats);
+
+  TCase* tc_latency = tcase_create("latency");
+  tcase_add_test(tc_latency, latency_invalid_params);
+  tcase_add_test(tc_latency, latency);
+  tcase_add_test(tc_latency, latency_lockfree);
+  suite_add_tcase(s, tc_latency);
+
+  TCase* tc_ref = tcase_create("ref");
+  tcase_add_test(tc_ref, ref_invalid_params);
+  tcase_add_test(tc_ref, ref);
+  suite_add_tcase(s, tc_ref);
+
   return s;
 }
@@ -0,0 +1,270 @@
+#include <stdlib.h>
+#include <time.h>
+
+#include "LDSC_unrolledList.h"
+#include "test_alloc.h"
+#include "test_unrolledList.h"
+#include <LDSC_errors.h>
+#include <check.h>
+
+/**
+ * Test suite for LDSC_unrolledList data structure.
+ * Only the 'initialization' test will check for possible malloc errors.
+ * All following tests will assume successful mallocs.
+ * All tests will test for successful LDSC_unrolledList delete.
+ * All status checks will occur before value checks, if applicable.
+ * Beyond that, status checks will only occur the methods that the test targets
+ */
+
+/**************************************************/
+
+enum Test_constants {
+  MAX_DATA_SET_SIZE = 100,
+  SMALL_BLOCK_ITEMS = 4
+};
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(initialization) {
+  LDSC_error status = OK;
+  typedef struct privateData {
+    int length;
+    void* head;
+    void* tail;
+  } privateData;
+
+  LDSC_unrolledList* myList = LDSC_unrolledList_init(&status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myList);
+
+  privateData* pd = (privateData*)myList->pd;
+  ck_assert_int_eq(pd->length, 0);
+  ck_assert_ptr_null(pd->head);
+  ck_assert_ptr_null(pd->tail);
+
+  myList->delete(myList, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE INIT WITH START */
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_unrolledList* myList = LDSC_unrolledList_init_with(&allocator, 0, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myList);
+
+  myList = LDSC_unrolledList_init_with(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myList);
+
+  myList = LDSC_unrolledList_init_with(NULL, 1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myList);
+} END_TEST
+
+START_TEST(init_with) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  int testData = 17;
+
+  LDSC_unrolledList* myList = LDSC_unrolledList_init_with(&allocator, SMALL_BLOCK_ITEMS, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myList);
+  ck_assert_int_eq(counter.allocs, 2);
+
+  for (int i = 0; i < SMALL_BLOCK_ITEMS * 3; i++)
+    myList->append(myList, &testData, &status);
+  ck_assert_int_eq(counter.allocs, 5);
+
+  for (int i = 0; i < SMALL_BLOCK_ITEMS; i++)
+    myList->pop(myList, &status);
+  ck_assert_int_eq(counter.frees, 1);
+
+  myList->delete(myList, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.allocs, counter.frees);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE INIT WITH END */
+
+/**************************************************/
+
+/* TEST CASE INVALID PARAMS START */
+
+START_TEST(methods_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_unrolledList* myList = LDSC_unrolledList_init(&status);
+  int testData = 17;
+
+  ck_assert_int_eq(myList->length(NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  ck_assert_int_eq(myList->empty(NULL, &status), ERROR);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myList->append(myList, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myList->prepend(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myList->add(myList, &testData, -1, &status);
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+
+  myList->add(myList, &testData, 1, &status);
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  ck_assert_ptr_null(myList->at(myList, 0, &status));
+  ck_assert_int_eq(status, GREATER_THAN_INDEX);
+
+  ck_assert_ptr_null(myList->replace(myList, NULL, 0, &status));
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  ck_assert_ptr_null(myList->remove(myList, -1, &status));
+  ck_assert_int_eq(status, LESS_THAN_INDEX);
+
+  ck_assert_ptr_null(myList->pop(myList, &status));
+  ck_assert_int_eq(status, OK);
+
+  ck_assert_ptr_null(myList->pull(myList, &status));
+  ck_assert_int_eq(status, OK);
+
+  myList->forEach(myList, NULL, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myList->clear(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myList->delete(myList, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE INVALID PARAMS END */
+
+/**************************************************/
+
+/* TEST CASE METHODS START */
+
+/* forEach callback checking items against an expected array */
+static int checkItem(void* dataPtr, void* ctx) {
+  int*** expected = (int***)ctx;
+  ck_assert_ptr_eq(dataPtr, **expected);
+  (*expected)++;
+  return 0;
+}
+
+START_TEST(methods) {
+  LDSC_error status = OK;
+  AllocCounter counter = { 0, 0, 0 };
+  LDSC_allocator allocator = { &counting_alloc, &counting_free, &counter };
+  LDSC_unrolledList* myList = LDSC_unrolledList_init_with(&allocator, SMALL_BLOCK_ITEMS, &status);
+  int testData[MAX_DATA_SET_SIZE];
+  int* shadow[MAX_DATA_SET_SIZE];
+  int length = 0;
+
+  for (int i = 0; i < MAX_DATA_SET_SIZE; i++)
+    testData[i] = i;
+
+  for (int round = 0; round < MAX_DATA_SET_SIZE * 20; round++) {
+    int index = rand() % (length + 1);
+    int* dataPtr = &testData[rand() % MAX_DATA_SET_SIZE];
+    int op = rand() % 7;
+
+    if (op == 0 && length < MAX_DATA_SET_SIZE) {
+      myList->add(myList, dataPtr, index, &status);
+      ck_assert_int_eq(status, OK);
+      for (int i = length; i > index; i--)
+        shadow[i] = shadow[i - 1];
+      shadow[index] = dataPtr;
+      length++;
+    } else if (op == 1 && length < MAX_DATA_SET_SIZE) {
+      myList->append(myList, dataPtr, &status);
+      shadow[length++] = dataPtr;
+    } else if (op == 2 && length < MAX_DATA_SET_SIZE) {
+      myList->prepend(myList, dataPtr, &status);
+      for (int i = length; i > 0; i--)
+        shadow[i] = shadow[i - 1];
+      shadow[0] = dataPtr;
+      length++;
+    } else if (op == 3 && index < length) {
+      ck_assert_ptr_eq(myList->remove(myList, index, &status), shadow[index]);
+      ck_assert_int_eq(status, OK);
+      for (int i = index; i < length - 1; i++)
+        shadow[i] = shadow[i + 1];
+      length--;
+    } else if (op == 4 && length > 0) {
+      ck_assert_ptr_eq(myList->pop(myList, &status), shadow[0]);
+      for (int i = 0; i < length - 1; i++)
+        shadow[i] = shadow[i + 1];
+      length--;
+    } else if (op == 5 && length > 0) {
+      ck_assert_ptr_eq(myList->pull(myList, &status), shadow[length - 1]);
+      length--;
+    } else if (index < length) {
+      ck_assert_ptr_eq(myList->replace(myList, dataPtr, index, &status), shadow[index]);
+      shadow[index] = dataPtr;
+    }
+
+    ck_assert_int_eq(myList->length(myList, &status), length);
+  }
+
+  for (int i = 0; i < length; i++)
+    ck_assert_ptr_eq(myList->at(myList, i, &status), shadow[i]);
+
+  int** expected = shadow;
+  myList->forEach(myList, &checkItem, &expected, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_eq(expected, shadow + length);
+
+  /* no two neighbouring blocks are both less than half full */
+  ck_assert_int_le(counter.allocs - counter.frees - 2, 2 + 4 * length / SMALL_BLOCK_ITEMS);
+
+  myList->clear(myList, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myList->empty(myList, &status), 1);
+  ck_assert_int_eq(counter.allocs - counter.frees, 2);
+
+  myList->delete(myList, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(counter.bytes, 0);
+} END_TEST
+
+/* TEST CASE METHODS END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_unrolledList_suite() {
+  srand(time(NULL));
+
+  Suite *s;
+  s = suite_create("LDSC_unrolledList");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, initialization);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_init_with = tcase_create("init_with");
+  tcase_add_test(tc_init_with, init_with_invalid_params);
+  tcase_add_test(tc_init_with, init_with);
+  suite_add_tcase(s, tc_init_with);
+
+  TCase* tc_methods = tcase_create("methods");
+  tcase_add_test(tc_methods, methods_invalid_params);
+  tcase_add_test(tc_methods, methods);
+  suite_add_tcase(s, tc_methods);
+
+  return s;
+}
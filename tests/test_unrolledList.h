@@ -0,0 +1,8 @@
+#ifndef TEST_UNROLLEDLIST_H
+#define TEST_UNROLLEDLIST_H
+
+#include <check.h>
+
+Suite* LDSC_unrolledList_suite(void);
+
+#endif
@@ -0,0 +1,374 @@
+#include <stdlib.h>
+
+#include "LDSC_vecStack.h"
+#include "test_vecStack.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_vecStack data structure.
+ * Only the 'initialization' test will check for possible malloc errors.
+ * All following tests will assume successful mallocs.
+ * All tests will test for successful LDSC_vecStack delete.
+ * All status checks will occur before value checks, if applicable.
+ * Beyond that, status checks will only occur the methods that the test targets
+ */
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(initialization) {
+  typedef struct privateData {
+    int size;
+    void** buffer;
+    int capacity;
+  } privateData;
+
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myStack);
+
+  privateData* pd = (privateData*)myStack->pd;
+  ck_assert_ptr_nonnull(pd);
+  ck_assert_int_eq(pd->size, 0);
+  ck_assert_ptr_nonnull(pd->buffer);
+  ck_assert_int_eq(pd->capacity, LDSC_VECSTACK_DEFAULT_CAPACITY);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_vecStack* myStack = LDSC_vecStack_init_with(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myStack);
+
+  myStack = LDSC_vecStack_init_with(&allocator, 8, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myStack);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE SIZE START */
+
+START_TEST(size_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+
+  int size = myStack->size(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(size, ERROR);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(size_empty_stack) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+
+  int size = myStack->size(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(size, 0);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE SIZE END */
+
+/**************************************************/
+
+/* TEST CASE PUSH START */
+
+START_TEST(push_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+  int testData = 17;
+
+  myStack->push(NULL, NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->push(myStack, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  myStack->push(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  
+  int size = myStack->size(myStack, &status);
+  ck_assert_int_eq(size, 0);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(push) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init_with(NULL, 2, &status);
+  int testData[100];
+
+  for (int i = 0; i < 100; i++) {
+    testData[i] = i;
+    myStack->push(myStack, &testData[i], &status);
+    ck_assert_int_eq(status, OK);
+  }
+
+  int size = myStack->size(myStack, &status);
+  ck_assert_int_eq(size, 100);
+  ck_assert_int_eq(myStack->capacity(myStack, &status), 128);
+
+  for (int i = 99; i >= 0; i--)
+    ck_assert_int_eq(*(int*)myStack->pop(myStack, &status), testData[i]);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE PUSH END */
+
+/**************************************************/
+
+/* TEST CASE EMPTY START */
+
+START_TEST(empty_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+
+  int isEmpty = myStack->empty(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(isEmpty, ERROR);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(empty) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+  int isEmpty;
+
+  isEmpty = myStack->empty(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(isEmpty, 1);
+
+  int testData = 17;
+  myStack->push(myStack, &testData, &status);
+
+  isEmpty = myStack->empty(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(isEmpty, 0);
+ 
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE EMPTY END */
+
+/**************************************************/
+
+/* TEST CASE PEEK START */
+
+START_TEST(peek_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+
+  void* dataPtr = myStack->peek(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(peek) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+  int testData = 17;
+  void* dataPtr;
+
+  dataPtr = myStack->peek(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_null(dataPtr);
+
+  myStack->push(myStack, &testData, &status);
+  
+  dataPtr = myStack->peek(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(dataPtr);
+  ck_assert_int_eq(*(int*)dataPtr, testData);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE PEEK END */
+
+/**************************************************/
+
+/* TEST CASE POP START */
+
+START_TEST(pop_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+
+  void* dataPtr = myStack->pop(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(pop) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+  int testData = 17;
+  void* dataPtr;
+
+  dataPtr = myStack->pop(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_null(dataPtr);
+
+  myStack->push(myStack, &testData, &status);
+
+  dataPtr = myStack->pop(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(dataPtr);
+  ck_assert_int_eq(*(int*)dataPtr, testData);
+  ck_assert_int_eq(myStack->size(myStack, &status), 0);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(pop_auto_shrink) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init_with(NULL, 4, &status);
+  int testData = 17;
+
+  for (int i = 0; i < 64; i++)
+    myStack->push(myStack, &testData, &status);
+  ck_assert_int_eq(myStack->capacity(myStack, &status), 64);
+
+  myStack->setAutoShrink(myStack, 1, &status);
+  ck_assert_int_eq(status, OK);
+
+  for (int i = 0; i < 64; i++)
+    myStack->pop(myStack, &status);
+  ck_assert_int_eq(myStack->capacity(myStack, &status), 4);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE POP END */
+
+/**************************************************/
+
+/* TEST CASE CAPACITY START */
+
+START_TEST(capacity_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+
+  int capacity = myStack->capacity(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(capacity, ERROR);
+
+  myStack->reserve(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->reserve(myStack, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+
+  myStack->shrinkToFit(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->setAutoShrink(NULL, 1, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(capacity) {
+  LDSC_error status = OK;
+  LDSC_vecStack* myStack = LDSC_vecStack_init(&status);
+  int testData = 17;
+
+  myStack->reserve(myStack, 1000, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myStack->capacity(myStack, &status), 1000);
+
+  myStack->reserve(myStack, 10, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myStack->capacity(myStack, &status), 1000);
+
+  for (int i = 0; i < 10; i++)
+    myStack->push(myStack, &testData, &status);
+
+  myStack->shrinkToFit(myStack, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(myStack->capacity(myStack, &status), 10);
+  ck_assert_int_eq(myStack->size(myStack, &status), 10);
+  ck_assert_int_eq(*(int*)myStack->peek(myStack, &status), testData);
+
+  myStack->delete(myStack, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE CAPACITY END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_vecStack_suite() {
+  Suite *s;
+  s = suite_create("LDSC_vecStack");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, initialization);
+  tcase_add_test(tc_core, init_with_invalid_params);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_size = tcase_create("size");
+  tcase_add_test(tc_size, size_invalid_params);
+  tcase_add_test(tc_size, size_empty_stack);
+  suite_add_tcase(s, tc_size);
+
+  TCase* tc_push = tcase_create("push");
+  tcase_add_test(tc_push, push_invalid_params);
+  tcase_add_test(tc_push, push);
+  suite_add_tcase(s, tc_push);
+
+  TCase* tc_empty = tcase_create("empty");
+  tcase_add_test(tc_empty, empty_invalid_params);
+  tcase_add_test(tc_empty, empty);
+  suite_add_tcase(s, tc_empty);
+
+  TCase* tc_peek = tcase_create("peek");
+  tcase_add_test(tc_peek, peek_invalid_params);
+  tcase_add_test(tc_peek, peek);
+  suite_add_tcase(s, tc_peek);
+
+  TCase* tc_pop = tcase_create("pop");
+  tcase_add_test(tc_pop, pop_invalid_params);
+  tcase_add_test(tc_pop, pop);
+  tcase_add_test(tc_pop, pop_auto_shrink);
+  suite_add_tcase(s, tc_pop);
+
+  TCase* tc_capacity = tcase_create("capacity");
+  tcase_add_test(tc_capacity, capacity_invalid_params);
+  tcase_add_test(tc_capacity, capacity);
+  suite_add_tcase(s, tc_capacity);
+
+  return s;
+}
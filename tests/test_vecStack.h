@@ -0,0 +1,8 @@
+#ifndef TEST_VECSTACK_H
+#define TEST_VECSTACK_H
+
+#include <check.h>
+
+Suite* LDSC_vecStack_suite(void);
+
+#endif
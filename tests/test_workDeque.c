@@ -0,0 +1,271 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "LDSC_errors.h"
+#include "LDSC_workDeque.h"
+#include "test_workDeque.h"
+#include <check.h>
+
+/**
+ * Test suite for LDSC_workDeque data structure.
+ * Only the 'initialization' test will check for possible malloc errors.
+ * All following tests will assume successful mallocs.
+ * All tests will test for successful LDSC_workDeque delete.
+ * All status checks will occur before value checks, if applicable.
+ * Beyond that, status checks will only occur the methods that the test targets
+ */
+
+/**************************************************/
+
+enum Test_constants {
+  STEAL_THIEVES = 3,
+  STEAL_ITEMS = 50000
+};
+
+/**************************************************/
+
+/* TEST CASE CORE START */
+
+START_TEST(initialization) {
+  LDSC_error status = OK;
+
+  LDSC_workDeque* myDeque = LDSC_workDeque_init(&status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_ptr_nonnull(myDeque);
+  ck_assert_ptr_nonnull(myDeque->pd);
+
+  int empty = myDeque->empty(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(empty, 1);
+
+  myDeque->delete(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(init_with_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_allocator allocator = { NULL, NULL, NULL };
+
+  LDSC_workDeque* myDeque = LDSC_workDeque_init_with(NULL, -1, &status);
+  ck_assert_int_eq(status, INVALID_CAPACITY);
+  ck_assert_ptr_null(myDeque);
+
+  myDeque = LDSC_workDeque_init_with(&allocator, 0, &status);
+  ck_assert_int_eq(status, INVALID_ALLOCATOR);
+  ck_assert_ptr_null(myDeque);
+} END_TEST
+
+/* TEST CASE CORE END */
+
+/**************************************************/
+
+/* TEST CASE PUSH START */
+
+START_TEST(push_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_workDeque* myDeque = LDSC_workDeque_init(&status);
+  int testData = 17;
+
+  myDeque->push(NULL, &testData, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+
+  myDeque->push(myDeque, NULL, &status);
+  ck_assert_int_eq(status, NULL_DATAPTR);
+
+  int length = myDeque->length(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_int_eq(length, ERROR);
+
+  myDeque->delete(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(push_grow) {
+  LDSC_error status = OK;
+  LDSC_workDeque* myDeque = LDSC_workDeque_init_with(NULL, 2, &status);
+  int testData[100];
+
+  for (int i = 0; i < 100; i++) {
+    testData[i] = i;
+    myDeque->push(myDeque, &testData[i], &status);
+    ck_assert_int_eq(status, OK);
+  }
+  ck_assert_int_eq(myDeque->length(myDeque, &status), 100);
+
+  for (int i = 0; i < 50; i++)
+    ck_assert_int_eq(*(int*)myDeque->steal(myDeque, &status), i);
+  for (int i = 99; i >= 50; i--)
+    ck_assert_int_eq(*(int*)myDeque->pop(myDeque, &status), i);
+
+  myDeque->delete(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE PUSH END */
+
+/**************************************************/
+
+/* TEST CASE POP START */
+
+START_TEST(pop_invalid_params) {
+  LDSC_error status = OK;
+  LDSC_workDeque* myDeque = LDSC_workDeque_init(&status);
+
+  void* dataPtr = myDeque->pop(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  dataPtr = myDeque->steal(NULL, &status);
+  ck_assert_int_eq(status, NULL_SELF);
+  ck_assert_ptr_null(dataPtr);
+
+  myDeque->delete(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+START_TEST(pop) {
+  LDSC_error status = OK;
+  LDSC_workDeque* myDeque = LDSC_workDeque_init(&status);
+  int testData[] = {17, 9, 19};
+
+  void* dataPtr = myDeque->pop(myDeque, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  ck_assert_ptr_null(dataPtr);
+
+  dataPtr = myDeque->steal(myDeque, &status);
+  ck_assert_int_eq(status, STRUCTURE_EMPTY);
+  ck_assert_ptr_null(dataPtr);
+
+  for (int i = 0; i < 3; i++)
+    myDeque->push(myDeque, &testData[i], &status);
+
+  dataPtr = myDeque->pop(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData[2]);
+
+  dataPtr = myDeque->steal(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData[0]);
+
+  dataPtr = myDeque->pop(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+  ck_assert_int_eq(*(int*)dataPtr, testData[1]);
+
+  ck_assert_int_eq(myDeque->empty(myDeque, &status), 1);
+
+  myDeque->delete(myDeque, &status);
+  ck_assert_int_eq(status, OK);
+} END_TEST
+
+/* TEST CASE POP END */
+
+/**************************************************/
+
+/* TEST CASE STEAL START */
+
+typedef struct StealShared {
+  LDSC_workDeque* deque;
+  atomic_int taken[STEAL_ITEMS];
+  atomic_int total;
+  atomic_int done;
+} StealShared;
+
+static int stealData[STEAL_ITEMS];
+
+static void* thief(void* arg) {
+  StealShared* shared = (StealShared*)arg;
+  LDSC_error status = OK;
+
+  for (;;) {
+    int* dataPtr = shared->deque->steal(shared->deque, &status);
+    if (dataPtr) {
+      atomic_fetch_add(&shared->taken[*dataPtr], 1);
+      atomic_fetch_add(&shared->total, 1);
+    } else if (atomic_load(&shared->done)) {
+      return NULL;
+    } else {
+      sched_yield();
+    }
+  }
+}
+
+START_TEST(steal) {
+  LDSC_error status = OK;
+  StealShared* shared = malloc(sizeof(StealShared));
+  pthread_t thieves[STEAL_THIEVES];
+
+  shared->deque = LDSC_workDeque_init_with(NULL, 4, &status);
+  for (int i = 0; i < STEAL_ITEMS; i++) {
+    stealData[i] = i;
+    atomic_init(&shared->taken[i], 0);
+  }
+  atomic_init(&shared->total, 0);
+  atomic_init(&shared->done, 0);
+
+  for (int i = 0; i < STEAL_THIEVES; i++)
+    pthread_create(&thieves[i], NULL, &thief, shared);
+
+  for (int i = 0; i < STEAL_ITEMS; i++) {
+    shared->deque->push(shared->deque, &stealData[i], &status);
+    ck_assert_int_eq(status, OK);
+    if (i % 3 == 0) {
+      int* dataPtr = shared->deque->pop(shared->deque, &status);
+      if (dataPtr) {
+        atomic_fetch_add(&shared->taken[*dataPtr], 1);
+        atomic_fetch_add(&shared->total, 1);
+      }
+    }
+  }
+
+  int* dataPtr;
+  while ((dataPtr = shared->deque->pop(shared->deque, &status))) {
+    atomic_fetch_add(&shared->taken[*dataPtr], 1);
+    atomic_fetch_add(&shared->total, 1);
+  }
+  atomic_store(&shared->done, 1);
+
+  for (int i = 0; i < STEAL_THIEVES; i++)
+    pthread_join(thieves[i], NULL);
+
+  ck_assert_int_eq(atomic_load(&shared->total), STEAL_ITEMS);
+  for (int i = 0; i < STEAL_ITEMS; i++)
+    ck_assert_int_eq(atomic_load(&shared->taken[i]), 1);
+
+  shared->deque->delete(shared->deque, &status);
+  ck_assert_int_eq(status, OK);
+  free(shared);
+} END_TEST
+
+/* TEST CASE STEAL END */
+
+/**************************************************/
+
+/* SUITE DEFINITION */
+
+Suite* LDSC_workDeque_suite() {
+  Suite *s;
+  s = suite_create("LDSC_workDeque");
+
+  TCase* tc_core = tcase_create("core");
+  tcase_add_test(tc_core, initialization);
+  tcase_add_test(tc_core, init_with_invalid_params);
+  suite_add_tcase(s, tc_core);
+
+  TCase* tc_push = tcase_create("push");
+  tcase_add_test(tc_push, push_invalid_params);
+  tcase_add_test(tc_push, push_grow);
+  suite_add_tcase(s, tc_push);
+
+  TCase* tc_pop = tcase_create("pop");
+  tcase_add_test(tc_pop, pop_invalid_params);
+  tcase_add_test(tc_pop, pop);
+  suite_add_tcase(s, tc_pop);
+
+  TCase* tc_steal = tcase_create("steal");
+  tcase_add_test(tc_steal, steal);
+  suite_add_tcase(s, tc_steal);
+
+  return s;
+}
@@ -0,0 +1,8 @@
+#ifndef TEST_WORKDEQUE_H
+#define TEST_WORKDEQUE_H
+
+#include <check.h>
+
+Suite* LDSC_workDeque_suite(void);
+
+#endif